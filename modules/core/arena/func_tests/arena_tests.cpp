@@ -0,0 +1,143 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/arena/include/arena.hpp"
+#include "core/matrix_reduce/include/matrix_reduce.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+bool is_aligned(const void *ptr, std::size_t alignment) {
+  return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+// sums of the rows of the input with partials in the task's scratch arena
+class ScratchSumTask : public ppc::core::Task {
+ public:
+  explicit ScratchSumTask(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool validation() override {
+    internal_order_test();
+    return true;
+  }
+  bool pre_processing() override {
+    internal_order_test();
+    return true;
+  }
+  bool run() override {
+    internal_order_test();
+    auto view = ppc::core::MatrixView<double>::row_major(taskData->input_view<double>(0).data(), 4, 1000);
+    ppc::core::MatrixSums<double> sums(view, ppc::core::MatrixAxis::ROWS, 8, &scratch());
+    for (std::size_t part = 0; part < sums.parts(); part++) sums.run(part, out_.data());
+    sums.finish(out_.data());
+    return true;
+  }
+  bool post_processing() override {
+    internal_order_test();
+    std::copy(out_.begin(), out_.end(), reinterpret_cast<double *>(taskData->outputs[0]));
+    return true;
+  }
+
+ private:
+  std::vector<double> out_ = std::vector<double>(4);
+};
+
+}  // namespace
+
+TEST(arena_tests, check_alignment_and_stats) {
+  ppc::core::Arena arena;
+  auto *a = arena.allocate(3, 1);
+  auto *b = arena.allocate(8);
+  auto *c = arena.allocate(100, 256);
+  EXPECT_NE(a, b);
+  EXPECT_TRUE(is_aligned(b, ppc::core::cache_line_size));
+  EXPECT_TRUE(is_aligned(c, 256));
+  EXPECT_GE(arena.stats().used, 3U + 8U + 100U);
+  EXPECT_EQ(arena.stats().peak, arena.stats().used);
+  EXPECT_EQ(arena.stats().system_allocations, 1U);
+  EXPECT_ANY_THROW(arena.allocate(8, 3));
+}
+
+TEST(arena_tests, check_arrays) {
+  ppc::core::Arena arena;
+  auto filled = arena.allocate_array<int>(100, 7);
+  EXPECT_EQ(filled.size(), 100U);
+  EXPECT_TRUE(std::all_of(filled.begin(), filled.end(), [](int value) { return value == 7; }));
+  auto zeros = arena.allocate_array<double>(10);
+  EXPECT_TRUE(std::all_of(zeros.begin(), zeros.end(), [](double value) { return value == 0.0; }));
+  auto raw = arena.allocate_uninitialized<uint64_t>(10);
+  EXPECT_TRUE(is_aligned(raw.data(), ppc::core::cache_line_size));
+  // the arrays do not overlap
+  EXPECT_TRUE(filled.data() + filled.size() <= reinterpret_cast<int *>(zeros.data()));
+}
+
+TEST(arena_tests, check_reset_reuses_memory) {
+  ppc::core::Arena arena(4096);
+  void *first = nullptr;
+  for (int iteration = 0; iteration < 5; iteration++) {
+    arena.reset();
+    // more than one chunk in every iteration
+    void *ptr = arena.allocate(3000);
+    arena.allocate(3000);
+    arena.allocate(10000);
+    if (iteration == 0) continue;
+    // after the first iteration the chunks are merged into one block
+    if (iteration == 1) first = ptr;
+    EXPECT_EQ(ptr, first);
+  }
+  const auto &stats = arena.stats();
+  EXPECT_EQ(stats.resets, 5U);
+  EXPECT_LE(stats.system_allocations, 4U);
+  EXPECT_GE(stats.peak, 16000U);
+  const auto allocations = stats.system_allocations;
+  arena.reset();
+  arena.allocate(16000);
+  EXPECT_EQ(arena.stats().system_allocations, allocations);
+}
+
+TEST(arena_tests, check_scope_rewinds) {
+  ppc::core::Arena arena;
+  arena.allocate(100);
+  const auto used = arena.stats().used;
+  void *inner = nullptr;
+  {
+    ppc::core::ArenaScope scope(arena);
+    inner = arena.allocate(1000);
+    EXPECT_GT(arena.stats().used, used);
+  }
+  EXPECT_EQ(arena.stats().used, used);
+  EXPECT_EQ(arena.allocate(1000), inner);
+}
+
+TEST(arena_tests, check_large_chunks) {
+  ppc::core::Arena arena;
+  auto big = arena.allocate_array<uint8_t>(5 * 1024 * 1024, 1);
+  EXPECT_EQ(big.back(), 1);
+  EXPECT_GE(arena.stats().reserved, big.size());
+  // huge pages depend on the system, only the bookkeeping is checked
+  EXPECT_LE(arena.stats().huge_page_chunks, arena.stats().system_allocations);
+}
+
+TEST(arena_tests, check_task_scratch_between_runs) {
+  std::vector<double> in(4 * 1000, 1.0);
+  std::vector<double> out(4);
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_output(out);
+  ScratchSumTask task(taskData);
+  ASSERT_TRUE(task.validation());
+  task.pre_processing();
+  for (int i = 0; i < 10; i++) task.run();
+  task.post_processing();
+  EXPECT_EQ(out, std::vector<double>(4, 1000.0));
+  const auto &stats = task.scratch_stats();
+  EXPECT_GT(stats.peak, 0U);
+  EXPECT_EQ(stats.resets, 10U);
+  // every run reused the memory of the first one
+  EXPECT_EQ(stats.system_allocations, 1U);
+}
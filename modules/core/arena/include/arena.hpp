@@ -0,0 +1,120 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_ARENA_HPP_
+#define MODULES_CORE_INCLUDE_ARENA_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace ppc::core {
+
+inline constexpr std::size_t cache_line_size = 64;
+
+struct ArenaStats {
+  // bytes handed out since the last reset, alignment padding included
+  std::size_t used = 0;
+  // largest used over the lifetime of the arena
+  std::size_t peak = 0;
+  // bytes of the chunks owned by the arena
+  std::size_t reserved = 0;
+  // chunks requested from the system, constant once the arena is warm
+  std::size_t system_allocations = 0;
+  std::size_t huge_page_chunks = 0;
+  std::size_t resets = 0;
+};
+
+// Bump allocator for scratch memory of repeated runs. Allocations are
+// released together by reset() or by rewinding to a marker, destructors are
+// never run. Chunks are kept between resets, chunks of one iteration are
+// merged into a single chunk by reset(), so a warm arena serves every run
+// from one block without calls to the system allocator.
+// Chunks of 2 MiB and more are mapped with transparent huge pages when the
+// system supports them. The arena never writes its chunks: pages are placed
+// on the NUMA node of the thread touching them first, so memory handed to a
+// thread should be initialized by that thread.
+class Arena {
+ public:
+  static constexpr std::size_t default_chunk_size = 64 * 1024;
+
+  explicit Arena(std::size_t chunk_size = default_chunk_size);
+  Arena(const Arena &) = delete;
+  Arena &operator=(const Arena &) = delete;
+  ~Arena();
+
+  // alignment is a power of two
+  void *allocate(std::size_t bytes, std::size_t alignment = cache_line_size);
+
+  // uninitialized elements, aligned to the cache line
+  template <class T>
+  std::span<T> allocate_uninitialized(std::size_t count) {
+    static_assert(std::is_trivially_destructible_v<T> && std::is_trivially_default_constructible_v<T>,
+                  "Arena elements are neither constructed nor destroyed");
+    auto *data = static_cast<T *>(allocate(count * sizeof(T), std::max(alignof(T), cache_line_size)));
+    return {data, count};
+  }
+
+  // elements initialized with value by the calling thread
+  template <class T>
+  std::span<T> allocate_array(std::size_t count, const T &value = T{}) {
+    static_assert(std::is_trivially_destructible_v<T>, "Arena does not run destructors");
+    auto *data = static_cast<T *>(allocate(count * sizeof(T), std::max(alignof(T), cache_line_size)));
+    std::uninitialized_fill_n(data, count, value);
+    return {data, count};
+  }
+
+  struct Marker {
+    std::size_t chunk;
+    std::size_t offset;
+    std::size_t used;
+  };
+  // position of the arena, rewind() releases everything allocated after it
+  [[nodiscard]] Marker mark() const { return {current_, offset_, stats_.used}; }
+  void rewind(const Marker &marker);
+
+  // releases all allocations
+  void reset();
+
+  [[nodiscard]] const ArenaStats &stats() const { return stats_; }
+
+ private:
+  struct Chunk {
+    std::byte *data;
+    std::size_t size;
+    bool mapped;
+  };
+
+  Chunk allocate_chunk(std::size_t min_size);
+  static void free_chunk(const Chunk &chunk);
+
+  std::vector<Chunk> chunks_;
+  // chunk being filled and the first free byte in it
+  std::size_t current_ = 0;
+  std::size_t offset_ = 0;
+  std::size_t chunk_size_;
+  ArenaStats stats_;
+};
+
+// Rewinds the arena on scope exit, scopes on one arena nest like a stack
+class ArenaScope {
+ public:
+  explicit ArenaScope(Arena &arena) : arena_(arena), marker_(arena.mark()) {}
+  ArenaScope(const ArenaScope &) = delete;
+  ArenaScope &operator=(const ArenaScope &) = delete;
+  ~ArenaScope() { arena_.rewind(marker_); }
+
+ private:
+  Arena &arena_;
+  Arena::Marker marker_;
+};
+
+// Arena of the calling thread for temporaries of parallel algorithms,
+// allocations are released by an ArenaScope
+Arena &thread_arena();
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_ARENA_HPP_
@@ -0,0 +1,121 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/arena/include/arena.hpp"
+
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+constexpr std::size_t page_size = 4096;
+constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+
+std::size_t align_up(std::size_t value, std::size_t alignment) { return (value + alignment - 1) & ~(alignment - 1); }
+
+}  // namespace
+
+ppc::core::Arena::Arena(std::size_t chunk_size) : chunk_size_(std::max(chunk_size, page_size)) {}
+
+ppc::core::Arena::~Arena() {
+  for (const auto &chunk : chunks_) free_chunk(chunk);
+}
+
+ppc::core::Arena::Chunk ppc::core::Arena::allocate_chunk(std::size_t min_size) {
+  Chunk chunk{nullptr, align_up(min_size, page_size), false};
+#if defined(__linux__)
+  if (chunk.size >= huge_page_size) {
+    // huge pages need 2 MiB aligned ranges, the mapping is trimmed to one
+    chunk.size = align_up(chunk.size, huge_page_size);
+    const std::size_t mapped_size = chunk.size + huge_page_size;
+    void *mapped = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped != MAP_FAILED) {
+      auto begin = reinterpret_cast<std::uintptr_t>(mapped);
+      auto aligned = align_up(begin, huge_page_size);
+      if (aligned != begin) munmap(mapped, aligned - begin);
+      const std::size_t tail = begin + mapped_size - (aligned + chunk.size);
+      if (tail != 0) munmap(reinterpret_cast<void *>(aligned + chunk.size), tail);
+      chunk.data = reinterpret_cast<std::byte *>(aligned);
+      chunk.mapped = true;
+#if defined(MADV_HUGEPAGE)
+      if (madvise(chunk.data, chunk.size, MADV_HUGEPAGE) == 0) stats_.huge_page_chunks++;
+#endif
+    }
+  }
+#endif
+  if (chunk.data == nullptr) {
+    chunk.data = static_cast<std::byte *>(::operator new(chunk.size, std::align_val_t(page_size)));
+  }
+  stats_.reserved += chunk.size;
+  stats_.system_allocations++;
+  return chunk;
+}
+
+void ppc::core::Arena::free_chunk(const Chunk &chunk) {
+#if defined(__linux__)
+  if (chunk.mapped) {
+    munmap(chunk.data, chunk.size);
+    return;
+  }
+#endif
+  ::operator delete(chunk.data, std::align_val_t(page_size));
+}
+
+void *ppc::core::Arena::allocate(std::size_t bytes, std::size_t alignment) {
+  if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+    throw std::invalid_argument("Arena alignment must be a power of two");
+  }
+  while (true) {
+    if (current_ < chunks_.size()) {
+      const auto &chunk = chunks_[current_];
+      const auto base = reinterpret_cast<std::uintptr_t>(chunk.data);
+      const std::size_t begin = align_up(base + offset_, alignment) - base;
+      if (begin + bytes <= chunk.size) {
+        stats_.used += begin + bytes - offset_;
+        stats_.peak = std::max(stats_.peak, stats_.used);
+        offset_ = begin + bytes;
+        return chunk.data + begin;
+      }
+      // the tail of a chunk is skipped, the next chunk is tried
+      if (current_ + 1 < chunks_.size()) {
+        current_++;
+        offset_ = 0;
+        continue;
+      }
+    }
+    // chunks grow with the arena, so the count of chunks stays logarithmic
+    const std::size_t size = std::max({chunk_size_, bytes + alignment, stats_.reserved});
+    chunks_.push_back(allocate_chunk(size));
+    current_ = chunks_.size() - 1;
+    offset_ = 0;
+  }
+}
+
+void ppc::core::Arena::rewind(const Marker &marker) {
+  current_ = marker.chunk;
+  offset_ = marker.offset;
+  stats_.used = marker.used;
+}
+
+void ppc::core::Arena::reset() {
+  if (chunks_.size() > 1) {
+    // one chunk of the total size serves the next iteration
+    const std::size_t total = stats_.reserved;
+    for (const auto &chunk : chunks_) free_chunk(chunk);
+    chunks_.clear();
+    stats_.reserved = 0;
+    chunks_.push_back(allocate_chunk(total));
+  }
+  current_ = 0;
+  offset_ = 0;
+  stats_.used = 0;
+  stats_.resets++;
+}
+
+ppc::core::Arena &ppc::core::thread_arena() {
+  thread_local Arena arena;
+  return arena;
+}
@@ -0,0 +1,98 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/data_file/include/data_file.hpp"
+
+namespace {
+
+// path in the temporary directory removed at the end of the test
+class TempPath {
+ public:
+  TempPath()
+      : path_(std::filesystem::temp_directory_path() /
+              ("ppc_data_" + std::to_string(reinterpret_cast<std::uintptr_t>(this)) + ".ppcd")) {}
+  ~TempPath() { std::filesystem::remove(path_); }
+  [[nodiscard]] std::string path() const { return path_.string(); }
+
+ private:
+  std::filesystem::path path_;
+};
+
+}  // namespace
+
+TEST(data_file_tests, check_vector_round_trip) {
+  std::vector<int> in(10007);
+  std::iota(in.begin(), in.end(), -5000);
+  TempPath file;
+  ppc::core::write_data_file<int>(file.path(), in);
+
+  ppc::core::DataFile data(file.path(), {ppc::core::MapAdvice::WILL_NEED, true, true});
+  EXPECT_EQ(data.type(), ppc::core::ElementType::INT32);
+  EXPECT_EQ(data.shape(), (std::vector<std::uint64_t>{in.size()}));
+  EXPECT_EQ(data.count(), in.size());
+  EXPECT_TRUE(data.verify());
+
+  // the buffer keeps the mapping after the TaskData copy of the descriptor
+  ppc::core::TaskData taskData;
+  taskData.add_input(ppc::core::load_data_file(file.path()));
+  auto view = taskData.input_view<int>(0);
+  EXPECT_TRUE(view.is_aligned(64));
+  EXPECT_EQ(std::vector<int>(view.begin(), view.end()), in);
+}
+
+TEST(data_file_tests, check_matrix_shape_and_layout) {
+  std::vector<double> in(6 * 4, 0.5);
+  TempPath file;
+  ppc::core::write_data_file<double>(file.path(), in, {6, 4}, ppc::core::MatrixLayout::COL_MAJOR);
+  ppc::core::DataFile data(file.path(), {ppc::core::MapAdvice::RANDOM});
+  EXPECT_EQ(data.type(), ppc::core::ElementType::FLOAT64);
+  EXPECT_EQ(data.shape(), (std::vector<std::uint64_t>{6, 4}));
+  EXPECT_EQ(data.layout(), ppc::core::MatrixLayout::COL_MAJOR);
+
+  EXPECT_THROW(ppc::core::write_data_file<double>(file.path(), in, {5, 4}), std::invalid_argument);
+  EXPECT_THROW(ppc::core::write_data_file<double>(file.path(), in, {1, 1, 1, 2, 12}), std::invalid_argument);
+}
+
+TEST(data_file_tests, check_corrupted_files) {
+  std::vector<std::uint8_t> in(1000, 7);
+  TempPath file;
+  ppc::core::write_data_file<std::uint8_t>(file.path(), in);
+  {
+    // one element changed after writing
+    std::fstream stream(file.path(), std::ios::binary | std::ios::in | std::ios::out);
+    stream.seekp(sizeof(ppc::core::DataFileHeader) + 500);
+    stream.put(8);
+  }
+  EXPECT_FALSE(ppc::core::DataFile(file.path()).verify());
+  EXPECT_THROW(ppc::core::DataFile(file.path(), {.verify_checksum = true}), std::runtime_error);
+
+  // shorter than its shape
+  std::filesystem::resize_file(file.path(), sizeof(ppc::core::DataFileHeader) + 999);
+  EXPECT_THROW(ppc::core::DataFile{file.path()}, std::runtime_error);
+
+  {
+    // 2^32 x 2^32 elements wrap around to a count of 0
+    ppc::core::write_data_file<std::uint8_t>(file.path(), in, {10, 100});
+    const std::uint64_t shape[2] = {1ULL << 32, 1ULL << 32};
+    std::fstream stream(file.path(), std::ios::binary | std::ios::in | std::ios::out);
+    stream.seekp(offsetof(ppc::core::DataFileHeader, shape));
+    stream.write(reinterpret_cast<const char *>(shape), sizeof(shape));
+  }
+  EXPECT_THROW(ppc::core::DataFile{file.path()}, std::runtime_error);
+
+  {
+    std::ofstream stream(file.path(), std::ios::binary | std::ios::trunc);
+    stream << std::string(200, 'x');
+  }
+  EXPECT_THROW(ppc::core::DataFile{file.path()}, std::runtime_error);
+  EXPECT_THROW(ppc::core::DataFile{"/nonexistent/ppc_data.ppcd"}, std::runtime_error);
+}
@@ -0,0 +1,90 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_DATA_FILE_HPP_
+#define MODULES_CORE_INCLUDE_DATA_FILE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "core/matrix_reduce/include/matrix_reduce.hpp"
+#include "core/stream/include/stream.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+// Self-describing binary container of one array:
+//   64-byte header | elements, native byte order
+// The elements start at data_offset, a multiple of 64 bytes, so a mapped
+// file gives aligned data without a copy. The checksum covers the elements.
+struct DataFileHeader {
+  char magic[8];
+  std::uint32_t version;
+  ElementType type;
+  // layout of a two-dimensional shape
+  std::uint8_t layout;
+  std::uint8_t rank;
+  std::uint8_t reserved;
+  std::uint64_t shape[4];
+  std::uint64_t data_offset;
+  std::uint64_t checksum;
+};
+static_assert(sizeof(DataFileHeader) == 64, "DataFileHeader must stay 64 bytes");
+
+inline constexpr std::uint32_t data_file_version = 1;
+inline constexpr std::size_t data_file_max_rank = 4;
+
+// 64-bit FNV-1a over 8-byte words, the tail is padded with zeros
+std::uint64_t data_checksum(const std::byte *data, std::size_t size);
+
+// Writes count elements of buffer in the container. An empty shape means a
+// vector of count elements, otherwise the product of shape must be count.
+void write_data_file(const std::string &path, const Buffer &buffer, const std::vector<std::uint64_t> &shape = {},
+                     MatrixLayout layout = MatrixLayout::ROW_MAJOR);
+
+template <class T>
+void write_data_file(const std::string &path, std::span<const T> data, const std::vector<std::uint64_t> &shape = {},
+                     MatrixLayout layout = MatrixLayout::ROW_MAJOR) {
+  write_data_file(path, Buffer::borrow(data.data(), data.size()), shape, layout);
+}
+
+struct DataFileOptions {
+  MapAdvice advice = MapAdvice::SEQUENTIAL;
+  // fault every page in on open instead of on first access
+  bool populate = false;
+  // reads all elements on open, off by default so large files open at once
+  bool verify_checksum = false;
+};
+
+// Container opened in place. The mapping is read-only and shared, so ranks
+// of one node that open the same file use the same pages of the page cache.
+class DataFile {
+ public:
+  explicit DataFile(const std::string &path, DataFileOptions options = {});
+
+  [[nodiscard]] const DataFileHeader &header() const { return header_; }
+  [[nodiscard]] ElementType type() const { return header_.type; }
+  [[nodiscard]] MatrixLayout layout() const { return static_cast<MatrixLayout>(header_.layout); }
+  [[nodiscard]] std::vector<std::uint64_t> shape() const;
+  [[nodiscard]] std::uint64_t count() const;
+  [[nodiscard]] const std::byte *data() const { return file_.data() + header_.data_offset; }
+
+  // checksum of the mapped elements matches the header
+  [[nodiscard]] bool verify() const;
+
+ private:
+  MappedFile file_;
+  DataFileHeader header_{};
+};
+
+// Descriptor of the elements of a container for TaskData::add_input(), the
+// buffer keeps the mapping alive. The elements are read-only.
+//   taskData->add_input(ppc::core::load_data_file("input.ppcd"));
+Buffer load_data_file(const std::string &path, DataFileOptions options = {});
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_DATA_FILE_HPP_
@@ -0,0 +1,124 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/data_file/include/data_file.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+constexpr char magic[8] = {'P', 'P', 'C', 'D', 'A', 'T', 'A', '\0'};
+
+std::uint64_t product(const std::uint64_t *shape, std::size_t rank) {
+  std::uint64_t count = 1;
+  for (std::size_t i = 0; i < rank; i++) count *= shape[i];
+  return count;
+}
+
+// false when the count of elements of the shape does not fit into 64 bits
+bool fits_product(const std::uint64_t *shape, std::size_t rank) {
+  if (std::find(shape, shape + rank, 0) != shape + rank) return true;
+  std::uint64_t count = 1;
+  for (std::size_t i = 0; i < rank; i++) {
+    if (count > std::numeric_limits<std::uint64_t>::max() / shape[i]) return false;
+    count *= shape[i];
+  }
+  return true;
+}
+
+}  // namespace
+
+std::uint64_t ppc::core::data_checksum(const std::byte *data, std::size_t size) {
+  constexpr std::uint64_t prime = 0x100000001b3ULL;
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  std::size_t i = 0;
+  for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t)) {
+    std::uint64_t word;
+    std::memcpy(&word, data + i, sizeof(word));
+    hash = (hash ^ word) * prime;
+  }
+  if (i < size) {
+    std::uint64_t word = 0;
+    std::memcpy(&word, data + i, size - i);
+    hash = (hash ^ word) * prime;
+  }
+  return hash;
+}
+
+void ppc::core::write_data_file(const std::string &path, const Buffer &buffer, const std::vector<std::uint64_t> &shape,
+                                MatrixLayout layout) {
+  const std::size_t size = element_size(buffer.type);
+  if (size == 0) throw std::invalid_argument("Data file elements need a known type");
+  if (!buffer.contiguous() || buffer.streamed()) throw std::invalid_argument("Data file elements must be contiguous");
+  if (shape.size() > data_file_max_rank) throw std::invalid_argument("Data file shape has too many dimensions");
+
+  DataFileHeader header{};
+  std::copy(std::begin(magic), std::end(magic), header.magic);
+  header.version = data_file_version;
+  header.type = buffer.type;
+  header.layout = static_cast<std::uint8_t>(layout);
+  header.rank = shape.empty() ? 1 : static_cast<std::uint8_t>(shape.size());
+  if (shape.empty()) {
+    header.shape[0] = buffer.count;
+  } else {
+    std::copy(shape.begin(), shape.end(), header.shape);
+  }
+  if (!fits_product(header.shape, header.rank) || product(header.shape, header.rank) != buffer.count) {
+    throw std::invalid_argument("Data file shape does not match the count of elements");
+  }
+  header.data_offset = sizeof(DataFileHeader);
+  const auto *data = reinterpret_cast<const std::byte *>(buffer.data);
+  const std::size_t bytes = static_cast<std::size_t>(buffer.count) * size;
+  header.checksum = data_checksum(data, bytes);
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) throw std::runtime_error("Can not create data file: " + path);
+  file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(bytes));
+  if (!file) throw std::runtime_error("Can not write data file: " + path);
+}
+
+ppc::core::DataFile::DataFile(const std::string &path, DataFileOptions options)
+    : file_(path, options.advice, options.populate) {
+  if (file_.size() < sizeof(DataFileHeader)) throw std::runtime_error("Not a data file: " + path);
+  std::memcpy(&header_, file_.data(), sizeof(header_));
+  if (!std::equal(std::begin(magic), std::end(magic), header_.magic)) {
+    throw std::runtime_error("Not a data file: " + path);
+  }
+  if (header_.version != data_file_version) {
+    throw std::runtime_error("Unsupported data file version " + std::to_string(header_.version) + ": " + path);
+  }
+  if (element_size(header_.type) == 0 || header_.rank == 0 || header_.rank > data_file_max_rank ||
+      header_.data_offset < sizeof(DataFileHeader) || header_.data_offset % cache_line_size != 0 ||
+      header_.data_offset > file_.size() || !fits_product(header_.shape, header_.rank)) {
+    throw std::runtime_error("Corrupted data file header: " + path);
+  }
+  if ((file_.size() - header_.data_offset) / element_size(header_.type) < count()) {
+    throw std::runtime_error("Data file is shorter than its shape: " + path);
+  }
+  if (options.verify_checksum && !verify()) throw std::runtime_error("Data file checksum mismatch: " + path);
+}
+
+std::vector<std::uint64_t> ppc::core::DataFile::shape() const {
+  return {header_.shape, header_.shape + header_.rank};
+}
+
+std::uint64_t ppc::core::DataFile::count() const { return product(header_.shape, header_.rank); }
+
+bool ppc::core::DataFile::verify() const {
+  const auto bytes = static_cast<std::size_t>(count()) * element_size(header_.type);
+  return data_checksum(data(), bytes) == header_.checksum;
+}
+
+ppc::core::Buffer ppc::core::load_data_file(const std::string &path, DataFileOptions options) {
+  auto file = std::make_shared<DataFile>(path, options);
+  Buffer buffer;
+  buffer.data = reinterpret_cast<uint8_t *>(const_cast<std::byte *>(file->data()));
+  buffer.type = file->type();
+  buffer.count = file->count();
+  buffer.alignment = address_alignment(buffer.data);
+  buffer.owner = std::move(file);
+  return buffer;
+}
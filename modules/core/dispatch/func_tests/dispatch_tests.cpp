@@ -0,0 +1,81 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "core/dispatch/include/dispatch.hpp"
+
+namespace {
+
+using ppc::core::IsaLevel;
+
+int scalar_variant(int x) { return x; }
+int sse4_variant(int x) { return x + 1; }
+int avx2_variant(int x) { return x + 2; }
+
+}  // namespace
+
+TEST(dispatch_tests, check_level_names) {
+  for (auto level : {IsaLevel::scalar, IsaLevel::sse4, IsaLevel::avx2, IsaLevel::avx512}) {
+    EXPECT_EQ(ppc::core::parse_isa_level(ppc::core::to_string(level)), level);
+  }
+  EXPECT_THROW(ppc::core::parse_isa_level("avx3"), std::invalid_argument);
+}
+
+TEST(dispatch_tests, check_detected_features) {
+  const auto &features = ppc::core::cpu_features();
+  EXPECT_TRUE(!features.avx2 || features.avx);
+  EXPECT_TRUE(!features.avx512bw || features.avx512f);
+  const auto detected = ppc::core::detected_isa_level();
+  EXPECT_TRUE(ppc::core::cpu_supports(detected));
+  EXPECT_TRUE(ppc::core::cpu_supports(IsaLevel::scalar));
+  EXPECT_LE(ppc::core::isa_level(), detected);
+}
+
+TEST(dispatch_tests, check_level_override) {
+  const auto detected = ppc::core::detected_isa_level();
+  EXPECT_EQ(ppc::core::resolve_isa_level(nullptr), detected);
+  EXPECT_EQ(ppc::core::resolve_isa_level(""), detected);
+  EXPECT_EQ(ppc::core::resolve_isa_level("scalar"), IsaLevel::scalar);
+  EXPECT_EQ(ppc::core::resolve_isa_level("unknown"), detected);
+  // levels above the CPU are not forced
+  EXPECT_EQ(ppc::core::resolve_isa_level("avx512"), detected);
+}
+
+TEST(dispatch_tests, check_bound_variant) {
+  // avx512 variant is not built
+  ppc::core::Dispatched<int (*)(int)> kernel("test_kernel", {{IsaLevel::scalar, scalar_variant},
+                                                             {IsaLevel::avx512, nullptr},
+                                                             {IsaLevel::avx2, avx2_variant},
+                                                             {IsaLevel::sse4, sse4_variant}});
+  IsaLevel expected = IsaLevel::scalar;
+  for (auto level : {IsaLevel::sse4, IsaLevel::avx2}) {
+    if (level <= ppc::core::isa_level() && ppc::core::cpu_supports(level)) expected = level;
+  }
+  EXPECT_EQ(kernel.level(), expected);
+  EXPECT_EQ(kernel.get()(10), 10 + static_cast<int>(expected));
+  EXPECT_NE(ppc::core::bound_variants().find(std::string("test_kernel=") + ppc::core::to_string(expected)),
+            std::string::npos);
+}
+
+TEST(dispatch_tests, check_used_variants) {
+  ppc::core::Dispatched<int (*)(int)> kernel("used_kernel", {{IsaLevel::scalar, scalar_variant}});
+  const std::string used = std::string("used_kernel=") + ppc::core::to_string(IsaLevel::scalar);
+  kernel.get();
+  // kernels called before the reset are not reported
+  ppc::core::reset_used_variants();
+  EXPECT_EQ(ppc::core::used_variants(), "");
+  kernel.get();
+  kernel.get();
+  EXPECT_EQ(ppc::core::used_variants(), used);
+  ppc::core::reset_used_variants();
+  EXPECT_EQ(ppc::core::used_variants(), "");
+  kernel.get();
+  EXPECT_EQ(ppc::core::used_variants(), used);
+}
+
+TEST(dispatch_tests, check_missing_variant) {
+  ppc::core::Dispatched<int (*)(int)> kernel("missing_kernel", {{IsaLevel::scalar, nullptr}});
+  EXPECT_THROW(kernel.get(), std::logic_error);
+}
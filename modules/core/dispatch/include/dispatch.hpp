@@ -0,0 +1,112 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_DISPATCH_HPP_
+#define MODULES_CORE_INCLUDE_DISPATCH_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ppc::core {
+
+// instruction sets with kernel variants, ordered from the slowest
+enum class IsaLevel { scalar, sse4, avx2, avx512 };
+
+// features reported by cpuid, AVX ones only when the OS saves their registers
+struct CpuFeatures {
+  bool sse4_1 = false;
+  bool avx = false;
+  bool avx2 = false;
+  bool fma = false;
+  bool avx512f = false;
+  bool avx512bw = false;
+  bool avx512vl = false;
+};
+
+// detected once, before main()
+const CpuFeatures &cpu_features();
+bool cpu_supports(IsaLevel level);
+// highest level supported by the CPU
+IsaLevel detected_isa_level();
+// Level of bound kernel variants: the detected one, lowered by PPC_ISA_LEVEL
+// (scalar, sse4, avx2 or avx512) for benchmarking. Levels above the detected
+// one are not forced. Read once.
+IsaLevel isa_level();
+// level for a PPC_ISA_LEVEL value, nullptr or an empty value keep the detected level
+IsaLevel resolve_isa_level(const char *requested);
+
+const char *to_string(IsaLevel level);
+// throws std::invalid_argument for unknown names
+IsaLevel parse_isa_level(const std::string &name);
+
+// kernel variants bound so far, "kernel=level" separated by ';' in order of binding
+void record_variant(const std::string &kernel, IsaLevel level);
+std::string bound_variants();
+
+// Kernel variants called since the last reset_used_variants(), in the same
+// format in order of first use. Perf records report the kernels of their own
+// measurement with them, not everything bound earlier in the process.
+void reset_used_variants();
+std::string used_variants();
+void note_used_variant(const std::string &kernel, IsaLevel level);
+// incremented by reset_used_variants(), kernels note their use once per value
+std::atomic<std::uint64_t> &used_variants_epoch();
+
+// One kernel with a variant per instruction set (usually function pointers).
+// The variant of the highest level not above isa_level() is bound on the
+// first call of get() and recorded for perf output, the first call after
+// reset_used_variants() notes it as used. Null variants stand for levels not
+// built and are skipped, the scalar variant is the fallback.
+template <class Variant>
+class Dispatched {
+ public:
+  Dispatched(std::string name, std::initializer_list<std::pair<IsaLevel, Variant>> variants)
+      : name_(std::move(name)), variants_(variants) {}
+
+  const Variant &get() {
+    std::call_once(bound_flag_, [this] { bind(); });
+    const auto epoch = used_variants_epoch().load(std::memory_order_relaxed);
+    if (noted_epoch_.load(std::memory_order_relaxed) != epoch) {
+      noted_epoch_.store(epoch, std::memory_order_relaxed);
+      note_used_variant(name_, variants_[bound_].first);
+    }
+    return variants_[bound_].second;
+  }
+
+  IsaLevel level() {
+    get();
+    return variants_[bound_].first;
+  }
+
+ private:
+  void bind() {
+    const IsaLevel limit = isa_level();
+    bool found = false;
+    for (std::size_t i = 0; i < variants_.size(); i++) {
+      const auto level = variants_[i].first;
+      if (!variants_[i].second || level > limit || !cpu_supports(level)) continue;
+      if (!found || variants_[bound_].first < level) bound_ = i;
+      found = true;
+    }
+    if (!found) {
+      throw std::logic_error("kernel " + name_ + " has no variant for this CPU");
+    }
+    record_variant(name_, variants_[bound_].first);
+  }
+
+  std::string name_;
+  std::vector<std::pair<IsaLevel, Variant>> variants_;
+  std::once_flag bound_flag_;
+  std::size_t bound_ = 0;
+  std::atomic<std::uint64_t> noted_epoch_ = 0;
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_DISPATCH_HPP_
@@ -0,0 +1,197 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/dispatch/include/dispatch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#define PPC_DISPATCH_X86
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#define PPC_DISPATCH_X86
+#endif
+
+namespace {
+
+#ifdef PPC_DISPATCH_X86
+// eax, ebx, ecx, edx of the leaf
+std::array<uint32_t, 4> cpuid(uint32_t leaf, uint32_t subleaf) {
+  std::array<uint32_t, 4> regs{};
+#ifdef _MSC_VER
+  int info[4];
+  __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+  for (int i = 0; i < 4; i++) regs[i] = static_cast<uint32_t>(info[i]);
+#else
+  __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+  return regs;
+}
+
+// state components enabled by the OS in XCR0
+uint64_t xgetbv0() {
+#ifdef _MSC_VER
+  return _xgetbv(0);
+#else
+  uint32_t eax = 0;
+  uint32_t edx = 0;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+#endif
+
+ppc::core::CpuFeatures detect_features() {
+  ppc::core::CpuFeatures features;
+#ifdef PPC_DISPATCH_X86
+  const auto max_leaf = cpuid(0, 0)[0];
+  if (max_leaf < 1) return features;
+  const auto leaf1 = cpuid(1, 0);
+  features.sse4_1 = (leaf1[2] >> 19) & 1;
+  const bool osxsave = (leaf1[2] >> 27) & 1;
+  const uint64_t xcr0 = osxsave ? xgetbv0() : 0;
+  // XMM and YMM state, then opmask and both halves of ZMM state
+  const bool os_avx = (xcr0 & 0x6) == 0x6;
+  const bool os_avx512 = os_avx && (xcr0 & 0xe0) == 0xe0;
+  features.avx = os_avx && ((leaf1[2] >> 28) & 1);
+  features.fma = os_avx && ((leaf1[2] >> 12) & 1);
+  if (max_leaf >= 7) {
+    const auto leaf7 = cpuid(7, 0);
+    features.avx2 = features.avx && ((leaf7[1] >> 5) & 1);
+    features.avx512f = os_avx512 && ((leaf7[1] >> 16) & 1);
+    features.avx512bw = os_avx512 && ((leaf7[1] >> 30) & 1);
+    features.avx512vl = os_avx512 && ((leaf7[1] >> 31) & 1);
+  }
+#endif
+  return features;
+}
+
+// cpuid runs during static initialization of the library
+const ppc::core::CpuFeatures &features_at_startup = ppc::core::cpu_features();
+
+struct VariantLog {
+  std::mutex mutex;
+  std::string report;
+  // kernels used since the last reset and their report
+  std::vector<std::string> used_kernels;
+  std::string used_report;
+};
+
+VariantLog &variant_log() {
+  static VariantLog log;
+  return log;
+}
+
+}  // namespace
+
+const ppc::core::CpuFeatures &ppc::core::cpu_features() {
+  static const CpuFeatures features = detect_features();
+  return features;
+}
+
+bool ppc::core::cpu_supports(IsaLevel level) {
+  const auto &features = cpu_features();
+  switch (level) {
+    case IsaLevel::sse4:
+      return features.sse4_1;
+    case IsaLevel::avx2:
+      return features.avx2;
+    case IsaLevel::avx512:
+      return features.avx512f;
+    default:
+      return true;
+  }
+}
+
+ppc::core::IsaLevel ppc::core::detected_isa_level() {
+  for (auto level : {IsaLevel::avx512, IsaLevel::avx2, IsaLevel::sse4}) {
+    if (cpu_supports(level)) return level;
+  }
+  return IsaLevel::scalar;
+}
+
+ppc::core::IsaLevel ppc::core::isa_level() {
+  static const IsaLevel level = resolve_isa_level(std::getenv("PPC_ISA_LEVEL"));
+  return level;
+}
+
+ppc::core::IsaLevel ppc::core::resolve_isa_level(const char *requested) {
+  const IsaLevel detected = detected_isa_level();
+  if (requested == nullptr || *requested == '\0') return detected;
+  try {
+    const IsaLevel level = parse_isa_level(requested);
+    if (level > detected) {
+      std::cerr << "PPC_ISA_LEVEL=" << requested << " is not supported by the CPU, using " << to_string(detected)
+                << std::endl;
+      return detected;
+    }
+    return level;
+  } catch (const std::invalid_argument &error) {
+    std::cerr << error.what() << ", using " << to_string(detected) << std::endl;
+    return detected;
+  }
+}
+
+const char *ppc::core::to_string(IsaLevel level) {
+  switch (level) {
+    case IsaLevel::sse4:
+      return "sse4";
+    case IsaLevel::avx2:
+      return "avx2";
+    case IsaLevel::avx512:
+      return "avx512";
+    default:
+      return "scalar";
+  }
+}
+
+ppc::core::IsaLevel ppc::core::parse_isa_level(const std::string &name) {
+  for (auto level : {IsaLevel::scalar, IsaLevel::sse4, IsaLevel::avx2, IsaLevel::avx512}) {
+    if (name == to_string(level)) return level;
+  }
+  throw std::invalid_argument("Unknown ISA level '" + name + "', expected scalar, sse4, avx2 or avx512");
+}
+
+void ppc::core::record_variant(const std::string &kernel, IsaLevel level) {
+  auto &log = variant_log();
+  std::lock_guard<std::mutex> lock(log.mutex);
+  log.report += (log.report.empty() ? "" : ";") + kernel + "=" + to_string(level);
+}
+
+std::string ppc::core::bound_variants() {
+  auto &log = variant_log();
+  std::lock_guard<std::mutex> lock(log.mutex);
+  return log.report;
+}
+
+std::atomic<std::uint64_t> &ppc::core::used_variants_epoch() {
+  static std::atomic<std::uint64_t> epoch = 1;
+  return epoch;
+}
+
+void ppc::core::reset_used_variants() {
+  auto &log = variant_log();
+  std::lock_guard<std::mutex> lock(log.mutex);
+  log.used_kernels.clear();
+  log.used_report.clear();
+  used_variants_epoch().fetch_add(1, std::memory_order_relaxed);
+}
+
+std::string ppc::core::used_variants() {
+  auto &log = variant_log();
+  std::lock_guard<std::mutex> lock(log.mutex);
+  return log.used_report;
+}
+
+void ppc::core::note_used_variant(const std::string &kernel, IsaLevel level) {
+  auto &log = variant_log();
+  std::lock_guard<std::mutex> lock(log.mutex);
+  // threads calling a kernel at the same time may both note it
+  if (std::find(log.used_kernels.begin(), log.used_kernels.end(), kernel) != log.used_kernels.end()) return;
+  log.used_kernels.push_back(kernel);
+  log.used_report += (log.used_report.empty() ? "" : ";") + kernel + "=" + to_string(level);
+}
@@ -0,0 +1,16 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "core/fibonacci/include/fibonacci.hpp"
+
+TEST(fibonacci_tests, check_fib_sequential) {
+  const std::vector<int64_t> expected = {0, 1, 1, 2, 3, 5, 8, 13, 21, 34, 55};
+  for (int n = 0; n < static_cast<int>(expected.size()); n++) {
+    EXPECT_EQ(ppc::core::fib_sequential(n), expected[n]);
+  }
+  static_assert(ppc::core::fib_sequential(20) == 6765);
+  EXPECT_EQ(ppc::core::fib_sequential(30), 832040);
+}
@@ -0,0 +1,21 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_FIBONACCI_HPP_
+#define MODULES_CORE_INCLUDE_FIBONACCI_HPP_
+
+#include <cstdint>
+
+namespace ppc::core {
+
+// fib(92) is the largest value fitting into int64_t
+constexpr int fib_max_argument = 92;
+
+// Plain recursive fib(n), the leaves of the parallel fibonacci tasks of every backend
+constexpr int64_t fib_sequential(int n) {
+  if (n < 2) return n;
+  return fib_sequential(n - 1) + fib_sequential(n - 2);
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_FIBONACCI_HPP_
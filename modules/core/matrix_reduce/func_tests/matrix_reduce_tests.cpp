@@ -0,0 +1,174 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "core/matrix_reduce/include/matrix_reduce.hpp"
+
+namespace {
+
+using ppc::core::MatrixAxis;
+using ppc::core::MatrixView;
+
+// element values are exact in every type, so sums do not depend on the order
+int64_t element(std::size_t i, std::size_t j) { return static_cast<int64_t>((i * 7 + j * 3) % 11) - 5; }
+
+// rows x cols matrix stored with the leading dimension ld, padding is filled with garbage
+template <class T>
+std::vector<T> make_matrix(std::size_t rows, std::size_t cols, std::size_t ld, bool col_major) {
+  const std::size_t lines = col_major ? cols : rows;
+  std::vector<T> data(lines * ld, static_cast<T>(1000));
+  for (std::size_t i = 0; i < rows; i++) {
+    for (std::size_t j = 0; j < cols; j++) {
+      data[col_major ? j * ld + i : i * ld + j] = static_cast<T>(element(i, j));
+    }
+  }
+  return data;
+}
+
+template <class T>
+std::vector<T> expected_sums(std::size_t rows, std::size_t cols, MatrixAxis axis) {
+  std::vector<T> sums(axis == MatrixAxis::ROWS ? rows : cols, T{});
+  for (std::size_t i = 0; i < rows; i++) {
+    for (std::size_t j = 0; j < cols; j++) {
+      sums[axis == MatrixAxis::ROWS ? i : j] += static_cast<T>(element(i, j));
+    }
+  }
+  return sums;
+}
+
+// parts of the split are executed one after another
+template <class T>
+std::vector<T> split_sums(const MatrixView<T> &view, MatrixAxis axis, std::size_t parts) {
+  ppc::core::MatrixSums<T> sums(view, axis, parts);
+  std::vector<T> out(sums.size());
+  for (std::size_t part = 0; part < sums.parts(); part++) sums.run(part, out.data());
+  sums.finish(out.data());
+  return out;
+}
+
+template <class T>
+void check_shapes() {
+  const std::size_t shapes[][2] = {{1, 1}, {3, 5000}, {5000, 3}, {37, 38}, {1500, 70}, {2, 2100}};
+  for (const auto &shape : shapes) {
+    const std::size_t rows = shape[0];
+    const std::size_t cols = shape[1];
+    for (bool col_major : {false, true}) {
+      const std::size_t ld = (col_major ? rows : cols) + 3;
+      auto data = make_matrix<T>(rows, cols, ld, col_major);
+      auto view = col_major ? MatrixView<T>::col_major(data.data(), rows, cols, ld)
+                            : MatrixView<T>::row_major(data.data(), rows, cols, ld);
+      for (auto axis : {MatrixAxis::ROWS, MatrixAxis::COLS}) {
+        auto expected = expected_sums<T>(rows, cols, axis);
+        for (std::size_t parts : {1, 3, 8}) {
+          EXPECT_EQ(split_sums(view, axis, parts), expected) << rows << "x" << cols << " parts " << parts;
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TEST(matrix_reduce_tests, check_view_strides) {
+  std::vector<int> data(12);
+  auto row_major = MatrixView<int>::row_major(data.data(), 3, 2, 4);
+  EXPECT_EQ(&row_major(2, 1), &data[9]);
+  EXPECT_EQ(row_major.extent(), 10U);
+  auto col_major = MatrixView<int>::col_major(data.data(), 3, 2);
+  EXPECT_EQ(&col_major(2, 1), &data[5]);
+  EXPECT_EQ(col_major.extent(), 6U);
+  auto transposed = col_major.transposed();
+  EXPECT_EQ(&transposed(1, 2), &col_major(2, 1));
+  EXPECT_EQ(MatrixView<int>::row_major(data.data(), 0, 5).extent(), 0U);
+}
+
+TEST(matrix_reduce_tests, check_int_layouts) { check_shapes<int>(); }
+
+TEST(matrix_reduce_tests, check_double_layouts) { check_shapes<double>(); }
+
+TEST(matrix_reduce_tests, check_float_layouts) { check_shapes<float>(); }
+
+TEST(matrix_reduce_tests, check_general_strides) {
+  // every second row and every third column of a 10 x 12 matrix
+  std::vector<int64_t> data(120);
+  for (std::size_t k = 0; k < data.size(); k++) data[k] = static_cast<int64_t>(k);
+  MatrixView<int64_t> view{data.data(), 5, 4, 24, 3};
+  std::vector<int64_t> rows(5);
+  std::vector<int64_t> cols(4);
+  ppc::core::matrix_sums(view, MatrixAxis::ROWS, rows.data());
+  ppc::core::matrix_sums(view, MatrixAxis::COLS, cols.data());
+  for (std::size_t i = 0; i < 5; i++) {
+    EXPECT_EQ(rows[i], static_cast<int64_t>(4 * 24 * i + 18));
+  }
+  for (std::size_t j = 0; j < 4; j++) {
+    EXPECT_EQ(cols[j], static_cast<int64_t>(5 * 3 * j + 240));
+  }
+}
+
+TEST(matrix_reduce_tests, check_split_of_long_rows) {
+  // too few sums for 4 parts, every part reduces a chunk of each row
+  ppc::core::MatrixSums<double> sums(MatrixView<double>::row_major(nullptr, 3, 1000), MatrixAxis::ROWS, 4);
+  EXPECT_EQ(sums.parts(), 4U);
+  // enough sums, each part owns 64 of them at least
+  ppc::core::MatrixSums<double> many(MatrixView<double>::row_major(nullptr, 1000, 3), MatrixAxis::ROWS, 4);
+  EXPECT_EQ(many.parts(), 4U);
+  ppc::core::MatrixSums<double> single(MatrixView<double>::row_major(nullptr, 3, 1000), MatrixAxis::ROWS, 1);
+  EXPECT_EQ(single.parts(), 1U);
+}
+
+TEST(matrix_reduce_tests, check_thread_pool_sums) {
+  ppc::core::ThreadPool pool(3);
+  const std::size_t rows = 4;
+  const std::size_t cols = 100000;
+  auto data = make_matrix<int>(rows, cols, cols, false);
+  auto view = MatrixView<int>::row_major(data.data(), rows, cols);
+  std::vector<int> row_sums(rows);
+  std::vector<int> col_sums(cols);
+  ppc::core::matrix_sums(pool, view, MatrixAxis::ROWS, row_sums.data());
+  ppc::core::matrix_sums(pool, view, MatrixAxis::COLS, col_sums.data());
+  EXPECT_EQ(row_sums, expected_sums<int>(rows, cols, MatrixAxis::ROWS));
+  EXPECT_EQ(col_sums, expected_sums<int>(rows, cols, MatrixAxis::COLS));
+}
+
+TEST(matrix_reduce_tests, check_task_shape) {
+  std::vector<double> in(20);
+  std::vector<uint64_t> shape = {3, 4, 1, 5};
+  std::vector<double> out(4);
+  ppc::core::TaskData taskData;
+  taskData.add_input(in);
+  taskData.add_input(shape);
+  taskData.add_output(out);
+  // column-major 3 x 4 with leading dimension 5 spans 18 elements
+  EXPECT_TRUE(ppc::core::check_matrix_task<uint64_t>(taskData, MatrixAxis::COLS));
+  EXPECT_FALSE(ppc::core::check_matrix_task<uint64_t>(taskData, MatrixAxis::ROWS));
+  auto view = ppc::core::matrix_input<double, uint64_t>(taskData);
+  EXPECT_EQ(view.row_stride, 1U);
+  EXPECT_EQ(view.col_stride, 5U);
+
+  // leading dimension is shorter than a column
+  shape[3] = 2;
+  EXPECT_FALSE(ppc::core::check_matrix_task<uint64_t>(taskData, MatrixAxis::COLS));
+  // unknown layout
+  shape[3] = 5;
+  shape[2] = 2;
+  EXPECT_FALSE(ppc::core::check_matrix_task<uint64_t>(taskData, MatrixAxis::COLS));
+  // input is shorter than the matrix
+  shape = {3, 4, 0, 9};
+  taskData.inputs[1] = reinterpret_cast<uint8_t *>(shape.data());
+  EXPECT_FALSE(ppc::core::check_matrix_task<uint64_t>(taskData, MatrixAxis::COLS));
+}
+
+TEST(matrix_reduce_tests, check_task_shape_above_32_bit_counts) {
+  // validation reads the shape only, the descriptor may claim more elements than in holds
+  std::vector<double> in(1);
+  std::vector<uint64_t> shape = {2, 3000000000ULL};
+  std::vector<double> out(2);
+  ppc::core::TaskData taskData;
+  taskData.add_input(ppc::core::Buffer::borrow(in.data(), 6000000000ULL));
+  taskData.add_input(shape);
+  taskData.add_output(out);
+  EXPECT_EQ(taskData.inputs_count[0], UINT32_MAX);
+  EXPECT_TRUE(ppc::core::check_matrix_task<uint64_t>(taskData, MatrixAxis::ROWS));
+}
@@ -0,0 +1,87 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_TESTS_MATRIX_SUMS_TASK_TESTS_HPP_
+#define MODULES_CORE_TESTS_MATRIX_SUMS_TASK_TESTS_HPP_
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/sum_values_by_cols_matrix/include/ref_task.hpp"
+#include "ref/sum_values_by_rows_matrix/include/ref_task.hpp"
+
+// Cases shared by the matrix sums tasks of the omp, tbb and stl backends,
+// every backend runs them on its own task classes.
+namespace ppc::test::matrix_sums {
+
+// integer values keep the sums exact in any order of additions
+inline std::vector<double> random_matrix(std::size_t size) {
+  std::mt19937 gen(static_cast<unsigned>(size));
+  std::uniform_int_distribution<int> dist(-100, 100);
+  std::vector<double> vec(size);
+  for (auto &value : vec) value = dist(gen);
+  return vec;
+}
+
+template <class Task>
+std::vector<double> run_task(std::vector<double> &in, std::vector<uint64_t> shape, std::size_t sums) {
+  std::vector<double> out(sums);
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_input(shape);
+  taskData->add_output(out);
+  Task task(taskData);
+  EXPECT_TRUE(task.validation());
+  task.pre_processing();
+  task.run();
+  task.post_processing();
+  return out;
+}
+
+template <class ByRows, class ByCols>
+void check_sums_match_reference() {
+  // wide and short, tall and skinny, a few sums per thread
+  const std::size_t shapes[][2] = {{1, 1}, {2, 50000}, {50000, 2}, {37, 38}, {300, 301}};
+  for (const auto &shape : shapes) {
+    const uint64_t rows = shape[0];
+    const uint64_t cols = shape[1];
+    for (uint64_t layout : {0, 1}) {
+      const uint64_t ld = (layout == 0 ? cols : rows) + 5;
+      auto in = random_matrix((layout == 0 ? rows : cols) * ld);
+      const std::vector<uint64_t> index = {rows, cols, layout, ld};
+      EXPECT_EQ(run_task<ByRows>(in, index, rows),
+                (run_task<ppc::reference::SumValuesByRowsMatrix<double, uint64_t>>(in, index, rows)));
+      EXPECT_EQ(run_task<ByCols>(in, index, cols),
+                (run_task<ppc::reference::SumValuesByColsMatrix<double, uint64_t>>(in, index, cols)));
+    }
+  }
+}
+
+template <class ByRows, class ByCols>
+void check_dense_row_major_shape() {
+  std::vector<double> in(1406, 1.0);
+  EXPECT_EQ(run_task<ByRows>(in, {37, 38}, 37), std::vector<double>(37, 38.0));
+  EXPECT_EQ(run_task<ByCols>(in, {37, 38}, 38), std::vector<double>(38, 37.0));
+}
+
+template <class ByRows>
+void check_validation() {
+  std::vector<double> in(1406, 1.0);
+  std::vector<uint64_t> shape = {37, 38};
+  std::vector<double> out(38);
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_input(shape);
+  taskData->add_output(out);
+  // one sum per row is expected
+  ByRows task(taskData);
+  EXPECT_FALSE(task.validation());
+}
+
+}  // namespace ppc::test::matrix_sums
+
+#endif  // MODULES_CORE_TESTS_MATRIX_SUMS_TASK_TESTS_HPP_
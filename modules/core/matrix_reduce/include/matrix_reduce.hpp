@@ -0,0 +1,267 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_MATRIX_REDUCE_HPP_
+#define MODULES_CORE_INCLUDE_MATRIX_REDUCE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "core/arena/include/arena.hpp"
+#include "core/simd/include/simd.hpp"
+#include "core/task/include/task.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace ppc::core {
+
+enum class MatrixLayout : std::uint64_t { ROW_MAJOR = 0, COL_MAJOR = 1 };
+
+// ROWS - one sum per row, COLS - one sum per column
+enum class MatrixAxis { ROWS, COLS };
+
+// Matrix in place, element (i, j) is data[i * row_stride + j * col_stride].
+// Row-major with leading dimension ld has strides (ld, 1), column-major (1, ld).
+template <class T>
+struct MatrixView {
+  const T *data = nullptr;
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  std::size_t row_stride = 0;
+  std::size_t col_stride = 0;
+
+  // ld of 0 means the dense matrix
+  static MatrixView row_major(const T *data, std::size_t rows, std::size_t cols, std::size_t ld = 0) {
+    return {data, rows, cols, ld != 0 ? ld : cols, 1};
+  }
+  static MatrixView col_major(const T *data, std::size_t rows, std::size_t cols, std::size_t ld = 0) {
+    return {data, rows, cols, 1, ld != 0 ? ld : rows};
+  }
+
+  const T &operator()(std::size_t i, std::size_t j) const { return data[i * row_stride + j * col_stride]; }
+
+  // same elements, rows and columns swapped
+  [[nodiscard]] MatrixView transposed() const { return {data, cols, rows, col_stride, row_stride}; }
+
+  // count of elements from the first one to the last one
+  [[nodiscard]] std::size_t extent() const {
+    if (rows == 0 || cols == 0) return 0;
+    return (rows - 1) * row_stride + (cols - 1) * col_stride + 1;
+  }
+};
+
+namespace detail {
+
+// rows accumulated by one pass over a block of sums, the block stays in L1
+inline constexpr std::size_t matrix_block_size = 1024;
+// shorter rows are summed without the vector kernels
+inline constexpr std::size_t matrix_short_row = 16;
+
+// dst[i - row_begin] = sum of (i, j) for j in [col_begin, col_end), i in [row_begin, row_end)
+template <class T>
+void sum_rows_block(const MatrixView<T> &m, std::size_t row_begin, std::size_t row_end, std::size_t col_begin,
+                    std::size_t col_end, T *dst) {
+  const std::size_t length = col_end - col_begin;
+  if (m.col_stride == 1) {
+    // rows are contiguous, every sum is a vector reduction
+    for (std::size_t i = row_begin; i < row_end; i++) {
+      const T *row = &m(i, col_begin);
+      if (length < matrix_short_row) {
+        T sum{};
+        for (std::size_t j = 0; j < length; j++) sum += row[j];
+        dst[i - row_begin] = sum;
+      } else {
+        dst[i - row_begin] = simd::sum(row, length);
+      }
+    }
+    return;
+  }
+  if (m.row_stride == 1) {
+    // columns are contiguous, a block of sums is accumulated with vertical
+    // adds of four columns at once, so the sums are loaded and stored once per four columns
+    for (std::size_t block = row_begin; block < row_end; block += matrix_block_size) {
+      const std::size_t block_end = std::min(block + matrix_block_size, row_end);
+      T *out = dst + (block - row_begin);
+      const std::size_t count = block_end - block;
+      std::fill(out, out + count, T{});
+      std::size_t j = col_begin;
+      for (; j + 4 <= col_end; j += 4) {
+        const T *c0 = &m(block, j);
+        const T *c1 = c0 + m.col_stride;
+        const T *c2 = c1 + m.col_stride;
+        const T *c3 = c2 + m.col_stride;
+        for (std::size_t k = 0; k < count; k++) out[k] += (c0[k] + c1[k]) + (c2[k] + c3[k]);
+      }
+      for (; j < col_end; j++) {
+        const T *c = &m(block, j);
+        for (std::size_t k = 0; k < count; k++) out[k] += c[k];
+      }
+    }
+    return;
+  }
+  for (std::size_t i = row_begin; i < row_end; i++) {
+    T sum{};
+    for (std::size_t j = col_begin; j < col_end; j++) sum += m(i, j);
+    dst[i - row_begin] = sum;
+  }
+}
+
+// Private results of parts, row of each part starts on its own cache line.
+// Rows come from the arena when one is given and are left uninitialized,
+// so every part touches (and places) its own row first.
+template <class T>
+class PartialRows {
+ public:
+  PartialRows() = default;
+  PartialRows(const PartialRows &) = delete;
+  PartialRows &operator=(const PartialRows &) = delete;
+
+  void allocate(std::size_t parts, std::size_t count, Arena *scratch) {
+    const std::size_t per_line = std::max<std::size_t>(cache_line_size / sizeof(T), 1);
+    parts_ = parts;
+    count_ = count;
+    stride_ = (count + per_line - 1) / per_line * per_line;
+    if (scratch != nullptr) {
+      data_ = scratch->allocate_uninitialized<T>(parts * stride_).data();
+    } else {
+      owned_.resize(parts * stride_);
+      data_ = owned_.data();
+    }
+  }
+
+  [[nodiscard]] bool empty() const { return parts_ == 0; }
+  T *operator[](std::size_t part) const { return data_ + part * stride_; }
+
+  // out = sum of the rows in order of parts
+  void combine(T *out) const {
+    std::copy((*this)[0], (*this)[0] + count_, out);
+    for (std::size_t part = 1; part < parts_; part++) {
+      const T *row = (*this)[part];
+      for (std::size_t i = 0; i < count_; i++) out[i] += row[i];
+    }
+  }
+
+ private:
+  T *data_ = nullptr;
+  std::size_t parts_ = 0;
+  std::size_t count_ = 0;
+  std::size_t stride_ = 0;
+  std::vector<T> owned_;
+};
+
+}  // namespace detail
+
+// Row or column sums split into independent parts for parallel execution:
+//   MatrixSums<T> sums(view, axis, parts);
+//   run(part, out) for every part, concurrently
+//   finish(out)    after all parts
+// Sums are split between parts when there are enough of them. Otherwise
+// (a few long rows) parts reduce chunks of every row into private partials
+// combined by finish() in order of parts. Column sums are row sums of the
+// transposed view, neither layout is transposed in memory. Partials are
+// taken from the scratch arena when one is given.
+template <class T>
+class MatrixSums {
+ public:
+  // every part gets at least that many sums before the rows are split
+  static constexpr std::size_t min_sums_per_part = 64;
+
+  MatrixSums(const MatrixView<T> &view, MatrixAxis axis, std::size_t parts, Arena *scratch = nullptr)
+      : view_(axis == MatrixAxis::ROWS ? view : view.transposed()) {
+    parts = std::max<std::size_t>(parts, 1);
+    if (parts == 1 || view_.rows >= parts * min_sums_per_part || view_.cols < parts) {
+      parts_ = std::max<std::size_t>(std::min(parts, view_.rows), 1);
+    } else {
+      parts_ = parts;
+      partials_.allocate(parts_, view_.rows, scratch);
+    }
+  }
+
+  // count of sums
+  [[nodiscard]] std::size_t size() const { return view_.rows; }
+  [[nodiscard]] std::size_t parts() const { return parts_; }
+
+  // out holds size() sums
+  void run(std::size_t part, T *out) {
+    if (partials_.empty()) {
+      auto [begin, end] = balanced_chunk(0, view_.rows, parts_, part);
+      detail::sum_rows_block(view_, begin, end, 0, view_.cols, out + begin);
+    } else {
+      auto [begin, end] = balanced_chunk(0, view_.cols, parts_, part);
+      detail::sum_rows_block(view_, 0, view_.rows, begin, end, partials_[part]);
+    }
+  }
+
+  void finish(T *out) const {
+    if (!partials_.empty()) partials_.combine(out);
+  }
+
+ private:
+  MatrixView<T> view_;
+  std::size_t parts_ = 1;
+  detail::PartialRows<T> partials_;
+};
+
+// sequential sums
+template <class T>
+void matrix_sums(const MatrixView<T> &view, MatrixAxis axis, T *out) {
+  MatrixSums<T> sums(view, axis, 1);
+  sums.run(0, out);
+  sums.finish(out);
+}
+
+// sums on the pool threads
+template <class T>
+void matrix_sums(ThreadPool &pool, const MatrixView<T> &view, MatrixAxis axis, T *out, Arena *scratch = nullptr) {
+  MatrixSums<T> sums(view, axis, static_cast<std::size_t>(pool.size()), scratch);
+  pool.run([&](int thread_index) {
+    const auto part = static_cast<std::size_t>(thread_index);
+    if (part < sums.parts()) sums.run(part, out);
+  });
+  sums.finish(out);
+}
+
+// Matrix of TaskData: inputs[0] - elements, inputs[1] - shape {rows, cols} or
+// {rows, cols, layout, leading dimension} with layout 0 for row-major and 1 for
+// column-major, leading dimension 0 for the dense matrix. outputs[0] holds the sums.
+template <class IndexType>
+bool check_matrix_task(const TaskData &taskData, MatrixAxis axis) {
+  if (taskData.inputs.size() != 2 || taskData.outputs.size() != 1) return false;
+  const auto shape_count = taskData.inputs_count[1];
+  if (shape_count != 2 && shape_count != 4) return false;
+  const auto *shape = reinterpret_cast<const IndexType *>(taskData.inputs[1]);
+  const auto rows = static_cast<std::size_t>(shape[0]);
+  const auto cols = static_cast<std::size_t>(shape[1]);
+  std::size_t ld = 0;
+  auto layout = MatrixLayout::ROW_MAJOR;
+  if (shape_count == 4) {
+    if (static_cast<std::uint64_t>(shape[2]) > static_cast<std::uint64_t>(MatrixLayout::COL_MAJOR)) return false;
+    layout = static_cast<MatrixLayout>(shape[2]);
+    ld = static_cast<std::size_t>(shape[3]);
+    if (ld != 0 && ld < (layout == MatrixLayout::ROW_MAJOR ? cols : rows)) return false;
+  }
+  auto view = layout == MatrixLayout::ROW_MAJOR ? MatrixView<std::uint8_t>::row_major(nullptr, rows, cols, ld)
+                                                : MatrixView<std::uint8_t>::col_major(nullptr, rows, cols, ld);
+  // 64-bit counts of the buffers, inputs_count saturates for more than UINT32_MAX elements
+  return taskData.input_buffer(0).count >= view.extent() &&
+         taskData.output_buffer(0).count == (axis == MatrixAxis::ROWS ? rows : cols);
+}
+
+// view of the matrix checked by check_matrix_task()
+template <class T, class IndexType>
+MatrixView<T> matrix_input(const TaskData &taskData) {
+  const auto *shape = reinterpret_cast<const IndexType *>(taskData.inputs[1]);
+  const auto rows = static_cast<std::size_t>(shape[0]);
+  const auto cols = static_cast<std::size_t>(shape[1]);
+  const T *data = taskData.input_view<T>(0).data();
+  if (taskData.inputs_count[1] == 4 && static_cast<MatrixLayout>(shape[2]) == MatrixLayout::COL_MAJOR) {
+    return MatrixView<T>::col_major(data, rows, cols, static_cast<std::size_t>(shape[3]));
+  }
+  const auto ld = taskData.inputs_count[1] == 4 ? static_cast<std::size_t>(shape[3]) : 0;
+  return MatrixView<T>::row_major(data, rows, cols, ld);
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_MATRIX_REDUCE_HPP_
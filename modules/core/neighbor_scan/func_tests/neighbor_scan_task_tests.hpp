@@ -0,0 +1,137 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_TESTS_NEIGHBOR_SCAN_TASK_TESTS_HPP_
+#define MODULES_CORE_TESTS_NEIGHBOR_SCAN_TASK_TESTS_HPP_
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "core/numa/include/numa.hpp"
+#include "core/task/include/task.hpp"
+#include "ref/most_different_neighbor_elements/include/ref_task.hpp"
+#include "ref/nearest_neighbor_elements/include/ref_task.hpp"
+#include "ref/num_of_alternations_signs/include/ref_task.hpp"
+#include "ref/num_of_orderly_violations/include/ref_task.hpp"
+
+// Cases shared by the neighbor scan tasks of the omp, tbb and stl backends,
+// every backend runs them on its own task classes.
+namespace ppc::test::neighbor_scan {
+
+inline std::vector<int> random_vector(std::size_t size) {
+  std::mt19937 gen(static_cast<unsigned>(size));
+  std::uniform_int_distribution<int> dist(-1000, 1000);
+  std::vector<int> vec(size);
+  for (auto &value : vec) value = dist(gen);
+  return vec;
+}
+
+template <class Task>
+bool run_task(std::shared_ptr<ppc::core::TaskData> taskData) {
+  Task task(taskData);
+  if (!task.validation()) return false;
+  task.pre_processing();
+  task.run();
+  task.post_processing();
+  return true;
+}
+
+// elements and indexes of the found pair
+template <class Task>
+std::pair<std::vector<int>, std::vector<uint64_t>> run_pair_task(std::vector<int> &in) {
+  std::vector<int> pair(2);
+  std::vector<uint64_t> index(2);
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_output(pair);
+  taskData->add_output(index);
+  EXPECT_TRUE(run_task<Task>(taskData));
+  return {pair, index};
+}
+
+template <class Task>
+uint64_t run_count_task(std::vector<int> &in) {
+  std::vector<uint64_t> count(1);
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_output(count);
+  EXPECT_TRUE(run_task<Task>(taskData));
+  return count[0];
+}
+
+template <class Nearest, class MostDifferent>
+void check_pairs_match_reference() {
+  // sizes smaller than, equal to and above the number of threads
+  for (std::size_t size : {2, 3, 5, 1000, 100003}) {
+    auto in = random_vector(size);
+    EXPECT_EQ(run_pair_task<Nearest>(in), (run_pair_task<ppc::reference::NearestNeighborElements<int, uint64_t>>(in)));
+    EXPECT_EQ(run_pair_task<MostDifferent>(in),
+              (run_pair_task<ppc::reference::MostDifferentNeighborElements<int, uint64_t>>(in)));
+  }
+}
+
+template <class Violations, class Alternations>
+void check_counts_match_reference() {
+  for (std::size_t size : {1, 2, 7, 1000, 100003}) {
+    auto in = random_vector(size);
+    EXPECT_EQ(run_count_task<Violations>(in),
+              (run_count_task<ppc::reference::NumOfOrderlyViolations<int, uint64_t>>(in)));
+    EXPECT_EQ(run_count_task<Alternations>(in),
+              (run_count_task<ppc::reference::NumOfAlternationsSigns<int, uint64_t>>(in)));
+  }
+}
+
+template <class Nearest, class Alternations>
+void check_pair_on_chunk_boundary() {
+  // the nearest pair and the only alternation straddle the middle of the vector
+  std::vector<int> in(1000);
+  for (std::size_t i = 0; i < in.size(); i++) in[i] = 3 * static_cast<int>(i);
+  in[500] = in[499] + 1;
+  EXPECT_EQ(run_pair_task<Nearest>(in).second, (std::vector<uint64_t>{499, 500}));
+
+  for (std::size_t i = 0; i < in.size(); i++) in[i] = i < 500 ? 1 : -1;
+  EXPECT_EQ(run_count_task<Alternations>(in), 1U);
+}
+
+template <class Nearest>
+void check_validation() {
+  // a single element has no neighbors
+  std::vector<int> in(1, 5);
+  std::vector<int> pair(2);
+  std::vector<uint64_t> index(2);
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_output(pair);
+  taskData->add_output(index);
+  EXPECT_FALSE(run_task<Nearest>(taskData));
+}
+
+template <class Violations>
+void check_first_touch_matches_in_place() {
+  for (std::size_t size : {1, 2, 1000, 100003}) {
+    auto in = random_vector(size);
+    std::vector<uint64_t> counts;
+    for (auto placement : {ppc::core::InputPlacement::IN_PLACE, ppc::core::InputPlacement::FIRST_TOUCH}) {
+      std::vector<uint64_t> count(1);
+      auto taskData = std::make_shared<ppc::core::TaskData>();
+      taskData->add_input(in);
+      taskData->add_output(count);
+      Violations task(taskData, placement);
+      ASSERT_TRUE(task.validation());
+      task.pre_processing();
+      task.run();
+      task.post_processing();
+      counts.push_back(count[0]);
+    }
+    EXPECT_EQ(counts[0], counts[1]);
+    EXPECT_EQ(counts[1], (run_count_task<ppc::reference::NumOfOrderlyViolations<int, uint64_t>>(in)));
+  }
+}
+
+}  // namespace ppc::test::neighbor_scan
+
+#endif  // MODULES_CORE_TESTS_NEIGHBOR_SCAN_TASK_TESTS_HPP_
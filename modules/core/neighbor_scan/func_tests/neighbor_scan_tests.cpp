@@ -0,0 +1,84 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "core/neighbor_scan/include/neighbor_scan.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+std::vector<int> random_vector(std::size_t size) {
+  std::mt19937 gen(12345);
+  std::uniform_int_distribution<int> dist(-50, 50);
+  std::vector<int> vec(size);
+  for (auto &value : vec) value = dist(gen);
+  return vec;
+}
+
+// pairs split into parts chunks, results merged in the given order
+template <class Kernel>
+typename Kernel::Result scan_in_chunks(const std::vector<int> &vec, std::size_t parts, bool reversed) {
+  const std::size_t pairs = vec.size() - 1;
+  auto result = Kernel::identity();
+  for (std::size_t k = 0; k < parts; k++) {
+    const std::size_t index = reversed ? parts - 1 - k : k;
+    auto [begin, end] = ppc::core::balanced_chunk(0, pairs, parts, index);
+    auto chunk = Kernel::scan(vec.data(), begin, end);
+    result = reversed ? Kernel::combine(chunk, result) : Kernel::combine(result, chunk);
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(neighbor_scan_tests, check_extreme_pairs_by_chunks) {
+  using Nearest = ppc::core::NearestPair<int, uint64_t>;
+  using MostDifferent = ppc::core::MostDifferentPair<int, uint64_t>;
+  auto vec = random_vector(1001);
+  auto nearest = ppc::core::scan_neighbors<Nearest>(vec.data(), vec.size());
+  auto most_different = ppc::core::scan_neighbors<MostDifferent>(vec.data(), vec.size());
+
+  for (std::size_t parts : {1, 2, 3, 7, 64, 1000}) {
+    for (bool reversed : {false, true}) {
+      auto chunked_nearest = scan_in_chunks<Nearest>(vec, parts, reversed);
+      EXPECT_EQ(chunked_nearest.index, nearest.index);
+      EXPECT_EQ(chunked_nearest.distance, nearest.distance);
+      auto chunked_most_different = scan_in_chunks<MostDifferent>(vec, parts, reversed);
+      EXPECT_EQ(chunked_most_different.index, most_different.index);
+      EXPECT_EQ(chunked_most_different.distance, most_different.distance);
+    }
+  }
+}
+
+TEST(neighbor_scan_tests, check_pair_counts_by_chunks) {
+  using Violations = ppc::core::OrderViolationCount<int, uint64_t>;
+  using Alternations = ppc::core::SignAlternationCount<int, uint64_t>;
+  auto vec = random_vector(777);
+  uint64_t violations = 0;
+  uint64_t alternations = 0;
+  for (std::size_t i = 0; i + 1 < vec.size(); i++) {
+    violations += vec[i] > vec[i + 1] ? 1 : 0;
+    alternations += static_cast<int64_t>(vec[i]) * vec[i + 1] < 0 ? 1 : 0;
+  }
+  EXPECT_EQ((ppc::core::scan_neighbors<Violations>(vec.data(), vec.size())), violations);
+  EXPECT_EQ((ppc::core::scan_neighbors<Alternations>(vec.data(), vec.size())), alternations);
+  for (std::size_t parts : {2, 5, 776}) {
+    EXPECT_EQ(scan_in_chunks<Violations>(vec, parts, false), violations);
+    EXPECT_EQ(scan_in_chunks<Alternations>(vec, parts, false), alternations);
+  }
+}
+
+TEST(neighbor_scan_tests, check_distance_of_narrow_types) {
+  EXPECT_EQ(ppc::core::neighbor_distance<uint32_t>(3, 10), 7U);
+  EXPECT_EQ(ppc::core::neighbor_distance<uint32_t>(10, 3), 7U);
+  EXPECT_EQ(ppc::core::neighbor_distance<int8_t>(-20, 30), 50);
+  // wider than the signed type
+  EXPECT_EQ(ppc::core::neighbor_distance<int8_t>(127, -128), 255);
+  // single element has no pairs
+  std::vector<int> one(1, 5);
+  EXPECT_EQ((ppc::core::scan_neighbors<ppc::core::SignAlternationCount<int, uint64_t>>(one.data(), one.size())), 0U);
+  EXPECT_FALSE((ppc::core::scan_neighbors<ppc::core::NearestPair<int, uint64_t>>(one.data(), one.size()).found));
+}
@@ -0,0 +1,135 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_NEIGHBOR_SCAN_HPP_
+#define MODULES_CORE_INCLUDE_NEIGHBOR_SCAN_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "core/simd/include/simd.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+// Kernels over adjacent pairs (data[i], data[i + 1]) of a vector.
+//   scan(data, begin, end) - result for pairs starting at [begin, end), reads data[end]
+//   combine(left, right)   - merges results of consecutive pair ranges
+//   identity()             - result of an empty range
+// Chunks of pairs share only the boundary element, so the input is split
+// between threads without copies. Kernels also describe the task outputs.
+
+// |a - b|, integers give it in the unsigned type of the same width, so far apart values do not overflow
+template <class T>
+simd::distance_type<T> neighbor_distance(T a, T b) {
+  return simd::ScalarKernels<T>::distance(a, b);
+}
+
+// first pair with the smallest or the largest distance between elements,
+// outputs: both elements, both indexes
+template <class T, class IndexType, bool Smallest>
+struct ExtremePair {
+  using Distance = simd::distance_type<T>;
+
+  struct Result {
+    Distance distance;
+    std::size_t index;
+    bool found;
+  };
+
+  static Result identity() { return {Distance{}, 0, false}; }
+
+  static bool better(Distance distance, Distance best) { return Smallest ? distance < best : best < distance; }
+
+  static Result scan(const T *data, std::size_t begin, std::size_t end) {
+    if (begin >= end) return identity();
+    // vector kernels for float, double and int32_t
+    const auto best = Smallest ? simd::nearest_pair(data + begin, end - begin + 1)
+                               : simd::most_different_pair(data + begin, end - begin + 1);
+    return {best.value, begin + best.index, true};
+  }
+
+  // ties go to the smaller index, so the order of merging does not matter
+  static Result combine(const Result &left, const Result &right) {
+    if (!left.found) return right;
+    if (!right.found) return left;
+    if (better(right.distance, left.distance)) return right;
+    if (better(left.distance, right.distance)) return left;
+    return right.index < left.index ? right : left;
+  }
+
+  static bool check(const TaskData &taskData) {
+    return !taskData.inputs_count.empty() && taskData.inputs_count[0] >= 2 && taskData.outputs_count.size() >= 2 &&
+           taskData.outputs_count[0] == 2 && taskData.outputs_count[1] == 2;
+  }
+
+  static void store(TaskData &taskData, const T *data, const Result &result) {
+    reinterpret_cast<T *>(taskData.outputs[0])[0] = data[result.index];
+    reinterpret_cast<T *>(taskData.outputs[0])[1] = data[result.index + 1];
+    reinterpret_cast<IndexType *>(taskData.outputs[1])[0] = static_cast<IndexType>(result.index);
+    reinterpret_cast<IndexType *>(taskData.outputs[1])[1] = static_cast<IndexType>(result.index + 1);
+  }
+};
+
+template <class T, class IndexType>
+using NearestPair = ExtremePair<T, IndexType, true>;
+
+template <class T, class IndexType>
+using MostDifferentPair = ExtremePair<T, IndexType, false>;
+
+// number of pairs satisfying Predicate, output: the count
+template <class T, class CountType, class Predicate>
+struct PairCount {
+  using Result = CountType;
+
+  static Result identity() { return 0; }
+
+  static Result scan(const T *data, std::size_t begin, std::size_t end) {
+    Result count = 0;
+    for (std::size_t i = begin; i < end; i++) {
+      count += static_cast<Result>(Predicate::test(data[i], data[i + 1]));
+    }
+    return count;
+  }
+
+  static Result combine(Result left, Result right) { return left + right; }
+
+  static bool check(const TaskData &taskData) {
+    return !taskData.inputs_count.empty() && taskData.inputs_count[0] >= 1 && !taskData.outputs_count.empty() &&
+           taskData.outputs_count[0] == 1;
+  }
+
+  static void store(TaskData &taskData, const T * /*data*/, const Result &result) {
+    reinterpret_cast<CountType *>(taskData.outputs[0])[0] = result;
+  }
+};
+
+struct OrderViolation {
+  template <class T>
+  static bool test(T a, T b) {
+    return a > b;
+  }
+};
+
+// zeros have no sign and never alternate
+struct SignAlternation {
+  template <class T>
+  static bool test(T a, T b) {
+    return (a < 0 && 0 < b) || (0 < a && b < 0);
+  }
+};
+
+template <class T, class CountType>
+using OrderViolationCount = PairCount<T, CountType, OrderViolation>;
+
+template <class T, class CountType>
+using SignAlternationCount = PairCount<T, CountType, SignAlternation>;
+
+// single thread scan of all pairs of size elements
+template <class Kernel, class T>
+typename Kernel::Result scan_neighbors(const T *data, std::size_t size) {
+  return size < 2 ? Kernel::identity() : Kernel::scan(data, 0, size - 1);
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_NEIGHBOR_SCAN_HPP_
@@ -0,0 +1,97 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "core/numa/include/numa.hpp"
+#include "core/numa/include/numa_buffer.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+using ppc::core::AffinityPolicy;
+
+TEST(numa_tests, check_parse_cpu_list) {
+  EXPECT_EQ(ppc::core::parse_cpu_list("0-3,8,10-11\n"), (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+  EXPECT_EQ(ppc::core::parse_cpu_list("5"), (std::vector<int>{5}));
+  EXPECT_TRUE(ppc::core::parse_cpu_list("").empty());
+}
+
+TEST(numa_tests, check_affinity_policies) {
+  // two nodes of four cpus
+  ppc::core::NumaTopology topology{{{0, 1, 2, 3}, {4, 5, 6, 7}}};
+  EXPECT_EQ(topology.cpu_count(), 8U);
+  EXPECT_EQ(topology.node_of(5), 1);
+  EXPECT_EQ(topology.node_of(9), -1);
+  EXPECT_EQ(ppc::core::thread_cpus(topology, AffinityPolicy::COMPACT, 6), (std::vector<int>{0, 1, 2, 3, 4, 5}));
+  EXPECT_EQ(ppc::core::thread_cpus(topology, AffinityPolicy::SCATTER, 6), (std::vector<int>{0, 4, 1, 5, 2, 6}));
+  // more threads than cpus wrap around
+  EXPECT_EQ(ppc::core::thread_cpu(topology, AffinityPolicy::COMPACT, 9), 1);
+  EXPECT_EQ(ppc::core::thread_cpu(topology, AffinityPolicy::SCATTER, 9), 4);
+  EXPECT_TRUE(ppc::core::thread_cpus(topology, AffinityPolicy::NONE, 4).empty());
+  EXPECT_EQ(ppc::core::thread_cpu(topology, AffinityPolicy::NONE, 1), -1);
+
+  EXPECT_EQ(ppc::core::parse_affinity_policy("scatter"), AffinityPolicy::SCATTER);
+  EXPECT_EQ(ppc::core::parse_affinity_policy("spread"), AffinityPolicy::COMPACT);
+}
+
+TEST(numa_tests, check_system_topology) {
+  const auto &topology = ppc::core::NumaTopology::system();
+  ASSERT_FALSE(topology.nodes.empty());
+  EXPECT_GE(topology.cpu_count(), 1U);
+  const int node = ppc::core::current_numa_node();
+  EXPECT_GE(node, 0);
+  EXPECT_LT(node, static_cast<int>(topology.nodes.size()));
+}
+
+TEST(numa_tests, check_first_touch_copy) {
+  ppc::core::ThreadPool pool(3, AffinityPolicy::COMPACT);
+  std::vector<int> src(100003);
+  std::iota(src.begin(), src.end(), -50);
+  ppc::core::NumaBuffer<int> buffer(src.size());
+  ppc::core::first_touch_copy(pool, src.data(), buffer);
+  EXPECT_TRUE(std::equal(src.begin(), src.end(), buffer.view().begin()));
+
+  // a smaller size keeps the memory
+  const int *data = buffer.data();
+  buffer.allocate(10);
+  EXPECT_EQ(buffer.data(), data);
+  EXPECT_EQ(buffer.size(), 10U);
+}
+
+TEST(numa_tests, check_pinned_pool_runs_jobs) {
+  for (auto policy : {AffinityPolicy::COMPACT, AffinityPolicy::SCATTER}) {
+    ppc::core::ThreadPool pool(4, policy);
+    std::atomic<int> calls = 0;
+    std::atomic<int> outside = 0;
+    pool.run([&](int) {
+      calls++;
+#if defined(__linux__)
+      // workers are pinned inside of the affinity mask of the process
+      if (ppc::core::NumaTopology::system().node_of(sched_getcpu()) < 0) outside++;
+#endif
+    });
+    EXPECT_EQ(calls, 4);
+    EXPECT_EQ(outside, 0);
+  }
+}
+
+TEST(numa_tests, check_pin_outside_of_mask) {
+  const auto &nodes = ppc::core::NumaTopology::system().nodes;
+  int last = 0;
+  for (const auto &node : nodes) last = std::max(last, *std::max_element(node.begin(), node.end()));
+  std::thread thread([&] {
+    EXPECT_FALSE(ppc::core::pin_current_thread(last + 1));
+    EXPECT_FALSE(ppc::core::pin_current_thread(-1));
+#if defined(__linux__)
+    EXPECT_TRUE(ppc::core::pin_current_thread(nodes.front().front()));
+#endif
+  });
+  thread.join();
+}
@@ -0,0 +1,70 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_NUMA_HPP_
+#define MODULES_CORE_INCLUDE_NUMA_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ppc::core {
+
+// Placement of worker threads on the cores of the NUMA nodes:
+// COMPACT fills the cores of one node before the next one (shared caches),
+// SCATTER deals threads round-robin over nodes (memory bandwidth of every node),
+// NONE leaves threads to the scheduler
+enum class AffinityPolicy { NONE, COMPACT, SCATTER };
+
+// PPC_AFFINITY: "compact" (default), "scatter" or "none".
+// PPC_PIN_THREADS=0 disables pinning regardless of it.
+AffinityPolicy affinity_policy();
+// unknown names are reported to stderr and fall back to COMPACT
+AffinityPolicy parse_affinity_policy(const std::string &name);
+
+// CPUs of the process grouped by NUMA node. Machines without NUMA
+// information are one node holding every CPU.
+struct NumaTopology {
+  std::vector<std::vector<int>> nodes;
+
+  [[nodiscard]] std::size_t cpu_count() const;
+  // node of the cpu, -1 when the cpu is not used by the process
+  [[nodiscard]] int node_of(int cpu) const;
+
+  // Detected once from /sys/devices/system/node and the affinity mask of the process
+  static const NumaTopology &system();
+};
+
+// "0-3,8,10-11" -> {0, 1, 2, 3, 8, 10, 11}
+std::vector<int> parse_cpu_list(const std::string &list);
+
+// CPU of the thread_index-th thread, -1 for NONE. More threads than CPUs wrap around.
+int thread_cpu(const NumaTopology &topology, AffinityPolicy policy, int thread_index);
+// CPUs of num_threads threads, empty for NONE
+std::vector<int> thread_cpus(const NumaTopology &topology, AffinityPolicy policy, int num_threads);
+
+// Binds the calling thread to the cpu, false when it is not supported or the
+// cpu is outside of the affinity mask the process was started with
+bool pin_current_thread(int cpu);
+
+// Pins the calling thread as thread_index of num_threads threads of a parallel
+// region by affinity_policy() (OpenMP and TBB threads). Thread 0 is the
+// calling thread of the region and stays unpinned, so threads it starts keep
+// the whole mask. Repeated calls with the same place are free.
+void bind_thread(int thread_index, int num_threads);
+
+// Node the calling thread runs on, 0 when it is unknown
+int current_numa_node();
+
+// Where tasks keep their inputs:
+// IN_PLACE    - TaskData buffers as they are, pages stay where the caller touched them
+// FIRST_TOUCH - copy made in pre_processing() by the threads that process
+//               each chunk, so pages are local to their readers
+enum class InputPlacement { IN_PLACE, FIRST_TOUCH };
+
+// PPC_FIRST_TOUCH=1 or 0 forces the placement, by default inputs are copied
+// only on machines with more than one NUMA node
+InputPlacement input_placement();
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_NUMA_HPP_
@@ -0,0 +1,67 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_NUMA_BUFFER_HPP_
+#define MODULES_CORE_INCLUDE_NUMA_BUFFER_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <span>
+
+#include "core/arena/include/arena.hpp"
+#include "core/numa/include/numa.hpp"
+#include "core/task/include/data_view.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace ppc::core {
+
+// Array whose pages are not touched on allocation. Every thread of a
+// parallel region fills its own balanced chunk with fill_part(), so the
+// pages of a chunk are placed on the node of the thread that later reads the
+// same chunk. Arrays of 2 MiB and more are backed by huge pages when
+// available, a huge page lands on the node of its first toucher as a whole.
+template <class T>
+class NumaBuffer {
+ public:
+  NumaBuffer() = default;
+  explicit NumaBuffer(std::size_t count) { allocate(count); }
+
+  // drops the elements, the memory of a buffer large enough is kept
+  void allocate(std::size_t count) {
+    if (arena_ == nullptr || count > capacity_) {
+      arena_ = std::make_unique<Arena>(count * sizeof(T) + cache_line_size);
+      data_ = arena_->allocate_uninitialized<T>(count).data();
+      capacity_ = count;
+    }
+    size_ = count;
+  }
+
+  [[nodiscard]] T *data() const { return data_; }
+  [[nodiscard]] std::size_t size() const { return size_; }
+  [[nodiscard]] std::span<T> span() const { return {data_, size_}; }
+  [[nodiscard]] DataView<const T> view() const { return {data_, size_}; }
+
+  // copies chunk index of parts balanced chunks of src, called by the thread
+  // that processes the chunk
+  void fill_part(const T *src, std::size_t parts, std::size_t index) {
+    auto [begin, end] = balanced_chunk(0, size_, parts, index);
+    std::copy(src + begin, src + end, data_ + begin);
+  }
+
+ private:
+  std::unique_ptr<Arena> arena_;
+  T *data_ = nullptr;
+  std::size_t size_ = 0;
+  std::size_t capacity_ = 0;
+};
+
+// copy of src placed by the pool threads, chunks match ThreadPool::parallel_for()
+template <class T>
+void first_touch_copy(ThreadPool &pool, const T *src, NumaBuffer<T> &buffer) {
+  const auto parts = static_cast<std::size_t>(pool.size());
+  pool.run([&](int thread_index) { buffer.fill_part(src, parts, static_cast<std::size_t>(thread_index)); });
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_NUMA_BUFFER_HPP_
@@ -0,0 +1,189 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/numa/include/numa.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// CPUs the process may run on
+std::vector<int> allowed_cpus() {
+  std::vector<int> cpus;
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+      if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+    }
+  }
+#endif
+  if (cpus.empty()) {
+    const auto count = static_cast<int>(std::max(1U, std::thread::hardware_concurrency()));
+    for (int cpu = 0; cpu < count; cpu++) cpus.push_back(cpu);
+  }
+  return cpus;
+}
+
+ppc::core::NumaTopology detect_topology() {
+  const auto allowed = allowed_cpus();
+  ppc::core::NumaTopology topology;
+  const std::filesystem::path root("/sys/devices/system/node");
+  std::error_code error;
+  // node ids may have gaps, nodes are kept in the order of their ids
+  std::vector<std::pair<int, std::vector<int>>> nodes;
+  for (const auto &entry : std::filesystem::directory_iterator(root, error)) {
+    const auto name = entry.path().filename().string();
+    if (name.rfind("node", 0) != 0 || name.size() == 4 ||
+        !std::all_of(name.begin() + 4, name.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+      continue;
+    }
+    std::ifstream file(entry.path() / "cpulist");
+    std::string list;
+    if (!std::getline(file, list)) continue;
+    std::vector<int> cpus;
+    for (int cpu : ppc::core::parse_cpu_list(list)) {
+      if (std::find(allowed.begin(), allowed.end(), cpu) != allowed.end()) cpus.push_back(cpu);
+    }
+    if (!cpus.empty()) nodes.emplace_back(std::stoi(name.substr(4)), std::move(cpus));
+  }
+  std::sort(nodes.begin(), nodes.end());
+  for (auto &node : nodes) topology.nodes.push_back(std::move(node.second));
+  if (topology.nodes.empty()) topology.nodes.push_back(allowed);
+  return topology;
+}
+
+// cpu the calling thread was pinned to by bind_thread()
+thread_local int bound_cpu = -1;
+
+}  // namespace
+
+ppc::core::AffinityPolicy ppc::core::parse_affinity_policy(const std::string &name) {
+  if (name == "none") return AffinityPolicy::NONE;
+  if (name == "compact") return AffinityPolicy::COMPACT;
+  if (name == "scatter") return AffinityPolicy::SCATTER;
+  std::cerr << "Unknown affinity policy '" << name << "', expected compact, scatter or none, using compact"
+            << std::endl;
+  return AffinityPolicy::COMPACT;
+}
+
+ppc::core::AffinityPolicy ppc::core::affinity_policy() {
+  if (!ppc::util::get_pin_threads()) return AffinityPolicy::NONE;
+  const char *value = std::getenv("PPC_AFFINITY");
+  if (value == nullptr || *value == '\0') return AffinityPolicy::COMPACT;
+  return parse_affinity_policy(value);
+}
+
+std::size_t ppc::core::NumaTopology::cpu_count() const {
+  std::size_t count = 0;
+  for (const auto &node : nodes) count += node.size();
+  return count;
+}
+
+int ppc::core::NumaTopology::node_of(int cpu) const {
+  for (std::size_t node = 0; node < nodes.size(); node++) {
+    if (std::find(nodes[node].begin(), nodes[node].end(), cpu) != nodes[node].end()) return static_cast<int>(node);
+  }
+  return -1;
+}
+
+const ppc::core::NumaTopology &ppc::core::NumaTopology::system() {
+  static const NumaTopology topology = detect_topology();
+  return topology;
+}
+
+std::vector<int> ppc::core::parse_cpu_list(const std::string &list) {
+  std::vector<int> cpus;
+  std::stringstream stream(list);
+  std::string range;
+  while (std::getline(stream, range, ',')) {
+    range.erase(std::remove_if(range.begin(), range.end(), [](char c) { return c == ' ' || c == '\n'; }),
+                range.end());
+    if (range.empty()) continue;
+    const auto dash = range.find('-');
+    const int first = std::stoi(range.substr(0, dash));
+    const int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+    for (int cpu = first; cpu <= last; cpu++) cpus.push_back(cpu);
+  }
+  return cpus;
+}
+
+int ppc::core::thread_cpu(const NumaTopology &topology, AffinityPolicy policy, int thread_index) {
+  const std::size_t count = topology.cpu_count();
+  if (policy == AffinityPolicy::NONE || count == 0) return -1;
+  if (policy == AffinityPolicy::COMPACT) {
+    auto position = static_cast<std::size_t>(thread_index) % count;
+    for (const auto &node : topology.nodes) {
+      if (position < node.size()) return node[position];
+      position -= node.size();
+    }
+  }
+  // round-robin over the nodes with cpus, every node hands out its cpus in order
+  const auto nodes = static_cast<std::size_t>(
+      std::count_if(topology.nodes.begin(), topology.nodes.end(), [](const auto &node) { return !node.empty(); }));
+  const auto index = static_cast<std::size_t>(thread_index);
+  std::size_t skip = index % nodes;
+  for (const auto &node : topology.nodes) {
+    if (node.empty()) continue;
+    if (skip-- == 0) return node[index / nodes % node.size()];
+  }
+  return -1;
+}
+
+std::vector<int> ppc::core::thread_cpus(const NumaTopology &topology, AffinityPolicy policy, int num_threads) {
+  std::vector<int> cpus;
+  if (policy == AffinityPolicy::NONE) return cpus;
+  for (int i = 0; i < num_threads; i++) cpus.push_back(thread_cpu(topology, policy, i));
+  return cpus;
+}
+
+bool ppc::core::pin_current_thread(int cpu) {
+#if defined(__linux__)
+  // cpus outside of the affinity mask of the process are never used
+  if (cpu < 0 || cpu >= CPU_SETSIZE || NumaTopology::system().node_of(cpu) < 0) return false;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+  (void)cpu;
+  return false;
+#endif
+}
+
+void ppc::core::bind_thread(int thread_index, int num_threads) {
+  if (thread_index <= 0 || thread_index >= num_threads) return;
+  static const AffinityPolicy policy = affinity_policy();
+  if (policy == AffinityPolicy::NONE) return;
+  const int cpu = thread_cpu(NumaTopology::system(), policy, thread_index);
+  if (cpu < 0 || cpu == bound_cpu) return;
+  if (pin_current_thread(cpu)) bound_cpu = cpu;
+}
+
+int ppc::core::current_numa_node() {
+#if defined(__linux__)
+  const int node = NumaTopology::system().node_of(sched_getcpu());
+  return std::max(node, 0);
+#else
+  return 0;
+#endif
+}
+
+ppc::core::InputPlacement ppc::core::input_placement() {
+  const char *value = std::getenv("PPC_FIRST_TOUCH");
+  if (value != nullptr && std::string(value) == "1") return InputPlacement::FIRST_TOUCH;
+  if (value != nullptr && std::string(value) == "0") return InputPlacement::IN_PLACE;
+  return NumaTopology::system().nodes.size() > 1 ? InputPlacement::FIRST_TOUCH : InputPlacement::IN_PLACE;
+}
@@ -1,6 +1,10 @@
 // Copyright 2023 Nesterov Alexander
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <string>
 #include <vector>
 
 #include "core/perf/func_tests/test_task.hpp"
@@ -155,3 +159,275 @@ TEST(perf_tests, check_perf_task_float) {
   ASSERT_LE(perfResults->time_sec, 10.0);
   EXPECT_EQ(out[0], in.size());
 }
+
+TEST(perf_tests, check_statistics) {
+  std::vector<double> samples = {5.0, 1.0, 3.0, 2.0, 4.0};
+
+  ppc::core::PerfResults perfResults;
+  ppc::core::Perf::compute_statistics(samples, perfResults);
+
+  EXPECT_EQ(perfResults.samples.size(), samples.size());
+  EXPECT_DOUBLE_EQ(perfResults.min, 1.0);
+  EXPECT_DOUBLE_EQ(perfResults.median, 3.0);
+  EXPECT_DOUBLE_EQ(perfResults.p90, 4.6);
+  EXPECT_DOUBLE_EQ(perfResults.mean, 3.0);
+  EXPECT_NEAR(perfResults.stddev, 1.5811388, 1e-6);
+  EXPECT_EQ(perfResults.num_outliers, 0u);
+  EXPECT_LT(perfResults.ci_low, perfResults.mean);
+  EXPECT_GT(perfResults.ci_high, perfResults.mean);
+  EXPECT_NEAR(perfResults.relative_error, (perfResults.ci_high - perfResults.mean) / perfResults.mean, 1e-12);
+}
+
+TEST(perf_tests, check_statistics_outliers) {
+  std::vector<double> samples(20, 1.0);
+  samples[7] = 100.0;
+
+  ppc::core::PerfResults perfResults;
+  ppc::core::Perf::compute_statistics(samples, perfResults);
+
+  EXPECT_EQ(perfResults.num_outliers, 1u);
+  EXPECT_DOUBLE_EQ(perfResults.mean, 1.0);
+  EXPECT_DOUBLE_EQ(perfResults.stddev, 0.0);
+  EXPECT_DOUBLE_EQ(perfResults.median, 1.0);
+  EXPECT_GT(perfResults.p99, 1.0);
+}
+
+TEST(perf_tests, check_perf_warmup_and_samples) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create TaskData
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto testTask = std::make_shared<ppc::test::TestTask<uint32_t>>(taskData);
+
+  // Create Perf attributes, timer counts its calls
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  perfAttr->num_warmup = 3;
+  int timer_calls = 0;
+  perfAttr->current_timer = [&] { return static_cast<double>(timer_calls++); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perfAnalyzer(testTask);
+  perfAnalyzer.pipeline_run(perfAttr, perfResults);
+
+  // Every run is timed separately, warmup runs are not timed
+  EXPECT_EQ(timer_calls, 20);
+  EXPECT_EQ(perfResults->samples.size(), 10u);
+  EXPECT_DOUBLE_EQ(perfResults->mean, 1.0);
+  EXPECT_DOUBLE_EQ(perfResults->time_sec, 10.0);
+  EXPECT_EQ(out[0], in.size());
+}
+
+namespace {
+
+// reports fixed communication times for every run
+class CommunicatingTask : public ppc::test::TestTask<uint32_t> {
+ public:
+  using TestTask::TestTask;
+  bool run() override {
+    add_communication_time(0.25, 1.5);
+    return TestTask::run();
+  }
+};
+
+}  // namespace
+
+TEST(perf_tests, check_perf_communication_times) {
+  // Create data
+  std::vector<uint32_t> in(100, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create TaskData
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto testTask = std::make_shared<CommunicatingTask>(taskData);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  perfAttr->num_warmup = 2;
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perfAnalyzer(testTask);
+  perfAnalyzer.task_run(perfAttr, perfResults);
+
+  // times of one timed run, warmup runs are excluded
+  EXPECT_DOUBLE_EQ(perfResults->intra_node_time, 0.25);
+  EXPECT_DOUBLE_EQ(perfResults->inter_node_time, 1.5);
+  EXPECT_NE(ppc::core::Perf::to_json("example", "mpi", *perfResults).find("\"inter_node_time\": 1.5"),
+            std::string::npos);
+}
+
+TEST(perf_tests, check_perf_repetition_until_relative_error) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create TaskData
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto testTask = std::make_shared<ppc::test::TestTask<uint32_t>>(taskData);
+
+  // Create Perf attributes, timer alternates between short and long runs
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 4;
+  perfAttr->max_running = 40;
+  perfAttr->target_relative_error = 1e-6;
+  double time = 0.0;
+  int timer_calls = 0;
+  perfAttr->current_timer = [&] {
+    time += (timer_calls++ % 4 == 1) ? 2.0 : 1.0;
+    return time;
+  };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perfAnalyzer(testTask);
+  perfAnalyzer.task_run(perfAttr, perfResults);
+
+  // Target is not reachable, measurement stops at max_running
+  EXPECT_EQ(perfResults->samples.size(), 40u);
+  EXPECT_GT(perfResults->relative_error, perfAttr->target_relative_error);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_hardware_counters) {
+  ppc::core::HardwareCounters counters;
+  counters.start();
+  volatile uint64_t sum = 0;
+  for (uint64_t i = 0; i < 100000; i++) {
+    sum = sum + i;
+  }
+  counters.stop();
+  auto values = counters.read();
+  if (counters.available()) {
+    EXPECT_GT(values.cycles, 0u);
+    EXPECT_GT(values.instructions, 0u);
+  } else {
+    EXPECT_EQ(values.cycles, 0u);
+    EXPECT_EQ(values.instructions, 0u);
+  }
+}
+
+TEST(perf_tests, check_perf_counters_degrade_gracefully) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create TaskData
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto testTask = std::make_shared<ppc::test::TestTask<uint32_t>>(taskData);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  perfAttr->collect_counters = true;
+  perfAttr->bytes_processed = in.size() * sizeof(uint32_t);
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perfAnalyzer(testTask);
+  perfAnalyzer.task_run(perfAttr, perfResults);
+
+  if (perfResults->counters_available) {
+    EXPECT_GT(perfResults->cycles, 0.0);
+    EXPECT_GT(perfResults->ipc, 0.0);
+    EXPECT_GT(perfResults->bytes_per_cycle, 0.0);
+  } else {
+    EXPECT_EQ(perfResults->ipc, 0.0);
+  }
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_structured_records) {
+  ppc::core::PerfResults perfResults;
+  ppc::core::Perf::compute_statistics({0.1, 0.2, 0.3}, perfResults);
+  perfResults.time_sec = 1.5;
+  perfResults.type_of_running = ppc::core::PerfResults::TypeOfRunning::PIPELINE;
+  perfResults.num_threads = 4;
+  perfResults.input_size = 100;
+  perfResults.isa_level = "avx2";
+  perfResults.kernel_variants = "simd<float>=avx2;simd<int32_t>=avx2";
+  perfResults.test_name = "test_pipeline_run";
+
+  auto json = ppc::core::Perf::to_json("example", "omp", perfResults);
+  EXPECT_EQ(json.front(), '{');
+  EXPECT_EQ(json.back(), '}');
+  EXPECT_NE(json.find("\"task\": \"example\""), std::string::npos);
+  EXPECT_NE(json.find("\"backend\": \"omp\""), std::string::npos);
+  EXPECT_NE(json.find("\"type\": \"pipeline\""), std::string::npos);
+  EXPECT_NE(json.find("\"test\": \"test_pipeline_run\""), std::string::npos);
+  EXPECT_NE(json.find("\"num_threads\": 4"), std::string::npos);
+  EXPECT_NE(json.find("\"input_size\": 100"), std::string::npos);
+  EXPECT_NE(json.find("\"within_limits\": true"), std::string::npos);
+  EXPECT_NE(json.find("\"median\": 0.2"), std::string::npos);
+  EXPECT_NE(json.find("\"samples\": [0.1, 0.2, 0.3]"), std::string::npos);
+  EXPECT_NE(json.find("\"isa_level\": \"avx2\""), std::string::npos);
+  EXPECT_NE(json.find("\"kernel_variants\": \"simd<float>=avx2;simd<int32_t>=avx2\""), std::string::npos);
+
+  auto header = ppc::core::Perf::csv_header();
+  auto row = ppc::core::Perf::to_csv("example", "omp", perfResults);
+  EXPECT_EQ(header.rfind("task,backend,type,test,", 0), 0u);
+  EXPECT_EQ(row.rfind("example,omp,pipeline,test_pipeline_run,4,", 0), 0u);
+  EXPECT_EQ(std::count(header.begin(), header.end(), ','), std::count(row.begin(), row.end(), ','));
+}
+
+TEST(perf_tests, check_structured_records_escaping) {
+  ppc::core::PerfResults perfResults;
+  ppc::core::Perf::compute_statistics({0.1, std::numeric_limits<double>::infinity()}, perfResults);
+  perfResults.stddev = std::numeric_limits<double>::quiet_NaN();
+  perfResults.kernel_variants = "pair_distance<int, \"max\">=avx2";
+
+  // non-finite values are not valid JSON numbers
+  auto json = ppc::core::Perf::to_json("example", "omp", perfResults);
+  EXPECT_NE(json.find("\"stddev\": null"), std::string::npos);
+  EXPECT_NE(json.find("\"samples\": [0.1, null]"), std::string::npos);
+  EXPECT_EQ(json.find("nan"), std::string::npos);
+  EXPECT_EQ(json.find("inf"), std::string::npos);
+
+  // separators inside of a field are quoted, the row keeps the column count
+  auto header = ppc::core::Perf::csv_header();
+  auto row = ppc::core::Perf::to_csv("example", "omp", perfResults);
+  EXPECT_NE(row.find(",\"pair_distance<int, \"\"max\"\">=avx2\","), std::string::npos);
+  std::size_t columns = 1;
+  bool quoted = false;
+  for (char c : row) {
+    if (c == '"') quoted = !quoted;
+    if (c == ',' && !quoted) columns++;
+  }
+  EXPECT_EQ(columns, static_cast<std::size_t>(std::count(header.begin(), header.end(), ',') + 1));
+}
@@ -0,0 +1,44 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_COUNTERS_HPP_
+#define MODULES_CORE_INCLUDE_COUNTERS_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ppc::core {
+
+struct CounterValues {
+  uint64_t cycles = 0;
+  uint64_t instructions = 0;
+  uint64_t llc_misses = 0;
+  uint64_t branch_misses = 0;
+};
+
+// Hardware performance counters (Linux perf_event) of the current process.
+// Counters are opened for every thread existing at construction and are
+// inherited by threads created later, values are summed over all threads.
+// When the kernel forbids access (perf_event_paranoid) or there is no PMU,
+// available() is false and all values stay zero.
+class HardwareCounters {
+ public:
+  HardwareCounters();
+  HardwareCounters(const HardwareCounters &) = delete;
+  HardwareCounters &operator=(const HardwareCounters &) = delete;
+  ~HardwareCounters();
+
+  [[nodiscard]] bool available() const;
+  void start();
+  void stop();
+  [[nodiscard]] CounterValues read() const;
+
+ private:
+  static constexpr std::size_t kinds_count = 4;
+  std::vector<std::array<int, kinds_count>> fds_;
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_COUNTERS_HPP_
@@ -6,8 +6,10 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
+#include "core/perf/include/counters.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ppc {
@@ -16,15 +18,77 @@ namespace core {
 struct PerfAttr {
   // count of task's running
   uint64_t num_running;
+  // count of untimed runs before measurement
+  uint64_t num_warmup = 0;
+  // measurement is repeated by blocks of num_running runs until relative error
+  // of the mean drops below this value (0 - single block)
+  double target_relative_error = 0.0;
+  // upper bound for count of timed runs with repetition (0 - 10 * num_running)
+  uint64_t max_running = 0;
+  // collect hardware counters around timed runs (Linux perf_event)
+  bool collect_counters = false;
+  // bytes read and written by one run, used for bytes per cycle
+  uint64_t bytes_processed = 0;
+  // description of measured configuration for structured output
+  uint64_t input_size = 0;
+  // 0 - ppc::util::get_num_threads()
+  int num_threads = 0;
+  int num_procs = 1;
   std::function<double(void)> current_timer = [&] { return 0.0; };
 };
 
 struct PerfResults {
-  // measurement of task's time (in seconds)
+  // measurement of task's time (in seconds): num_running times mean time of
+  // one run after outlier rejection
   double time_sec = 0.0;
   enum TypeOfRunning { PIPELINE, TASK_RUN, NONE } type_of_running = NONE;
   constexpr const static double MAX_TIME = 10.0;
   constexpr const static double MIN_TIME = 0.05;
+
+  // times of single runs (in seconds)
+  std::vector<double> samples;
+  // order statistics over all samples
+  double min = 0.0;
+  double median = 0.0;
+  double p90 = 0.0;
+  double p99 = 0.0;
+  // moments over samples inside of Tukey's fences (1.5 IQR)
+  double mean = 0.0;
+  double stddev = 0.0;
+  // 95% confidence interval of the mean
+  double ci_low = 0.0;
+  double ci_high = 0.0;
+  double relative_error = 0.0;
+  uint64_t num_outliers = 0;
+
+  // hardware counters per run, false when not requested or not permitted
+  bool counters_available = false;
+  double cycles = 0.0;
+  double instructions = 0.0;
+  double llc_misses = 0.0;
+  double branch_misses = 0.0;
+  double ipc = 0.0;
+  double bytes_per_cycle = 0.0;
+
+  // gtest test that measured the task, records are keyed by task, backend,
+  // type of running and test
+  std::string test_name;
+  // measured configuration copied from PerfAttr
+  uint64_t input_size = 0;
+  int num_threads = 0;
+  int num_procs = 1;
+  // ppc::core::isa_level() and the kernel variants called by the warmup and
+  // measured runs, "kernel=level" separated by ';'
+  std::string isa_level = "scalar";
+  std::string kernel_variants;
+  // scratch arena of the task: peak bytes of one run and chunks requested
+  // from the system, a constant count means runs do not allocate
+  uint64_t scratch_peak_bytes = 0;
+  uint64_t scratch_system_allocations = 0;
+  // communication of one timed run of distributed tasks (in seconds): between
+  // ranks of one node and between nodes
+  double intra_node_time = 0.0;
+  double inter_node_time = 0.0;
 };
 
 class Perf {
@@ -40,13 +104,21 @@ class Perf {
                     const std::shared_ptr<ppc::core::PerfResults>& perfResults);
   // Check performance of task's run() function
   void task_run(const std::shared_ptr<PerfAttr>& perfAttr, const std::shared_ptr<ppc::core::PerfResults>& perfResults);
-  // Pint results for automation checkers
+  // Pint results for automation checkers, lines of tests other than
+  // test_task_run and test_pipeline_run carry the test name after the type
   static void print_perf_statistic(const std::shared_ptr<PerfResults>& perfResults);
+  // Structured records of results: one JSON object per line or one CSV row
+  static std::string to_json(const std::string& task_name, const std::string& backend,
+                             const PerfResults& perfResults);
+  static std::string to_csv(const std::string& task_name, const std::string& backend, const PerfResults& perfResults);
+  static std::string csv_header();
+  // Fill statistics of perfResults from times of single runs
+  static void compute_statistics(const std::vector<double>& samples, PerfResults& perfResults);
 
  private:
   std::shared_ptr<Task> task;
-  static void common_run(const std::shared_ptr<PerfAttr>& perfAttr, const std::function<void()>& pipeline,
-                         const std::shared_ptr<ppc::core::PerfResults>& perfResults);
+  void common_run(const std::shared_ptr<PerfAttr>& perfAttr, const std::function<void()>& pipeline,
+                  const std::shared_ptr<ppc::core::PerfResults>& perfResults);
 };
 
 }  // namespace core
@@ -0,0 +1,127 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/perf/include/counters.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <filesystem>
+#include <string>
+#endif
+
+#if defined(__linux__)
+
+namespace {
+
+constexpr std::array<uint64_t, 4> kinds = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                           PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+int open_counter(uint64_t config, pid_t tid) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  attr.disabled = 1;
+  attr.inherit = 1;
+  // user space only, allowed with perf_event_paranoid <= 2
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, tid, -1, -1, 0));
+}
+
+std::vector<pid_t> process_threads() {
+  std::vector<pid_t> tids;
+  std::error_code error;
+  for (const auto &entry : std::filesystem::directory_iterator("/proc/self/task", error)) {
+    tids.push_back(static_cast<pid_t>(std::stoi(entry.path().filename().string())));
+  }
+  if (tids.empty()) {
+    tids.push_back(0);
+  }
+  return tids;
+}
+
+}  // namespace
+
+ppc::core::HardwareCounters::HardwareCounters() {
+  for (auto tid : process_threads()) {
+    std::array<int, kinds_count> thread_fds{};
+    for (size_t k = 0; k < kinds_count; k++) {
+      thread_fds[k] = open_counter(kinds[k], tid);
+    }
+    // cycles and instructions are required, other counters are optional
+    if (thread_fds[0] < 0 || thread_fds[1] < 0) {
+      for (auto fd : thread_fds) {
+        if (fd >= 0) close(fd);
+      }
+      continue;
+    }
+    fds_.push_back(thread_fds);
+  }
+}
+
+ppc::core::HardwareCounters::~HardwareCounters() {
+  for (const auto &thread_fds : fds_) {
+    for (auto fd : thread_fds) {
+      if (fd >= 0) close(fd);
+    }
+  }
+}
+
+void ppc::core::HardwareCounters::start() {
+  for (const auto &thread_fds : fds_) {
+    for (auto fd : thread_fds) {
+      if (fd < 0) continue;
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+}
+
+void ppc::core::HardwareCounters::stop() {
+  for (const auto &thread_fds : fds_) {
+    for (auto fd : thread_fds) {
+      if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    }
+  }
+}
+
+ppc::core::CounterValues ppc::core::HardwareCounters::read() const {
+  std::array<uint64_t, kinds_count> totals{};
+  for (const auto &thread_fds : fds_) {
+    for (size_t k = 0; k < kinds_count; k++) {
+      // value, time enabled, time running
+      std::array<uint64_t, 3> data{};
+      if (thread_fds[k] < 0 || ::read(thread_fds[k], data.data(), sizeof(data)) != sizeof(data)) continue;
+      // scale counters multiplexed with other events
+      if (data[2] != 0 && data[2] < data[1]) {
+        data[0] = static_cast<uint64_t>(static_cast<double>(data[0]) * static_cast<double>(data[1]) /
+                                        static_cast<double>(data[2]));
+      }
+      totals[k] += data[0];
+    }
+  }
+  CounterValues values;
+  values.cycles = totals[0];
+  values.instructions = totals[1];
+  values.llc_misses = totals[2];
+  values.branch_misses = totals[3];
+  return values;
+}
+
+#else
+
+ppc::core::HardwareCounters::HardwareCounters() = default;
+ppc::core::HardwareCounters::~HardwareCounters() = default;
+void ppc::core::HardwareCounters::start() {}
+void ppc::core::HardwareCounters::stop() {}
+ppc::core::CounterValues ppc::core::HardwareCounters::read() const { return {}; }
+
+#endif
+
+bool ppc::core::HardwareCounters::available() const { return !fds_.empty(); }
@@ -3,11 +3,121 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <numeric>
 #include <sstream>
 #include <utility>
 
+#include "core/dispatch/include/dispatch.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+const char* type_of_running_name(ppc::core::PerfResults::TypeOfRunning type) {
+  switch (type) {
+    case ppc::core::PerfResults::TypeOfRunning::TASK_RUN:
+      return "task_run";
+    case ppc::core::PerfResults::TypeOfRunning::PIPELINE:
+      return "pipeline";
+    case ppc::core::PerfResults::TypeOfRunning::NONE:
+      break;
+  }
+  return "none";
+}
+
+bool is_within_limits(double time_sec) {
+  return time_sec > ppc::core::PerfResults::MIN_TIME && time_sec < ppc::core::PerfResults::MAX_TIME;
+}
+
+std::string escape_json(const std::string& str) {
+  std::string res;
+  for (auto c : str) {
+    if (c == '"' || c == '\\') res += '\\';
+    res += c;
+  }
+  return res;
+}
+
+// RFC 4180 field: quoted when it holds a separator, a quote or a line break
+std::string escape_csv(const std::string& str) {
+  if (str.find_first_of(",\"\r\n") == std::string::npos) return str;
+  std::string res = "\"";
+  for (auto c : str) {
+    if (c == '"') res += '"';
+    res += c;
+  }
+  res += '"';
+  return res;
+}
+
+// JSON has no NaN and infinities, they are written as null
+std::string format_number(double value) {
+  if (!std::isfinite(value)) return "null";
+  std::stringstream str;
+  str << std::setprecision(10) << value;
+  return str.str();
+}
+
+bool is_string_field(const std::string& name) {
+  return name == "task" || name == "backend" || name == "type" || name == "test" || name == "isa_level" ||
+         name == "kernel_variants";
+}
+
+// name-value pairs shared by JSON and CSV records, in CSV column order
+std::vector<std::pair<std::string, std::string>> record_fields(const std::string& task_name,
+                                                               const std::string& backend,
+                                                               const ppc::core::PerfResults& r) {
+  const auto& num = format_number;
+  return {{"task", task_name},
+          {"backend", backend},
+          {"type", type_of_running_name(r.type_of_running)},
+          {"test", r.test_name},
+          {"num_threads", std::to_string(r.num_threads)},
+          {"num_procs", std::to_string(r.num_procs)},
+          {"input_size", std::to_string(r.input_size)},
+          {"num_samples", std::to_string(r.samples.size())},
+          {"time_sec", num(r.time_sec)},
+          {"within_limits", is_within_limits(r.time_sec) ? "true" : "false"},
+          {"min", num(r.min)},
+          {"median", num(r.median)},
+          {"p90", num(r.p90)},
+          {"p99", num(r.p99)},
+          {"mean", num(r.mean)},
+          {"stddev", num(r.stddev)},
+          {"ci_low", num(r.ci_low)},
+          {"ci_high", num(r.ci_high)},
+          {"relative_error", num(r.relative_error)},
+          {"num_outliers", std::to_string(r.num_outliers)},
+          {"counters_available", r.counters_available ? "true" : "false"},
+          {"cycles", num(r.cycles)},
+          {"instructions", num(r.instructions)},
+          {"llc_misses", num(r.llc_misses)},
+          {"branch_misses", num(r.branch_misses)},
+          {"ipc", num(r.ipc)},
+          {"bytes_per_cycle", num(r.bytes_per_cycle)},
+          {"isa_level", r.isa_level},
+          {"kernel_variants", r.kernel_variants},
+          {"scratch_peak_bytes", std::to_string(r.scratch_peak_bytes)},
+          {"scratch_system_allocations", std::to_string(r.scratch_system_allocations)},
+          {"intra_node_time", num(r.intra_node_time)},
+          {"inter_node_time", num(r.inter_node_time)}};
+}
+
+void record_scratch(const ppc::core::Task& task, ppc::core::PerfResults& perfResults) {
+  const auto& stats = task.scratch_stats();
+  perfResults.scratch_peak_bytes = stats.peak;
+  perfResults.scratch_system_allocations = stats.system_allocations;
+}
+
+}  // namespace
+
 ppc::core::Perf::Perf(std::shared_ptr<Task> task_) { set_task(std::move(task_)); }
 
 void ppc::core::Perf::set_task(std::shared_ptr<Task> task_) {
@@ -27,7 +137,8 @@ void ppc::core::Perf::pipeline_run(const std::shared_ptr<PerfAttr>& perfAttr,
         task->run();
         task->post_processing();
       },
-      std::move(perfResults));
+      perfResults);
+  record_scratch(*task, *perfResults);
 }
 
 void ppc::core::Perf::task_run(const std::shared_ptr<PerfAttr>& perfAttr,
@@ -36,8 +147,9 @@ void ppc::core::Perf::task_run(const std::shared_ptr<PerfAttr>& perfAttr,
 
   task->validation();
   task->pre_processing();
-  common_run(std::move(perfAttr), [&]() { task->run(); }, std::move(perfResults));
+  common_run(std::move(perfAttr), [&]() { task->run(); }, perfResults);
   task->post_processing();
+  record_scratch(*task, *perfResults);
 
   task->validation();
   task->pre_processing();
@@ -47,38 +159,160 @@ void ppc::core::Perf::task_run(const std::shared_ptr<PerfAttr>& perfAttr,
 
 void ppc::core::Perf::common_run(const std::shared_ptr<PerfAttr>& perfAttr, const std::function<void()>& pipeline,
                                  const std::shared_ptr<ppc::core::PerfResults>& perfResults) {
-  auto begin = perfAttr->current_timer();
-  for (uint64_t i = 0; i < perfAttr->num_running; i++) {
+  // kernels bound by earlier tests of the process are not part of this record
+  reset_used_variants();
+  for (uint64_t i = 0; i < perfAttr->num_warmup; i++) {
     pipeline();
   }
-  auto end = perfAttr->current_timer();
-  perfResults->time_sec = end - begin;
+
+  auto max_running = perfAttr->max_running != 0 ? perfAttr->max_running : 10 * perfAttr->num_running;
+  std::vector<double> samples;
+  samples.reserve(perfAttr->num_running);
+
+  std::unique_ptr<HardwareCounters> counters;
+  if (perfAttr->collect_counters) {
+    counters = std::make_unique<HardwareCounters>();
+    if (!counters->available()) {
+      std::cerr << "Hardware counters are not available (check /proc/sys/kernel/perf_event_paranoid)" << std::endl;
+      counters.reset();
+    }
+  }
+  const auto* test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+  perfResults->test_name = test_info != nullptr ? test_info->name() : "";
+
+  if (counters) counters->start();
+  const auto communication_before = task->communication_times();
+
+  do {
+    for (uint64_t i = 0; i < perfAttr->num_running; i++) {
+      auto begin = perfAttr->current_timer();
+      pipeline();
+      auto end = perfAttr->current_timer();
+      samples.push_back(end - begin);
+    }
+    compute_statistics(samples, *perfResults);
+  } while (perfAttr->num_running != 0 && perfAttr->target_relative_error > 0.0 &&
+           perfResults->relative_error > perfAttr->target_relative_error &&
+           samples.size() + perfAttr->num_running <= max_running);
+
+  if (!samples.empty()) {
+    const auto& communication = task->communication_times();
+    auto runs = static_cast<double>(samples.size());
+    perfResults->intra_node_time = (communication.intra_node - communication_before.intra_node) / runs;
+    perfResults->inter_node_time = (communication.inter_node - communication_before.inter_node) / runs;
+  }
+
+  perfResults->input_size = perfAttr->input_size;
+  perfResults->num_threads = perfAttr->num_threads != 0 ? perfAttr->num_threads : ppc::util::get_num_threads();
+  perfResults->num_procs = perfAttr->num_procs;
+  perfResults->isa_level = to_string(isa_level());
+  perfResults->kernel_variants = used_variants();
+
+  perfResults->counters_available = false;
+  if (counters && !samples.empty()) {
+    counters->stop();
+    auto values = counters->read();
+    auto runs = static_cast<double>(samples.size());
+    perfResults->counters_available = true;
+    perfResults->cycles = static_cast<double>(values.cycles) / runs;
+    perfResults->instructions = static_cast<double>(values.instructions) / runs;
+    perfResults->llc_misses = static_cast<double>(values.llc_misses) / runs;
+    perfResults->branch_misses = static_cast<double>(values.branch_misses) / runs;
+    perfResults->ipc = perfResults->cycles > 0.0 ? perfResults->instructions / perfResults->cycles : 0.0;
+    perfResults->bytes_per_cycle =
+        perfResults->cycles > 0.0 ? static_cast<double>(perfAttr->bytes_processed) / perfResults->cycles : 0.0;
+  }
+
+  perfResults->time_sec = perfResults->mean * static_cast<double>(perfAttr->num_running);
+}
+
+void ppc::core::Perf::compute_statistics(const std::vector<double>& samples, PerfResults& perfResults) {
+  perfResults.samples = samples;
+  perfResults.num_outliers = 0;
+  if (samples.empty()) {
+    perfResults.min = perfResults.median = perfResults.p90 = perfResults.p99 = 0.0;
+    perfResults.mean = perfResults.stddev = perfResults.ci_low = perfResults.ci_high = 0.0;
+    perfResults.relative_error = 0.0;
+    return;
+  }
+
+  std::vector<double> sorted(samples);
+  std::sort(sorted.begin(), sorted.end());
+  auto percentile = [&](double p) {
+    // linear interpolation between closest ranks
+    auto rank = p * static_cast<double>(sorted.size() - 1);
+    auto lower = static_cast<size_t>(std::floor(rank));
+    auto upper = std::min(lower + 1, sorted.size() - 1);
+    return sorted[lower] + (rank - static_cast<double>(lower)) * (sorted[upper] - sorted[lower]);
+  };
+  perfResults.min = sorted.front();
+  perfResults.median = percentile(0.5);
+  perfResults.p90 = percentile(0.9);
+  perfResults.p99 = percentile(0.99);
+
+  // Tukey's fences, too few samples for quartiles are kept as is
+  auto first = sorted.begin();
+  auto last = sorted.end();
+  if (sorted.size() >= 4) {
+    auto q1 = percentile(0.25);
+    auto q3 = percentile(0.75);
+    auto iqr = q3 - q1;
+    first = std::lower_bound(sorted.begin(), sorted.end(), q1 - 1.5 * iqr);
+    last = std::upper_bound(sorted.begin(), sorted.end(), q3 + 1.5 * iqr);
+  }
+  auto n = static_cast<size_t>(last - first);
+  perfResults.num_outliers = sorted.size() - n;
+
+  auto mean = std::accumulate(first, last, 0.0) / static_cast<double>(n);
+  double sq_sum = 0.0;
+  for (auto it = first; it != last; it++) {
+    sq_sum += (*it - mean) * (*it - mean);
+  }
+  auto stddev = n > 1 ? std::sqrt(sq_sum / static_cast<double>(n - 1)) : 0.0;
+
+  // two-sided 95% quantiles of Student's t-distribution, normal for df > 30
+  static const std::array<double, 30> t_quantiles = {
+      12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228, 2.201, 2.179, 2.160, 2.145, 2.131,
+      2.120,  2.110, 2.101, 2.093, 2.086, 2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+  auto t = n < 2 ? 0.0 : (n - 1 <= t_quantiles.size() ? t_quantiles[n - 2] : 1.96);
+  auto half_width = t * stddev / std::sqrt(static_cast<double>(n));
+
+  perfResults.mean = mean;
+  perfResults.stddev = stddev;
+  perfResults.ci_low = mean - half_width;
+  perfResults.ci_high = mean + half_width;
+  perfResults.relative_error = mean > 0.0 ? half_width / mean : 0.0;
 }
 
 void ppc::core::Perf::print_perf_statistic(const std::shared_ptr<PerfResults>& perfResults) {
   std::string relative_path(::testing::UnitTest::GetInstance()->current_test_info()->file());
   std::string ppc_regex_template("parallel_programming_course");
   std::string perf_regex_template("perf_tests");
-  std::string type_test_name;
+  std::string tasks_regex_template("tasks");
+  std::string type_test_name(type_of_running_name(perfResults->type_of_running));
+  // tests besides test_task_run and test_pipeline_run measure other variants of
+  // the task, their lines are named by the test
+  const auto& test_name = perfResults->test_name;
+  if (!test_name.empty() && test_name != "test_task_run" && test_name != "test_pipeline_run") {
+    type_test_name += ":" + test_name;
+  }
 
   auto time_secs = perfResults->time_sec;
 
-  if (perfResults->type_of_running == PerfResults::TypeOfRunning::TASK_RUN) {
-    type_test_name = "task_run";
-  } else if (perfResults->type_of_running == PerfResults::TypeOfRunning::PIPELINE) {
-    type_test_name = "pipeline";
-  } else if (perfResults->type_of_running == PerfResults::TypeOfRunning::NONE) {
-    type_test_name = "none";
+  auto first_found_position = relative_path.find(ppc_regex_template);
+  if (first_found_position != std::string::npos) {
+    relative_path.erase(0, first_found_position + ppc_regex_template.length() + 1);
+  } else {
+    // project is checked out under another directory name
+    auto tasks_position = relative_path.rfind(tasks_regex_template);
+    if (tasks_position != std::string::npos) relative_path.erase(0, tasks_position);
   }
 
-  auto first_found_position = relative_path.find(ppc_regex_template) + ppc_regex_template.length() + 1;
-  relative_path.erase(0, first_found_position);
-
   auto last_found_position = relative_path.find(perf_regex_template) - 1;
   relative_path.erase(last_found_position, relative_path.length() - 1);
 
   std::stringstream perf_res_str;
-  if (time_secs > PerfResults::MIN_TIME && time_secs < PerfResults::MAX_TIME) {
+  if (is_within_limits(time_secs)) {
     perf_res_str << std::fixed << std::setprecision(10) << time_secs;
   } else {
     std::cerr << "Task execute time need to be: ";
@@ -89,4 +323,99 @@ void ppc::core::Perf::print_perf_statistic(const std::shared_ptr<PerfResults>& p
   }
 
   std::cout << relative_path << ":" << type_test_name << ":" << perf_res_str.str() << std::endl;
+  if (perfResults->counters_available) {
+    std::cout << relative_path << ":" << type_test_name << ":counters:" << std::fixed << std::setprecision(3)
+              << " cycles=" << perfResults->cycles << " instructions=" << perfResults->instructions
+              << " ipc=" << perfResults->ipc << " llc_misses=" << perfResults->llc_misses
+              << " branch_misses=" << perfResults->branch_misses << " bytes_per_cycle=" << perfResults->bytes_per_cycle
+              << std::endl;
+  }
+  if (perfResults->scratch_peak_bytes != 0) {
+    std::cout << relative_path << ":" << type_test_name << ":scratch: peak_bytes=" << perfResults->scratch_peak_bytes
+              << " system_allocations=" << perfResults->scratch_system_allocations << std::endl;
+  }
+  if (perfResults->intra_node_time != 0.0 || perfResults->inter_node_time != 0.0) {
+    std::cout << relative_path << ":" << type_test_name << ":communication:" << std::fixed << std::setprecision(10)
+              << " intra_node=" << perfResults->intra_node_time << " inter_node=" << perfResults->inter_node_time
+              << std::endl;
+  }
+  if (!perfResults->kernel_variants.empty()) {
+    std::cout << relative_path << ":" << type_test_name << ":isa: " << perfResults->isa_level << " "
+              << perfResults->kernel_variants << std::endl;
+  }
+
+  // Structured record for dashboards, the format is chosen by file extension
+  const char* output_path = std::getenv("PPC_PERF_OUTPUT");
+  if (output_path != nullptr && *output_path != '\0') {
+    // tasks/<backend>/<task name>
+    std::string backend;
+    std::string task_name = relative_path;
+    auto task_pos = relative_path.find_last_of("/\\");
+    if (task_pos != std::string::npos) {
+      task_name = relative_path.substr(task_pos + 1);
+      auto backend_pos = relative_path.find_last_of("/\\", task_pos - 1);
+      backend = relative_path.substr(backend_pos == std::string::npos ? 0 : backend_pos + 1,
+                                     task_pos - (backend_pos == std::string::npos ? 0 : backend_pos + 1));
+    }
+
+    auto record = *perfResults;
+    // sequential tasks run on one thread whatever PPC_NUM_THREADS says
+    if (backend == "seq") record.num_threads = 1;
+
+    std::string path(output_path);
+    bool is_csv = path.size() >= 4 && path.compare(path.size() - 4, 4, ".csv") == 0;
+    bool is_new = !std::filesystem::exists(path) || std::filesystem::file_size(path) == 0;
+    std::ofstream output(path, std::ios::app);
+    if (!output) {
+      std::cerr << "Can not open perf output file: " << path << std::endl;
+      return;
+    }
+    if (is_csv) {
+      if (is_new) output << csv_header() << std::endl;
+      output << to_csv(task_name, backend, record) << std::endl;
+    } else {
+      output << to_json(task_name, backend, record) << std::endl;
+    }
+  }
+}
+
+std::string ppc::core::Perf::to_json(const std::string& task_name, const std::string& backend,
+                                     const PerfResults& perfResults) {
+  std::stringstream str;
+  str << "{";
+  bool first = true;
+  for (const auto& [name, value] : record_fields(task_name, backend, perfResults)) {
+    str << (first ? "" : ", ") << "\"" << name << "\": ";
+    if (is_string_field(name)) {
+      str << "\"" << escape_json(value) << "\"";
+    } else {
+      str << value;
+    }
+    first = false;
+  }
+  str << ", \"samples\": [";
+  for (size_t i = 0; i < perfResults.samples.size(); i++) {
+    str << (i == 0 ? "" : ", ") << format_number(perfResults.samples[i]);
+  }
+  str << "]}";
+  return str.str();
+}
+
+std::string ppc::core::Perf::to_csv(const std::string& task_name, const std::string& backend,
+                                    const PerfResults& perfResults) {
+  std::string row;
+  for (const auto& field : record_fields(task_name, backend, perfResults)) {
+    if (!row.empty()) row += ',';
+    row += escape_csv(field.second);
+  }
+  return row;
+}
+
+std::string ppc::core::Perf::csv_header() {
+  std::string header;
+  for (const auto& field : record_fields("", "", PerfResults())) {
+    if (!header.empty()) header += ',';
+    header += escape_csv(field.first);
+  }
+  return header;
 }
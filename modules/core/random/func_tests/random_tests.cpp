@@ -0,0 +1,84 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "core/random/include/random.hpp"
+
+using ppc::core::Distribution;
+using ppc::core::Pattern;
+
+TEST(random_tests, check_philox_known_answers) {
+  // known answers of the Random123 reference implementation
+  EXPECT_EQ(ppc::core::philox4x32({0, 0, 0, 0}, {0, 0}),
+            (ppc::core::PhiloxBlock{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+  EXPECT_EQ(ppc::core::philox4x32({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}),
+            (ppc::core::PhiloxBlock{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+  EXPECT_EQ(ppc::core::philox4x32({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}),
+            (ppc::core::PhiloxBlock{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST(random_tests, check_same_output_for_any_thread_count) {
+  const Distribution<int> dist{-1000, 1000};
+  std::vector<int> expected(100003);
+  ppc::core::generate<int>(expected, dist, 42);
+  for (int num_threads : {1, 3, 4}) {
+    ppc::core::ThreadPool pool(num_threads);
+    std::vector<int> out(expected.size());
+    ppc::core::parallel_generate<int>(pool, out, dist, 42);
+    EXPECT_EQ(out, expected);
+  }
+  // a part generated alone, starting at an odd index
+  std::vector<int> part(1001);
+  ppc::core::generate<int>(part, dist, 42, 777, expected.size());
+  EXPECT_TRUE(std::equal(part.begin(), part.end(), expected.begin() + 777));
+
+  std::vector<int> other_seed(expected.size());
+  ppc::core::generate<int>(other_seed, dist, 43);
+  EXPECT_NE(other_seed, expected);
+  EXPECT_EQ(ppc::core::random_vector<int>(expected.size(), dist, 42), expected);
+}
+
+TEST(random_tests, check_uniform_values) {
+  const auto ints = ppc::core::random_vector<int>(20000, {1, 6}, 1);
+  std::vector<int> counts(7, 0);
+  for (int value : ints) {
+    ASSERT_GE(value, 1);
+    ASSERT_LE(value, 6);
+    counts[value]++;
+  }
+  // every face close to 1/6 of the elements
+  for (int face = 1; face <= 6; face++) EXPECT_NEAR(counts[face], 20000 / 6, 300);
+
+  const auto reals = ppc::core::random_vector<double>(20000, {-1.0, 1.0}, 2);
+  EXPECT_GE(*std::min_element(reals.begin(), reals.end()), -1.0);
+  EXPECT_LT(*std::max_element(reals.begin(), reals.end()), 1.0);
+
+  // the whole range of a 64-bit type
+  const Distribution<std::uint64_t> full{0, UINT64_MAX};
+  EXPECT_NO_THROW(ppc::core::random_vector<std::uint64_t>(100, full, 3));
+  EXPECT_THROW(ppc::core::random_vector<int>(10, {5, 1}), std::invalid_argument);
+}
+
+TEST(random_tests, check_patterns) {
+  const auto sorted = ppc::core::random_vector<int>(5000, {-100, 100, Pattern::SORTED}, 4);
+  EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end()));
+  EXPECT_LT(sorted.front(), sorted.back());
+
+  const auto descending = ppc::core::random_vector<double>(5000, {0.0, 1.0, Pattern::DESCENDING}, 5);
+  EXPECT_TRUE(std::is_sorted(descending.rbegin(), descending.rend()));
+
+  const auto alternating = ppc::core::random_vector<int>(5000, {1, 50, Pattern::ALTERNATING_SIGNS}, 6);
+  for (std::size_t i = 0; i < alternating.size(); i++) {
+    EXPECT_EQ(alternating[i] < 0, i % 2 == 0);
+    EXPECT_GE(std::abs(alternating[i]), 1);
+  }
+  EXPECT_THROW(ppc::core::random_vector<unsigned>(10, {1, 5, Pattern::ALTERNATING_SIGNS}), std::invalid_argument);
+
+  const auto constant = ppc::core::random_vector<int>(100, {7, 9, Pattern::CONSTANT}, 7);
+  EXPECT_TRUE(std::all_of(constant.begin(), constant.end(), [](int value) { return value == 7; }));
+}
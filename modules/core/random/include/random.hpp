@@ -0,0 +1,179 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_RANDOM_HPP_
+#define MODULES_CORE_INCLUDE_RANDOM_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/util.hpp"
+
+namespace ppc::core {
+
+// Philox4x32-10 counter-based generator (Salmon et al., "Parallel random
+// numbers: as easy as 1, 2, 3"). A block of four words depends only on the
+// key and the counter, so any element of a sequence is computed directly
+// from its index and parallel fills do not depend on the count of threads.
+using PhiloxBlock = std::array<std::uint32_t, 4>;
+using PhiloxKey = std::array<std::uint32_t, 2>;
+
+inline PhiloxBlock philox4x32(PhiloxBlock counter, PhiloxKey key) {
+  constexpr std::uint64_t multiplier0 = 0xD2511F53;
+  constexpr std::uint64_t multiplier1 = 0xCD9E8D57;
+  constexpr std::uint32_t weyl0 = 0x9E3779B9;
+  constexpr std::uint32_t weyl1 = 0xBB67AE85;
+  for (int round = 0; round < 10; round++) {
+    const std::uint64_t product0 = multiplier0 * counter[0];
+    const std::uint64_t product1 = multiplier1 * counter[2];
+    counter = {static_cast<std::uint32_t>(product1 >> 32) ^ counter[1] ^ key[0], static_cast<std::uint32_t>(product1),
+               static_cast<std::uint32_t>(product0 >> 32) ^ counter[3] ^ key[1], static_cast<std::uint32_t>(product0)};
+    key[0] += weyl0;
+    key[1] += weyl1;
+  }
+  return counter;
+}
+
+// Sequence of 64-bit values selected by seed, value i is read in O(1)
+class CounterRandom {
+ public:
+  explicit CounterRandom(std::uint64_t seed)
+      : key_{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)} {}
+
+  // two values per block: values 2k and 2k + 1 share block k
+  [[nodiscard]] PhiloxBlock block(std::uint64_t index) const {
+    return philox4x32({static_cast<std::uint32_t>(index), static_cast<std::uint32_t>(index >> 32), 0, 0}, key_);
+  }
+  [[nodiscard]] std::uint64_t operator()(std::uint64_t index) const { return value(block(index / 2), index % 2); }
+
+  static std::uint64_t value(const PhiloxBlock &block, std::uint64_t half) {
+    return (static_cast<std::uint64_t>(block[2 * half + 1]) << 32) | block[2 * half];
+  }
+
+ private:
+  PhiloxKey key_;
+};
+
+// high 64 bits of a * b
+inline std::uint64_t mul_high(std::uint64_t a, std::uint64_t b) {
+  const std::uint64_t a_low = a & 0xFFFFFFFF;
+  const std::uint64_t a_high = a >> 32;
+  const std::uint64_t b_low = b & 0xFFFFFFFF;
+  const std::uint64_t b_high = b >> 32;
+  const std::uint64_t middle = a_high * b_low + ((a_low * b_low) >> 32);
+  return a_high * b_high + (middle >> 32) + (((middle & 0xFFFFFFFF) + a_low * b_high) >> 32);
+}
+
+// Value of random bits in [low, high]. Integers use the multiply-shift
+// reduction instead of a modulo, reals take the top 53 bits.
+template <class T>
+T uniform_value(std::uint64_t bits, T low, T high) {
+  if constexpr (std::is_floating_point_v<T>) {
+    const double unit = static_cast<double>(bits >> 11) * 0x1.0p-53;
+    return static_cast<T>(static_cast<double>(low) + (static_cast<double>(high) - static_cast<double>(low)) * unit);
+  } else {
+    // 0 stands for the whole range of 64-bit types
+    const std::uint64_t range = static_cast<std::uint64_t>(high) - static_cast<std::uint64_t>(low) + 1;
+    const std::uint64_t offset = range == 0 ? bits : mul_high(bits, range);
+    return static_cast<T>(static_cast<std::uint64_t>(low) + offset);
+  }
+}
+
+// Patterns of generated inputs, including the adversarial ones of the
+// reference tasks:
+//   UNIFORM - independent values in [low, high]
+//   SORTED - non-decreasing values spread over [low, high]
+//   DESCENDING - non-increasing, every neighbor pair is an orderly violation
+//   ALTERNATING_SIGNS - magnitudes in [low, high], negative at even indexes
+//   CONSTANT - every element is low, all extremums and neighbor pairs tie
+enum class Pattern { UNIFORM, SORTED, DESCENDING, ALTERNATING_SIGNS, CONSTANT };
+
+template <class T>
+struct Distribution {
+  T low;
+  T high;
+  Pattern pattern = Pattern::UNIFORM;
+};
+
+// element index of a sequence of total elements drawn with bits
+template <class T>
+T pattern_value(const Distribution<T> &dist, std::uint64_t bits, std::uint64_t index, std::uint64_t total) {
+  switch (dist.pattern) {
+    case Pattern::SORTED:
+    case Pattern::DESCENDING: {
+      // element k is drawn from the k-th of total consecutive ranges of [low, high]
+      const std::uint64_t k = dist.pattern == Pattern::SORTED ? index : total - 1 - index;
+      const double span = static_cast<double>(dist.high) - static_cast<double>(dist.low);
+      const double begin = static_cast<double>(dist.low) + span * static_cast<double>(k) / static_cast<double>(total);
+      const double end = static_cast<double>(dist.low) + span * static_cast<double>(k + 1) / static_cast<double>(total);
+      if constexpr (std::is_floating_point_v<T>) {
+        return uniform_value<T>(bits, static_cast<T>(begin), static_cast<T>(end));
+      } else {
+        const auto first = static_cast<T>(begin);
+        const auto next = static_cast<T>(end);
+        return uniform_value<T>(bits, first, next > first ? static_cast<T>(next - 1) : first);
+      }
+    }
+    case Pattern::ALTERNATING_SIGNS: {
+      const T magnitude = uniform_value<T>(bits, dist.low, dist.high);
+      return index % 2 == 0 ? static_cast<T>(-magnitude) : magnitude;
+    }
+    case Pattern::CONSTANT:
+      return dist.low;
+    default:
+      return uniform_value<T>(bits, dist.low, dist.high);
+  }
+}
+
+// Elements [first, first + out.size()) of the sequence of total elements
+// selected by seed; total 0 means first + out.size(). Parts of a sequence
+// generated separately (by threads or ranks) equal the whole sequence.
+template <class T>
+void generate(std::span<T> out, const Distribution<T> &dist, std::uint64_t seed, std::uint64_t first = 0,
+              std::uint64_t total = 0) {
+  if (dist.high < dist.low) throw std::invalid_argument("Distribution has low greater than high");
+  if constexpr (std::is_unsigned_v<T>) {
+    if (dist.pattern == Pattern::ALTERNATING_SIGNS) throw std::invalid_argument("Unsigned elements have no sign");
+  }
+  if (total == 0) total = first + out.size();
+  if (first + out.size() > total) throw std::invalid_argument("Generated part exceeds the sequence");
+  const CounterRandom random(seed);
+  PhiloxBlock block{};
+  for (std::size_t k = 0; k < out.size(); k++) {
+    const std::uint64_t index = first + k;
+    if (k == 0 || index % 2 == 0) block = random.block(index / 2);
+    out[k] = pattern_value(dist, CounterRandom::value(block, index % 2), index, total);
+  }
+}
+
+// whole sequence filled by balanced chunks of the pool threads
+template <class T>
+void parallel_generate(ThreadPool &pool, std::span<T> out, const Distribution<T> &dist, std::uint64_t seed) {
+  pool.parallel_for(0, out.size(), [&](std::size_t begin, std::size_t end) {
+    generate(out.subspan(begin, end - begin), dist, seed, begin, out.size());
+  });
+}
+
+// vector of count elements, filled by the shared pool when it is large:
+//   auto in = ppc::core::random_vector<int>(count, {-100, 100});
+template <class T>
+std::vector<T> random_vector(std::size_t count, const Distribution<T> &dist,
+                             std::uint64_t seed = ppc::util::get_seed()) {
+  constexpr std::size_t parallel_threshold = 1 << 16;
+  std::vector<T> vec(count);
+  if (count >= parallel_threshold) {
+    parallel_generate<T>(ThreadPool::global(), vec, dist, seed);
+  } else {
+    generate<T>(vec, dist, seed);
+  }
+  return vec;
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_RANDOM_HPP_
@@ -0,0 +1,79 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "core/scheduler/include/scheduler.hpp"
+
+namespace {
+
+int64_t fib(ppc::core::Scheduler &scheduler, int n) {
+  if (n < 2) return n;
+  int64_t x = 0;
+  int64_t y = 0;
+  ppc::core::TaskGroup group(scheduler);
+  group.run([&] { x = fib(scheduler, n - 1); });
+  group.run([&] { y = fib(scheduler, n - 2); });
+  group.wait();
+  return x + y;
+}
+
+}  // namespace
+
+TEST(scheduler_tests, check_recursive_fib) {
+  ppc::core::Scheduler scheduler(4);
+  ASSERT_EQ(scheduler.size(), 4);
+  EXPECT_EQ(fib(scheduler, 20), 6765);
+}
+
+TEST(scheduler_tests, check_single_thread_scheduler) {
+  ppc::core::Scheduler scheduler(1);
+  ASSERT_EQ(scheduler.size(), 1);
+  EXPECT_EQ(fib(scheduler, 15), 610);
+}
+
+TEST(scheduler_tests, check_parallel_for_uneven_work) {
+  ppc::core::Scheduler scheduler(3);
+  std::vector<std::atomic<int>> visits(1000);
+  ppc::core::parallel_for(scheduler, 0, visits.size(), 7, [&](size_t begin, size_t end) {
+    EXPECT_LE(end - begin, 7U);
+    for (size_t i = begin; i < end; i++) {
+      // cost of elements grows with the index
+      volatile size_t work = 0;
+      for (size_t k = 0; k < i; k++) work = work + k;
+      visits[i]++;
+    }
+  });
+  for (auto &visit : visits) {
+    EXPECT_EQ(visit.load(), 1);
+  }
+}
+
+TEST(scheduler_tests, check_exception_is_rethrown) {
+  ppc::core::Scheduler scheduler(2);
+  std::atomic<int> finished = 0;
+  ppc::core::TaskGroup group(scheduler);
+  group.run([] { throw std::runtime_error("error in task"); });
+  for (int i = 0; i < 10; i++) {
+    group.run([&] { finished++; });
+  }
+  EXPECT_THROW(group.wait(), std::runtime_error);
+  EXPECT_EQ(finished.load(), 10);
+  // group is reusable after the exception
+  group.run([&] { finished++; });
+  group.wait();
+  EXPECT_EQ(finished.load(), 11);
+}
+
+TEST(scheduler_tests, check_global_scheduler) {
+  std::atomic<int> count = 0;
+  ppc::core::TaskGroup group;
+  for (int i = 0; i < 100; i++) {
+    group.run([&] { count++; });
+  }
+  group.wait();
+  EXPECT_EQ(count.load(), 100);
+}
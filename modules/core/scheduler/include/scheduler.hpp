@@ -0,0 +1,122 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_SCHEDULER_HPP_
+#define MODULES_CORE_INCLUDE_SCHEDULER_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ppc::core {
+
+class TaskGroup;
+
+// Work-stealing scheduler for recursive divide-and-conquer. Every worker owns
+// a deque: it pushes and pops its own tasks at the back (depth first, cache
+// friendly) while idle workers steal the oldest, largest tasks from the front
+// of other deques. Tasks spawned by threads outside of the scheduler go to a
+// shared injection queue. A thread waiting for a TaskGroup executes pending
+// tasks instead of blocking, stealing only up to a fixed nesting depth.
+class Scheduler {
+ public:
+  // num_threads: count of threads executing tasks including the waiting thread,
+  // so the scheduler starts num_threads - 1 workers, 0 - ppc::util::get_num_threads()
+  explicit Scheduler(int num_threads = 0);
+  Scheduler(const Scheduler &) = delete;
+  Scheduler &operator=(const Scheduler &) = delete;
+  ~Scheduler();
+
+  [[nodiscard]] int size() const { return static_cast<int>(workers_.size()) + 1; }
+  // count of tasks taken from deques of other workers since construction
+  [[nodiscard]] std::size_t steals() const { return steals_.load(std::memory_order_relaxed); }
+
+  static Scheduler &global();
+
+ private:
+  friend class TaskGroup;
+
+  struct Job {
+    std::function<void()> function;
+    TaskGroup *group = nullptr;
+  };
+
+  struct alignas(64) WorkerQueue {
+    std::mutex mutex;
+    std::deque<Job> jobs;
+  };
+
+  void spawn(Job job);
+  // executes one pending job if there is any, returns false otherwise
+  bool try_run_one();
+  // stolen is set when the job comes from another deque or the injection queue
+  bool try_pop(Job &job, bool &stolen);
+  void execute(Job &job);
+  void worker_loop(int worker_index);
+  // index of the current thread among workers of this scheduler, -1 for external threads
+  [[nodiscard]] int current_worker() const;
+
+  std::vector<std::unique_ptr<WorkerQueue>> queues_;
+  WorkerQueue injection_;
+  std::vector<std::thread> workers_;
+  std::atomic<std::size_t> queued_ = 0;
+  std::atomic<std::size_t> steals_ = 0;
+  std::atomic<int> sleeping_ = 0;
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stop_ = false;
+};
+
+// Group of tasks spawned on a Scheduler, like oneapi::tbb::task_group:
+// run() spawns a task, wait() executes pending tasks until all tasks of the
+// group are finished and rethrows the first exception thrown by them.
+class TaskGroup {
+ public:
+  explicit TaskGroup(Scheduler &scheduler = Scheduler::global()) : scheduler_(scheduler) {}
+  TaskGroup(const TaskGroup &) = delete;
+  TaskGroup &operator=(const TaskGroup &) = delete;
+  ~TaskGroup();
+
+  template <class F>
+  void run(F &&function) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    scheduler_.spawn(Scheduler::Job{std::function<void()>(std::forward<F>(function)), this});
+  }
+
+  void wait();
+
+ private:
+  friend class Scheduler;
+
+  Scheduler &scheduler_;
+  std::atomic<std::size_t> pending_ = 0;
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+};
+
+// Calls body(chunk_begin, chunk_end) for chunks of [begin, end) not larger than grain.
+// The range is split recursively, so idle workers steal large halves of uneven work.
+template <class Body>
+void parallel_for(Scheduler &scheduler, std::size_t begin, std::size_t end, std::size_t grain, const Body &body) {
+  if (end - begin <= std::max<std::size_t>(grain, 1) || scheduler.size() == 1) {
+    if (begin < end) body(begin, end);
+    return;
+  }
+  const std::size_t middle = begin + (end - begin) / 2;
+  TaskGroup group(scheduler);
+  group.run([&] { parallel_for(scheduler, middle, end, grain, body); });
+  parallel_for(scheduler, begin, middle, grain, body);
+  group.wait();
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_SCHEDULER_HPP_
@@ -0,0 +1,178 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/scheduler/include/scheduler.hpp"
+
+#include "core/util/include/util.hpp"
+
+namespace {
+
+struct WorkerContext {
+  const ppc::core::Scheduler *scheduler = nullptr;
+  int index = -1;
+};
+
+thread_local WorkerContext worker_context;
+
+// Count of stolen tasks executing on the stack of the current thread. A
+// waiting thread executes stolen tasks on top of its stack, so stealing is
+// limited to keep the stack bounded in deep recursions.
+thread_local int stolen_depth = 0;
+constexpr int max_stolen_depth = 8;
+
+// yields before sleeping, spawned tasks usually follow each other closely
+constexpr int spin_count = 200;
+
+}  // namespace
+
+ppc::core::Scheduler::Scheduler(int num_threads) {
+  if (num_threads <= 0) {
+    num_threads = ppc::util::get_num_threads();
+  }
+  for (int i = 1; i < num_threads; i++) {
+    queues_.push_back(std::make_unique<WorkerQueue>());
+  }
+  workers_.reserve(queues_.size());
+  for (int i = 0; i < num_threads - 1; i++) {
+    workers_.emplace_back(&Scheduler::worker_loop, this, i);
+  }
+}
+
+ppc::core::Scheduler::~Scheduler() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+int ppc::core::Scheduler::current_worker() const {
+  return worker_context.scheduler == this ? worker_context.index : -1;
+}
+
+void ppc::core::Scheduler::spawn(Job job) {
+  if (workers_.empty()) {
+    // single thread, the task is executed right away
+    execute(job);
+    return;
+  }
+  const int worker = current_worker();
+  WorkerQueue &queue = worker >= 0 ? *queues_[worker] : injection_;
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.jobs.push_back(std::move(job));
+  }
+  queued_.fetch_add(1);
+  if (sleeping_.load() > 0) {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    wake_.notify_one();
+  }
+}
+
+bool ppc::core::Scheduler::try_pop(Job &job, bool &stolen) {
+  if (queued_.load(std::memory_order_relaxed) == 0) return false;
+  stolen = false;
+  const int worker = current_worker();
+  // own deque from the back
+  if (worker >= 0) {
+    WorkerQueue &queue = *queues_[worker];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.jobs.empty()) {
+      job = std::move(queue.jobs.back());
+      queue.jobs.pop_back();
+      return true;
+    }
+  }
+  if (stolen_depth >= max_stolen_depth) return false;
+  stolen = true;
+  // tasks of external threads
+  {
+    std::lock_guard<std::mutex> lock(injection_.mutex);
+    if (!injection_.jobs.empty()) {
+      job = std::move(injection_.jobs.front());
+      injection_.jobs.pop_front();
+      return true;
+    }
+  }
+  // steal from the front of other deques starting from the next worker
+  const auto count = queues_.size();
+  const auto first = static_cast<std::size_t>(worker + 1);
+  for (std::size_t i = 0; i < count; i++) {
+    const auto victim = (first + i) % count;
+    if (static_cast<int>(victim) == worker) continue;
+    WorkerQueue &queue = *queues_[victim];
+    std::unique_lock<std::mutex> lock(queue.mutex, std::try_to_lock);
+    if (!lock.owns_lock() || queue.jobs.empty()) continue;
+    job = std::move(queue.jobs.front());
+    queue.jobs.pop_front();
+    steals_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+  return false;
+}
+
+void ppc::core::Scheduler::execute(Job &job) {
+  try {
+    job.function();
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(job.group->error_mutex_);
+    if (!job.group->error_) job.group->error_ = std::current_exception();
+  }
+  job.group->pending_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+bool ppc::core::Scheduler::try_run_one() {
+  Job job;
+  bool stolen = false;
+  if (!try_pop(job, stolen)) return false;
+  queued_.fetch_sub(1);
+  stolen_depth += stolen ? 1 : 0;
+  execute(job);
+  stolen_depth -= stolen ? 1 : 0;
+  return true;
+}
+
+void ppc::core::Scheduler::worker_loop(int worker_index) {
+  worker_context = {this, worker_index};
+  while (true) {
+    int spin = 0;
+    while (spin < spin_count) {
+      if (try_run_one()) {
+        spin = 0;
+      } else {
+        spin++;
+        std::this_thread::yield();
+      }
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    sleeping_.fetch_add(1);
+    wake_.wait(lock, [this] { return stop_ || queued_.load() > 0; });
+    sleeping_.fetch_sub(1);
+    if (stop_) return;
+  }
+}
+
+ppc::core::Scheduler &ppc::core::Scheduler::global() {
+  static Scheduler scheduler(ppc::util::get_num_threads());
+  return scheduler;
+}
+
+ppc::core::TaskGroup::~TaskGroup() {
+  // tasks reference the group, it can not be destroyed before they finish
+  while (pending_.load(std::memory_order_acquire) != 0) {
+    if (!scheduler_.try_run_one()) std::this_thread::yield();
+  }
+}
+
+void ppc::core::TaskGroup::wait() {
+  while (pending_.load(std::memory_order_acquire) != 0) {
+    if (!scheduler_.try_run_one()) std::this_thread::yield();
+  }
+  std::lock_guard<std::mutex> lock(error_mutex_);
+  if (error_) {
+    auto error = error_;
+    error_ = nullptr;
+    std::rethrow_exception(error);
+  }
+}
@@ -0,0 +1,165 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "core/simd/include/simd.hpp"
+
+namespace {
+
+using ppc::core::simd::IsaLevel;
+
+const std::vector<IsaLevel> all_levels = {IsaLevel::scalar, IsaLevel::sse4, IsaLevel::avx2, IsaLevel::avx512};
+
+// sizes around lanes, unrolled steps and search blocks
+const std::vector<std::size_t> sizes = {2, 3, 7, 16, 17, 33, 100, 2047, 2048, 2049, 5000, 10001};
+
+template <class T>
+std::vector<T> random_vector(std::size_t size, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::vector<T> vec(size);
+  if constexpr (std::is_integral_v<T>) {
+    // small range gives repeated extremes and equal distances
+    std::uniform_int_distribution<T> dist(-100, 100);
+    for (auto &value : vec) value = dist(gen);
+  } else {
+    std::uniform_real_distribution<T> dist(-100, 100);
+    for (auto &value : vec) value = std::round(dist(gen) * 4) / 4;
+  }
+  return vec;
+}
+
+template <class T>
+void check_level_matches_scalar(IsaLevel level) {
+  const auto &kernels = ppc::core::simd::kernels<T>(level);
+  ASSERT_EQ(kernels.level, level);
+  using Scalar = ppc::core::simd::ScalarKernels<T>;
+  for (auto size : sizes) {
+    auto a = random_vector<T>(size, static_cast<unsigned>(size));
+    auto b = random_vector<T>(size, static_cast<unsigned>(size) + 1);
+    SCOPED_TRACE(size);
+
+    auto min = kernels.min_element(a.data(), size);
+    EXPECT_EQ(min.index, Scalar::min_element(a.data(), size).index);
+    EXPECT_EQ(min.value, a[min.index]);
+    auto max = kernels.max_element(a.data(), size);
+    EXPECT_EQ(max.index, Scalar::max_element(a.data(), size).index);
+    EXPECT_EQ(max.value, a[max.index]);
+    EXPECT_EQ(kernels.nearest_pair(a.data(), size).index, Scalar::nearest_pair(a.data(), size).index);
+    EXPECT_EQ(kernels.most_different_pair(a.data(), size).index, Scalar::most_different_pair(a.data(), size).index);
+
+    // values are multiples of 0.25 well inside the mantissa, sums are exact in any order
+    for (auto accuracy : {ppc::core::simd::Accuracy::fast, ppc::core::simd::Accuracy::compensated}) {
+      EXPECT_EQ(kernels.sum(a.data(), size, accuracy), Scalar::sum(a.data(), size, accuracy));
+    }
+    if constexpr (std::is_integral_v<T>) {
+      EXPECT_EQ(kernels.dot(a.data(), b.data(), size, ppc::core::simd::Accuracy::fast),
+                Scalar::dot(a.data(), b.data(), size, ppc::core::simd::Accuracy::fast));
+    } else {
+      const auto expected = Scalar::dot(a.data(), b.data(), size, ppc::core::simd::Accuracy::compensated);
+      EXPECT_NEAR(kernels.dot(a.data(), b.data(), size, ppc::core::simd::Accuracy::fast), expected,
+                  1e-4 * std::abs(expected) + 1e-3);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(simd_tests, check_levels_match_scalar) {
+  for (auto level : all_levels) {
+    if (!ppc::core::simd::is_supported(level)) continue;
+    SCOPED_TRACE(ppc::core::to_string(level));
+    check_level_matches_scalar<float>(level);
+    check_level_matches_scalar<double>(level);
+    check_level_matches_scalar<int32_t>(level);
+  }
+}
+
+TEST(simd_tests, check_first_index_of_repeated_extremes) {
+  // equal extremes in different lanes and blocks, the first one is reported
+  std::vector<float> vec(6000, 1.0f);
+  vec[4100] = vec[4107] = vec[5999] = -5.0f;
+  vec[2049] = vec[2050] = 7.0f;
+  for (auto level : all_levels) {
+    if (!ppc::core::simd::is_supported(level)) continue;
+    const auto &kernels = ppc::core::simd::kernels<float>(level);
+    EXPECT_EQ(kernels.min_element(vec.data(), vec.size()).index, 4100U);
+    EXPECT_EQ(kernels.max_element(vec.data(), vec.size()).index, 2049U);
+    EXPECT_EQ(kernels.nearest_pair(vec.data(), vec.size()).index, 0U);
+    EXPECT_EQ(kernels.most_different_pair(vec.data(), vec.size()).index, 2049U - 1);
+  }
+}
+
+TEST(simd_tests, check_compensated_sum_of_floats) {
+  // small terms are lost when they are added to a large partial sum
+  std::vector<float> vec(200000, 1e-8f);
+  vec[0] = 1.0f;
+  const double expected = 1.0 + 1e-8 * (static_cast<double>(vec.size()) - 1);
+  for (auto level : all_levels) {
+    if (!ppc::core::simd::is_supported(level)) continue;
+    SCOPED_TRACE(ppc::core::to_string(level));
+    const auto &kernels = ppc::core::simd::kernels<float>(level);
+    const double fast = kernels.sum(vec.data(), vec.size(), ppc::core::simd::Accuracy::fast);
+    const double compensated = kernels.sum(vec.data(), vec.size(), ppc::core::simd::Accuracy::compensated);
+    EXPECT_NEAR(compensated, expected, 1e-6);
+    EXPECT_LE(std::abs(compensated - expected), std::abs(fast - expected));
+  }
+}
+
+TEST(simd_tests, check_wide_dot_products) {
+  // float partial sums lose the low digits, int32_t products overflow
+  std::vector<float> f(300001, 1000.1f);
+  std::vector<float> ones(f.size(), 1.0f);
+  std::vector<int32_t> i(1001, 46341);
+  const double f_expected = std::inner_product(f.begin(), f.end(), ones.begin(), 0.0);
+  const int64_t i_expected = int64_t{46341} * 46341 * static_cast<int64_t>(i.size());
+  for (auto level : all_levels) {
+    if (!ppc::core::simd::is_supported(level)) continue;
+    SCOPED_TRACE(ppc::core::to_string(level));
+    for (auto accuracy : {ppc::core::simd::Accuracy::fast, ppc::core::simd::Accuracy::compensated}) {
+      EXPECT_EQ(ppc::core::simd::kernels<float>(level).dot(f.data(), ones.data(), f.size(), accuracy), f_expected);
+      EXPECT_EQ(ppc::core::simd::kernels<int32_t>(level).dot(i.data(), i.data(), i.size(), accuracy), i_expected);
+    }
+  }
+}
+
+TEST(simd_tests, check_distances_of_far_apart_values) {
+  // INT32_MIN next to INT32_MAX is 2^32 - 1 apart
+  std::vector<int32_t> vec(100);
+  std::iota(vec.begin(), vec.end(), 0);
+  vec[70] = std::numeric_limits<int32_t>::max();
+  vec[71] = std::numeric_limits<int32_t>::min();
+  for (auto level : all_levels) {
+    if (!ppc::core::simd::is_supported(level)) continue;
+    SCOPED_TRACE(ppc::core::to_string(level));
+    const auto &kernels = ppc::core::simd::kernels<int32_t>(level);
+    const auto most_different = kernels.most_different_pair(vec.data(), vec.size());
+    EXPECT_EQ(most_different.index, 70U);
+    EXPECT_EQ(most_different.value, std::numeric_limits<uint32_t>::max());
+    EXPECT_EQ(kernels.nearest_pair(vec.data(), vec.size()).index, 0U);
+  }
+  std::vector<int64_t> wide = {0, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(), 5};
+  EXPECT_EQ(ppc::core::simd::most_different_pair(wide.data(), wide.size()).index, 1U);
+}
+
+TEST(simd_tests, check_dispatch) {
+  EXPECT_TRUE(ppc::core::simd::is_supported(IsaLevel::scalar));
+  EXPECT_TRUE(ppc::core::simd::is_supported(ppc::core::simd::active_level()));
+  EXPECT_EQ(ppc::core::simd::kernels<double>().level, ppc::core::simd::active_level());
+  for (auto level : all_levels) {
+    if (ppc::core::simd::is_supported(level)) continue;
+    EXPECT_THROW(ppc::core::simd::kernels<float>(level), std::invalid_argument);
+  }
+  // types without vector kernels use the scalar ones
+  std::vector<int64_t> vec = {4, -2, 9, 9, -2};
+  EXPECT_EQ(ppc::core::simd::sum(vec.data(), vec.size()), 18);
+  EXPECT_EQ(ppc::core::simd::min_element(vec.data(), vec.size()).index, 1U);
+  EXPECT_EQ(ppc::core::simd::max_element(vec.data(), vec.size()).index, 2U);
+  EXPECT_EQ(ppc::core::simd::nearest_pair(vec.data(), vec.size()).index, 2U);
+}
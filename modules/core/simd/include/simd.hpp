@@ -0,0 +1,236 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_SIMD_HPP_
+#define MODULES_CORE_INCLUDE_SIMD_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "core/dispatch/include/dispatch.hpp"
+
+namespace ppc::core::simd {
+
+using ppc::core::IsaLevel;
+
+// fast sums use several accumulators in any order, compensated sums of
+// floating point values also keep the rounding error of every addition (Kahan)
+enum class Accuracy { fast, compensated };
+
+// value and index of the first element (or the first pair) with the extreme value
+template <class T>
+struct ArgExtremum {
+  T value;
+  std::size_t index;
+};
+
+namespace detail {
+
+template <class T, class = void>
+struct DotType {
+  using type = T;
+};
+template <class T>
+struct DotType<T, std::enable_if_t<std::is_floating_point_v<T>>> {
+  using type = std::common_type_t<T, double>;
+};
+template <class T>
+struct DotType<T, std::enable_if_t<std::is_integral_v<T>>> {
+  using type = std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>;
+};
+
+template <class T, class = void>
+struct DistanceType {
+  using type = T;
+};
+template <class T>
+struct DistanceType<T, std::enable_if_t<std::is_integral_v<T>>> {
+  using type = std::make_unsigned_t<T>;
+};
+
+}  // namespace detail
+
+// Products are summed in double for floating point values, as
+// std::inner_product with 0.0 does, and in 64-bit integers for integers
+template <class T>
+using dot_type = typename detail::DotType<T>::type;
+// |a - b| of integers fits into the unsigned type of the same width
+template <class T>
+using distance_type = typename detail::DistanceType<T>::type;
+
+// kernels of one instruction set, pair kernels compare |data[i + 1] - data[i]|
+// distances of the size - 1 adjacent pairs, other kernels need size > 0
+template <class T>
+struct KernelTable {
+  IsaLevel level;
+  T (*sum)(const T *data, std::size_t size, Accuracy accuracy);
+  dot_type<T> (*dot)(const T *a, const T *b, std::size_t size, Accuracy accuracy);
+  ArgExtremum<T> (*min_element)(const T *data, std::size_t size);
+  ArgExtremum<T> (*max_element)(const T *data, std::size_t size);
+  ArgExtremum<distance_type<T>> (*nearest_pair)(const T *data, std::size_t size);
+  ArgExtremum<distance_type<T>> (*most_different_pair)(const T *data, std::size_t size);
+};
+
+// types with vector kernels, all other types use ScalarKernels
+template <class T>
+struct has_vector_kernels : std::false_type {};
+template <>
+struct has_vector_kernels<float> : std::true_type {};
+template <>
+struct has_vector_kernels<double> : std::true_type {};
+template <>
+struct has_vector_kernels<int32_t> : std::true_type {};
+
+// true when the CPU and the build support the level
+bool is_supported(IsaLevel level);
+// level of the kernels used by sum(), dot() and others: the highest built
+// level not above ppc::core::isa_level()
+IsaLevel active_level();
+
+// kernels of the level for types with vector kernels, throws
+// std::invalid_argument when the level is not supported
+template <class T>
+const KernelTable<T> &kernels(IsaLevel level);
+// kernels of active_level(), bound with ppc::core::Dispatched on the first call
+template <class T>
+const KernelTable<T> &kernels();
+
+// Portable kernels, distance of a pair is computed as max - min like the vector ones
+template <class T>
+struct ScalarKernels {
+  static T sum(const T *data, std::size_t size, Accuracy accuracy) {
+    T total = 0;
+    T compensation = 0;
+    for (std::size_t i = 0; i < size; i++) {
+      if (std::is_floating_point_v<T> && accuracy == Accuracy::compensated) {
+        const T y = data[i] - compensation;
+        const T t = total + y;
+        compensation = (t - total) - y;
+        total = t;
+      } else {
+        total += data[i];
+      }
+    }
+    return total;
+  }
+
+  static dot_type<T> dot(const T *a, const T *b, std::size_t size, Accuracy accuracy) {
+    using D = dot_type<T>;
+    D total = 0;
+    D compensation = 0;
+    for (std::size_t i = 0; i < size; i++) {
+      const D product = static_cast<D>(a[i]) * static_cast<D>(b[i]);
+      if (std::is_floating_point_v<T> && accuracy == Accuracy::compensated) {
+        const D y = product - compensation;
+        const D t = total + y;
+        compensation = (t - total) - y;
+        total = t;
+      } else {
+        total += product;
+      }
+    }
+    return total;
+  }
+
+  static ArgExtremum<T> min_element(const T *data, std::size_t size) {
+    ArgExtremum<T> result{data[0], 0};
+    for (std::size_t i = 1; i < size; i++) {
+      if (data[i] < result.value) result = {data[i], i};
+    }
+    return result;
+  }
+
+  static ArgExtremum<T> max_element(const T *data, std::size_t size) {
+    ArgExtremum<T> result{data[0], 0};
+    for (std::size_t i = 1; i < size; i++) {
+      if (result.value < data[i]) result = {data[i], i};
+    }
+    return result;
+  }
+
+  // integers are subtracted in the unsigned type, far apart values do not overflow
+  static distance_type<T> distance(T a, T b) {
+    using D = distance_type<T>;
+    const T lo = a < b ? a : b;
+    const T hi = a < b ? b : a;
+    return static_cast<D>(static_cast<D>(hi) - static_cast<D>(lo));
+  }
+
+  static ArgExtremum<distance_type<T>> nearest_pair(const T *data, std::size_t size) {
+    ArgExtremum<distance_type<T>> result{distance(data[0], data[1]), 0};
+    for (std::size_t i = 1; i + 1 < size; i++) {
+      const auto d = distance(data[i], data[i + 1]);
+      if (d < result.value) result = {d, i};
+    }
+    return result;
+  }
+
+  static ArgExtremum<distance_type<T>> most_different_pair(const T *data, std::size_t size) {
+    ArgExtremum<distance_type<T>> result{distance(data[0], data[1]), 0};
+    for (std::size_t i = 1; i + 1 < size; i++) {
+      const auto d = distance(data[i], data[i + 1]);
+      if (result.value < d) result = {d, i};
+    }
+    return result;
+  }
+};
+
+template <class T>
+T sum(const T *data, std::size_t size, Accuracy accuracy = Accuracy::fast) {
+  if constexpr (has_vector_kernels<T>::value) {
+    return kernels<T>().sum(data, size, accuracy);
+  } else {
+    return ScalarKernels<T>::sum(data, size, accuracy);
+  }
+}
+
+template <class T>
+dot_type<T> dot(const T *a, const T *b, std::size_t size, Accuracy accuracy = Accuracy::fast) {
+  if constexpr (has_vector_kernels<T>::value) {
+    return kernels<T>().dot(a, b, size, accuracy);
+  } else {
+    return ScalarKernels<T>::dot(a, b, size, accuracy);
+  }
+}
+
+template <class T>
+ArgExtremum<T> min_element(const T *data, std::size_t size) {
+  if constexpr (has_vector_kernels<T>::value) {
+    return kernels<T>().min_element(data, size);
+  } else {
+    return ScalarKernels<T>::min_element(data, size);
+  }
+}
+
+template <class T>
+ArgExtremum<T> max_element(const T *data, std::size_t size) {
+  if constexpr (has_vector_kernels<T>::value) {
+    return kernels<T>().max_element(data, size);
+  } else {
+    return ScalarKernels<T>::max_element(data, size);
+  }
+}
+
+// needs size >= 2
+template <class T>
+ArgExtremum<distance_type<T>> nearest_pair(const T *data, std::size_t size) {
+  if constexpr (has_vector_kernels<T>::value) {
+    return kernels<T>().nearest_pair(data, size);
+  } else {
+    return ScalarKernels<T>::nearest_pair(data, size);
+  }
+}
+
+// needs size >= 2
+template <class T>
+ArgExtremum<distance_type<T>> most_different_pair(const T *data, std::size_t size) {
+  if constexpr (has_vector_kernels<T>::value) {
+    return kernels<T>().most_different_pair(data, size);
+  } else {
+    return ScalarKernels<T>::most_different_pair(data, size);
+  }
+}
+
+}  // namespace ppc::core::simd
+
+#endif  // MODULES_CORE_INCLUDE_SIMD_HPP_
@@ -0,0 +1,98 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/simd/include/simd.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "core/simd/src/simd_levels.hpp"
+
+namespace {
+
+template <class T>
+const ppc::core::simd::KernelTable<T> &scalar_table() {
+  using Kernels = ppc::core::simd::ScalarKernels<T>;
+  static const ppc::core::simd::KernelTable<T> kernels = {ppc::core::simd::IsaLevel::scalar,
+                                                          Kernels::sum,
+                                                          Kernels::dot,
+                                                          Kernels::min_element,
+                                                          Kernels::max_element,
+                                                          Kernels::nearest_pair,
+                                                          Kernels::most_different_pair};
+  return kernels;
+}
+
+ppc::core::simd::detail::LevelTables level_tables(ppc::core::simd::IsaLevel level) {
+  switch (level) {
+    case ppc::core::simd::IsaLevel::sse4:
+      return ppc::core::simd::detail::sse4_tables();
+    case ppc::core::simd::IsaLevel::avx2:
+      return ppc::core::simd::detail::avx2_tables();
+    case ppc::core::simd::IsaLevel::avx512:
+      return ppc::core::simd::detail::avx512_tables();
+    default:
+      return {};
+  }
+}
+
+template <class T>
+const char *type_name() {
+  if constexpr (std::is_same_v<T, float>) {
+    return "float";
+  } else if constexpr (std::is_same_v<T, double>) {
+    return "double";
+  } else {
+    return "int32_t";
+  }
+}
+
+template <class T>
+const ppc::core::simd::KernelTable<T> *level_table(const ppc::core::simd::detail::LevelTables &tables) {
+  if constexpr (std::is_same_v<T, float>) {
+    return tables.f32;
+  } else if constexpr (std::is_same_v<T, double>) {
+    return tables.f64;
+  } else {
+    return tables.i32;
+  }
+}
+
+}  // namespace
+
+bool ppc::core::simd::is_supported(IsaLevel level) {
+  if (level == IsaLevel::scalar) return true;
+  return ppc::core::cpu_supports(level) && level_tables(level).f32 != nullptr;
+}
+
+ppc::core::simd::IsaLevel ppc::core::simd::active_level() {
+  for (auto level : {IsaLevel::avx512, IsaLevel::avx2, IsaLevel::sse4}) {
+    if (level <= ppc::core::isa_level() && is_supported(level)) return level;
+  }
+  return IsaLevel::scalar;
+}
+
+template <class T>
+const ppc::core::simd::KernelTable<T> &ppc::core::simd::kernels(IsaLevel level) {
+  if (level == IsaLevel::scalar) return scalar_table<T>();
+  if (!is_supported(level)) {
+    throw std::invalid_argument(std::string("SIMD level ") + to_string(level) + " is not supported");
+  }
+  return *level_table<T>(level_tables(level));
+}
+
+template <class T>
+const ppc::core::simd::KernelTable<T> &ppc::core::simd::kernels() {
+  static Dispatched<const KernelTable<T> *> dispatched(std::string("simd<") + type_name<T>() + ">",
+                                                       {{IsaLevel::scalar, &scalar_table<T>()},
+                                                        {IsaLevel::sse4, level_table<T>(detail::sse4_tables())},
+                                                        {IsaLevel::avx2, level_table<T>(detail::avx2_tables())},
+                                                        {IsaLevel::avx512, level_table<T>(detail::avx512_tables())}});
+  return *dispatched.get();
+}
+
+template const ppc::core::simd::KernelTable<float> &ppc::core::simd::kernels<float>(IsaLevel level);
+template const ppc::core::simd::KernelTable<double> &ppc::core::simd::kernels<double>(IsaLevel level);
+template const ppc::core::simd::KernelTable<int32_t> &ppc::core::simd::kernels<int32_t>(IsaLevel level);
+template const ppc::core::simd::KernelTable<float> &ppc::core::simd::kernels<float>();
+template const ppc::core::simd::KernelTable<double> &ppc::core::simd::kernels<double>();
+template const ppc::core::simd::KernelTable<int32_t> &ppc::core::simd::kernels<int32_t>();
@@ -0,0 +1,107 @@
+// Copyright 2024 Nesterov Alexander
+// AVX-512F kernels, the source is compiled with -mavx512f (see modules/core/CMakeLists.txt)
+#include "core/simd/src/simd_levels.hpp"
+
+#if defined(__AVX512F__)
+#if defined(__GNUC__) && !defined(__clang__)
+// min/max intrinsics of GCC 12 pass _mm512_undefined_*() as the masked-off source
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+
+#define PPC_SIMD_AVX512_KERNELS
+
+namespace ppc::core::simd::avx512 {
+
+constexpr IsaLevel level = IsaLevel::avx512;
+
+template <class T>
+struct V;
+
+template <>
+struct V<float> {
+  using reg = __m512;
+  static constexpr std::size_t lanes = 16;
+  static constexpr bool floating = true;
+  static reg zero() { return _mm512_setzero_ps(); }
+  static reg set1(float x) { return _mm512_set1_ps(x); }
+  static reg load(const float *p) { return _mm512_loadu_ps(p); }
+  static void store(float *p, reg r) { _mm512_storeu_ps(p, r); }
+  static reg add(reg a, reg b) { return _mm512_add_ps(a, b); }
+  static reg sub(reg a, reg b) { return _mm512_sub_ps(a, b); }
+  static reg mul(reg a, reg b) { return _mm512_mul_ps(a, b); }
+  static reg min(reg a, reg b) { return _mm512_min_ps(a, b); }
+  static reg max(reg a, reg b) { return _mm512_max_ps(a, b); }
+};
+
+template <>
+struct V<double> {
+  using reg = __m512d;
+  static constexpr std::size_t lanes = 8;
+  static constexpr bool floating = true;
+  static reg zero() { return _mm512_setzero_pd(); }
+  static reg set1(double x) { return _mm512_set1_pd(x); }
+  static reg load(const double *p) { return _mm512_loadu_pd(p); }
+  static void store(double *p, reg r) { _mm512_storeu_pd(p, r); }
+  static reg add(reg a, reg b) { return _mm512_add_pd(a, b); }
+  static reg sub(reg a, reg b) { return _mm512_sub_pd(a, b); }
+  static reg mul(reg a, reg b) { return _mm512_mul_pd(a, b); }
+  static reg min(reg a, reg b) { return _mm512_min_pd(a, b); }
+  static reg max(reg a, reg b) { return _mm512_max_pd(a, b); }
+  // lanes elements converted to double
+  static reg widen(const float *p) { return _mm512_cvtps_pd(_mm256_loadu_ps(p)); }
+  static reg widen(const double *p) { return load(p); }
+};
+
+template <>
+struct V<int32_t> {
+  using reg = __m512i;
+  static constexpr std::size_t lanes = 16;
+  static constexpr bool floating = false;
+  static reg zero() { return _mm512_setzero_si512(); }
+  static reg set1(int32_t x) { return _mm512_set1_epi32(x); }
+  static reg load(const int32_t *p) { return _mm512_loadu_si512(p); }
+  static void store(int32_t *p, reg r) { _mm512_storeu_si512(p, r); }
+  static reg add(reg a, reg b) { return _mm512_add_epi32(a, b); }
+  static reg sub(reg a, reg b) { return _mm512_sub_epi32(a, b); }
+  static reg mul(reg a, reg b) { return _mm512_mullo_epi32(a, b); }
+  static reg min(reg a, reg b) { return _mm512_min_epi32(a, b); }
+  static reg max(reg a, reg b) { return _mm512_max_epi32(a, b); }
+};
+
+template <>
+struct V<int64_t> {
+  using reg = __m512i;
+  static constexpr std::size_t lanes = 8;
+  static constexpr bool floating = false;
+  static reg zero() { return _mm512_setzero_si512(); }
+  static void store(int64_t *p, reg r) { _mm512_storeu_si512(p, r); }
+  static reg add(reg a, reg b) { return _mm512_add_epi64(a, b); }
+  // products of the low 32 bits of lanes, exact for widened int32_t values
+  static reg mul(reg a, reg b) { return _mm512_mul_epi32(a, b); }
+  static reg widen(const int32_t *p) {
+    return _mm512_cvtepi32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)));
+  }
+};
+
+template <>
+struct V<uint32_t> {
+  using reg = __m512i;
+  static constexpr std::size_t lanes = 16;
+  static void store(uint32_t *p, reg r) { _mm512_storeu_si512(p, r); }
+  static reg min(reg a, reg b) { return _mm512_min_epu32(a, b); }
+  static reg max(reg a, reg b) { return _mm512_max_epu32(a, b); }
+};
+
+#include "core/simd/src/simd_kernels.inl"
+
+}  // namespace ppc::core::simd::avx512
+#endif
+
+ppc::core::simd::detail::LevelTables ppc::core::simd::detail::avx512_tables() {
+#ifdef PPC_SIMD_AVX512_KERNELS
+  return {avx512::table<float>(), avx512::table<double>(), avx512::table<int32_t>()};
+#else
+  return {};
+#endif
+}
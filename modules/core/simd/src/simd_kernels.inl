@@ -0,0 +1,237 @@
+// Copyright 2024 Nesterov Alexander
+
+// Kernels written once over a vector type V, included into a namespace of
+// every instruction set after V<T> is defined for float, double and int32_t:
+//   reg, lanes, zero(), set1(x), load(p), store(p, r), add, sub, mul, min, max
+// Dot products accumulate in V<dot_type<T>>, which also has widen(p): lanes
+// elements of T converted to the wider type (double, int64_t). Pair distances
+// of int32_t are searched in V<uint32_t> with store, min and max.
+// The functions are instantiated with the flags of that source only, so
+// nothing from the standard library is used here.
+
+// elements per block of the extreme searches, a block stays in L1 while the
+// index of an improved extreme is searched
+constexpr std::size_t block_size = 2048;
+
+template <class T>
+ArgExtremum<T> make_extremum(T value, std::size_t index) {
+  return {value, index};
+}
+
+// Kahan-Babuska sum of lanes and the compensation of every lane
+template <class T>
+struct Compensated {
+  T total = 0;
+  T compensation = 0;
+
+  void add(T x) {
+    const T t = total + x;
+    const T abs_total = total < 0 ? -total : total;
+    const T abs_x = x < 0 ? -x : x;
+    compensation += abs_total >= abs_x ? (total - t) + x : (x - t) + total;
+    total = t;
+  }
+};
+
+template <class T>
+T reduce_add(typename V<T>::reg r) {
+  T lanes[V<T>::lanes];
+  V<T>::store(lanes, r);
+  T total = 0;
+  for (std::size_t i = 0; i < V<T>::lanes; i++) total += lanes[i];
+  return total;
+}
+
+template <class T, bool Smallest>
+T reduce_extreme(typename V<T>::reg r) {
+  T lanes[V<T>::lanes];
+  V<T>::store(lanes, r);
+  T result = lanes[0];
+  for (std::size_t i = 1; i < V<T>::lanes; i++) {
+    if (Smallest ? lanes[i] < result : result < lanes[i]) result = lanes[i];
+  }
+  return result;
+}
+
+template <class T>
+T sum_fast(const T *data, std::size_t size) {
+  using Vec = V<T>;
+  constexpr std::size_t L = Vec::lanes;
+  // independent accumulators hide the latency of additions
+  auto a0 = Vec::zero();
+  auto a1 = Vec::zero();
+  auto a2 = Vec::zero();
+  auto a3 = Vec::zero();
+  std::size_t i = 0;
+  for (; i + 4 * L <= size; i += 4 * L) {
+    a0 = Vec::add(a0, Vec::load(data + i));
+    a1 = Vec::add(a1, Vec::load(data + i + L));
+    a2 = Vec::add(a2, Vec::load(data + i + 2 * L));
+    a3 = Vec::add(a3, Vec::load(data + i + 3 * L));
+  }
+  for (; i + L <= size; i += L) {
+    a0 = Vec::add(a0, Vec::load(data + i));
+  }
+  T total = reduce_add<T>(Vec::add(Vec::add(a0, a1), Vec::add(a2, a3)));
+  for (; i < size; i++) total += data[i];
+  return total;
+}
+
+// products of widened elements, float and int32_t products are exact
+template <class T>
+dot_type<T> dot_fast(const T *a, const T *b, std::size_t size) {
+  using D = dot_type<T>;
+  using Vec = V<D>;
+  constexpr std::size_t L = Vec::lanes;
+  auto a0 = Vec::zero();
+  auto a1 = Vec::zero();
+  std::size_t i = 0;
+  for (; i + 2 * L <= size; i += 2 * L) {
+    a0 = Vec::add(a0, Vec::mul(Vec::widen(a + i), Vec::widen(b + i)));
+    a1 = Vec::add(a1, Vec::mul(Vec::widen(a + i + L), Vec::widen(b + i + L)));
+  }
+  for (; i + L <= size; i += L) {
+    a0 = Vec::add(a0, Vec::mul(Vec::widen(a + i), Vec::widen(b + i)));
+  }
+  D total = reduce_add<D>(Vec::add(a0, a1));
+  for (; i < size; i++) total += static_cast<D>(a[i]) * static_cast<D>(b[i]);
+  return total;
+}
+
+// Kahan summation in every lane of terms(i), lanes and tail are merged with
+// compensation too
+template <class T, class Load, class Scalar>
+T compensated_sum(std::size_t size, Load load, Scalar scalar) {
+  using Vec = V<T>;
+  constexpr std::size_t L = Vec::lanes;
+  auto total = Vec::zero();
+  auto compensation = Vec::zero();
+  std::size_t i = 0;
+  for (; i + L <= size; i += L) {
+    const auto y = Vec::sub(load(i), compensation);
+    const auto t = Vec::add(total, y);
+    compensation = Vec::sub(Vec::sub(t, total), y);
+    total = t;
+  }
+  T totals[L];
+  T compensations[L];
+  Vec::store(totals, total);
+  Vec::store(compensations, compensation);
+  Compensated<T> result;
+  for (std::size_t k = 0; k < L; k++) {
+    result.add(totals[k]);
+    result.add(-compensations[k]);
+  }
+  for (; i < size; i++) result.add(scalar(i));
+  return result.total + result.compensation;
+}
+
+template <class T>
+T sum(const T *data, std::size_t size, Accuracy accuracy) {
+  if constexpr (V<T>::floating) {
+    if (accuracy == Accuracy::compensated) {
+      return compensated_sum<T>(
+          size, [data](std::size_t i) { return V<T>::load(data + i); }, [data](std::size_t i) { return data[i]; });
+    }
+  }
+  return sum_fast(data, size);
+}
+
+template <class T>
+dot_type<T> dot(const T *a, const T *b, std::size_t size, Accuracy accuracy) {
+  using D = dot_type<T>;
+  if constexpr (V<T>::floating) {
+    if (accuracy == Accuracy::compensated) {
+      return compensated_sum<D>(
+          size, [a, b](std::size_t i) { return V<D>::mul(V<D>::widen(a + i), V<D>::widen(b + i)); },
+          [a, b](std::size_t i) { return static_cast<D>(a[i]) * static_cast<D>(b[i]); });
+    }
+  }
+  return dot_fast(a, b, size);
+}
+
+// extreme of value(i) for i in [begin, end), end - begin > 0
+template <class T, bool Smallest, class Load, class Scalar>
+T block_extreme(std::size_t begin, std::size_t end, Load load, Scalar scalar) {
+  using Vec = V<T>;
+  constexpr std::size_t L = Vec::lanes;
+  T result = scalar(begin);
+  std::size_t i = begin;
+  if (i + L <= end) {
+    auto best = load(i);
+    for (i += L; i + L <= end; i += L) {
+      best = Smallest ? Vec::min(best, load(i)) : Vec::max(best, load(i));
+    }
+    result = reduce_extreme<T, Smallest>(best);
+  }
+  for (; i < end; i++) {
+    const T value = scalar(i);
+    if (Smallest ? value < result : result < value) result = value;
+  }
+  return result;
+}
+
+// first index in [0, size) of the extreme value(i); the block extreme is
+// found with vectors and the index is searched only in improving blocks
+template <class T, bool Smallest, class Load, class Scalar>
+ArgExtremum<T> arg_extreme(std::size_t size, Load load, Scalar scalar) {
+  ArgExtremum<T> result = make_extremum(scalar(0), 0);
+  for (std::size_t begin = 0; begin < size; begin += block_size) {
+    const std::size_t end = begin + block_size < size ? begin + block_size : size;
+    const T value = block_extreme<T, Smallest>(begin, end, load, scalar);
+    if (begin != 0 && !(Smallest ? value < result.value : result.value < value)) continue;
+    // NaN never compares equal, the block is searched to its end at most
+    std::size_t index = begin;
+    while (index + 1 < end && !(scalar(index) == value)) index++;
+    result = make_extremum(scalar(index), index);
+  }
+  return result;
+}
+
+template <class T>
+ArgExtremum<T> min_element(const T *data, std::size_t size) {
+  return arg_extreme<T, true>(
+      size, [data](std::size_t i) { return V<T>::load(data + i); }, [data](std::size_t i) { return data[i]; });
+}
+
+template <class T>
+ArgExtremum<T> max_element(const T *data, std::size_t size) {
+  return arg_extreme<T, false>(
+      size, [data](std::size_t i) { return V<T>::load(data + i); }, [data](std::size_t i) { return data[i]; });
+}
+
+// distances max - min of pairs i, as in ScalarKernels; the int32_t difference
+// wraps into the exact uint32_t distance, which is compared unsigned
+template <class T, bool Smallest>
+ArgExtremum<distance_type<T>> extreme_pair(const T *data, std::size_t size) {
+  using Vec = V<T>;
+  using D = distance_type<T>;
+  auto load = [data](std::size_t i) {
+    const auto a = Vec::load(data + i);
+    const auto b = Vec::load(data + i + 1);
+    return Vec::sub(Vec::max(a, b), Vec::min(a, b));
+  };
+  auto scalar = [data](std::size_t i) {
+    const T lo = data[i] < data[i + 1] ? data[i] : data[i + 1];
+    const T hi = data[i] < data[i + 1] ? data[i + 1] : data[i];
+    return static_cast<D>(static_cast<D>(hi) - static_cast<D>(lo));
+  };
+  return arg_extreme<D, Smallest>(size - 1, load, scalar);
+}
+
+template <class T>
+ArgExtremum<distance_type<T>> nearest_pair(const T *data, std::size_t size) {
+  return extreme_pair<T, true>(data, size);
+}
+
+template <class T>
+ArgExtremum<distance_type<T>> most_different_pair(const T *data, std::size_t size) {
+  return extreme_pair<T, false>(data, size);
+}
+
+template <class T>
+const KernelTable<T> *table() {
+  static const KernelTable<T> kernels = {
+      level, sum<T>, dot<T>, min_element<T>, max_element<T>, nearest_pair<T>, most_different_pair<T>};
+  return &kernels;
+}
@@ -0,0 +1,24 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_SRC_SIMD_LEVELS_HPP_
+#define MODULES_CORE_SRC_SIMD_LEVELS_HPP_
+
+#include "core/simd/include/simd.hpp"
+
+namespace ppc::core::simd::detail {
+
+// kernels built into the library for one level, nullptr when the compiler
+// did not target the instruction set
+struct LevelTables {
+  const KernelTable<float> *f32 = nullptr;
+  const KernelTable<double> *f64 = nullptr;
+  const KernelTable<int32_t> *i32 = nullptr;
+};
+
+LevelTables sse4_tables();
+LevelTables avx2_tables();
+LevelTables avx512_tables();
+
+}  // namespace ppc::core::simd::detail
+
+#endif  // MODULES_CORE_SRC_SIMD_LEVELS_HPP_
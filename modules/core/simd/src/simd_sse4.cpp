@@ -0,0 +1,105 @@
+// Copyright 2024 Nesterov Alexander
+// SSE4.1 kernels, the source is compiled with -msse4.1 (see modules/core/CMakeLists.txt)
+#include "core/simd/src/simd_levels.hpp"
+
+#if defined(__SSE4_1__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64)))
+#include <immintrin.h>
+
+#define PPC_SIMD_SSE4_KERNELS
+
+namespace ppc::core::simd::sse4 {
+
+constexpr IsaLevel level = IsaLevel::sse4;
+
+template <class T>
+struct V;
+
+template <>
+struct V<float> {
+  using reg = __m128;
+  static constexpr std::size_t lanes = 4;
+  static constexpr bool floating = true;
+  static reg zero() { return _mm_setzero_ps(); }
+  static reg set1(float x) { return _mm_set1_ps(x); }
+  static reg load(const float *p) { return _mm_loadu_ps(p); }
+  static void store(float *p, reg r) { _mm_storeu_ps(p, r); }
+  static reg add(reg a, reg b) { return _mm_add_ps(a, b); }
+  static reg sub(reg a, reg b) { return _mm_sub_ps(a, b); }
+  static reg mul(reg a, reg b) { return _mm_mul_ps(a, b); }
+  static reg min(reg a, reg b) { return _mm_min_ps(a, b); }
+  static reg max(reg a, reg b) { return _mm_max_ps(a, b); }
+};
+
+template <>
+struct V<double> {
+  using reg = __m128d;
+  static constexpr std::size_t lanes = 2;
+  static constexpr bool floating = true;
+  static reg zero() { return _mm_setzero_pd(); }
+  static reg set1(double x) { return _mm_set1_pd(x); }
+  static reg load(const double *p) { return _mm_loadu_pd(p); }
+  static void store(double *p, reg r) { _mm_storeu_pd(p, r); }
+  static reg add(reg a, reg b) { return _mm_add_pd(a, b); }
+  static reg sub(reg a, reg b) { return _mm_sub_pd(a, b); }
+  static reg mul(reg a, reg b) { return _mm_mul_pd(a, b); }
+  static reg min(reg a, reg b) { return _mm_min_pd(a, b); }
+  static reg max(reg a, reg b) { return _mm_max_pd(a, b); }
+  // lanes elements converted to double
+  static reg widen(const float *p) {
+    return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(p))));
+  }
+  static reg widen(const double *p) { return load(p); }
+};
+
+template <>
+struct V<int32_t> {
+  using reg = __m128i;
+  static constexpr std::size_t lanes = 4;
+  static constexpr bool floating = false;
+  static reg zero() { return _mm_setzero_si128(); }
+  static reg set1(int32_t x) { return _mm_set1_epi32(x); }
+  static reg load(const int32_t *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+  static void store(int32_t *p, reg r) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), r); }
+  static reg add(reg a, reg b) { return _mm_add_epi32(a, b); }
+  static reg sub(reg a, reg b) { return _mm_sub_epi32(a, b); }
+  static reg mul(reg a, reg b) { return _mm_mullo_epi32(a, b); }
+  static reg min(reg a, reg b) { return _mm_min_epi32(a, b); }
+  static reg max(reg a, reg b) { return _mm_max_epi32(a, b); }
+};
+
+template <>
+struct V<int64_t> {
+  using reg = __m128i;
+  static constexpr std::size_t lanes = 2;
+  static constexpr bool floating = false;
+  static reg zero() { return _mm_setzero_si128(); }
+  static void store(int64_t *p, reg r) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), r); }
+  static reg add(reg a, reg b) { return _mm_add_epi64(a, b); }
+  // products of the low 32 bits of lanes, exact for widened int32_t values
+  static reg mul(reg a, reg b) { return _mm_mul_epi32(a, b); }
+  static reg widen(const int32_t *p) {
+    return _mm_cvtepi32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(p)));
+  }
+};
+
+template <>
+struct V<uint32_t> {
+  using reg = __m128i;
+  static constexpr std::size_t lanes = 4;
+  static void store(uint32_t *p, reg r) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), r); }
+  static reg min(reg a, reg b) { return _mm_min_epu32(a, b); }
+  static reg max(reg a, reg b) { return _mm_max_epu32(a, b); }
+};
+
+#include "core/simd/src/simd_kernels.inl"
+
+}  // namespace ppc::core::simd::sse4
+#endif
+
+ppc::core::simd::detail::LevelTables ppc::core::simd::detail::sse4_tables() {
+#ifdef PPC_SIMD_SSE4_KERNELS
+  return {sse4::table<float>(), sse4::table<double>(), sse4::table<int32_t>()};
+#else
+  return {};
+#endif
+}
@@ -0,0 +1,126 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_TESTS_SPARSE_TASK_TESTS_HPP_
+#define MODULES_CORE_TESTS_SPARSE_TASK_TESTS_HPP_
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+#include "core/task/include/task.hpp"
+#include "ref/sparse_matrix_vector_product/include/ref_task.hpp"
+#include "ref/sparse_row_sums/include/ref_task.hpp"
+
+// Cases shared by the sparse matrix tasks of the omp, tbb, stl and mpi
+// backends, every backend runs them on its own task classes. has_inputs is
+// false on the ranks that get no inputs, results are checked where it is true.
+namespace ppc::test::sparse {
+
+using Sparse = ppc::core::SparseMatrix<double, uint64_t>;
+using Shapes = std::vector<std::pair<std::size_t, std::size_t>>;
+
+// Integer values keep the results exact in any order of additions. Rows
+// get more nonzeros towards the end, so row counts and nonzero counts split differently.
+inline Sparse random_sparse(std::size_t rows, std::size_t cols, ppc::core::SparseFormat format) {
+  std::mt19937 gen(static_cast<unsigned>(rows * cols));
+  std::uniform_int_distribution<int> value(-9, 9);
+  std::uniform_int_distribution<std::size_t> percent(0, 99);
+  std::vector<double> dense(rows * cols);
+  for (std::size_t i = 0; i < rows; i++) {
+    for (std::size_t j = 0; j < cols; j++) {
+      if (percent(gen) * rows < 30 * i) dense[i * cols + j] = value(gen);
+    }
+  }
+  return Sparse::from_dense(ppc::core::MatrixView<double>::row_major(dense.data(), rows, cols), format);
+}
+
+// x is the vector of the product, nullptr for row sums
+template <class Task>
+std::vector<double> run_task(const Sparse &matrix, const std::vector<double> *x, bool has_inputs = true) {
+  auto shape = matrix.shape();
+  auto values = matrix.values;
+  auto indices = matrix.indices;
+  auto offsets = matrix.offsets;
+  auto vector = x != nullptr ? *x : std::vector<double>();
+  std::vector<double> out(matrix.rows);
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  if (has_inputs) {
+    taskData->add_input(values);
+    taskData->add_input(indices);
+    taskData->add_input(offsets);
+    taskData->add_input(shape);
+    if (x != nullptr) taskData->add_input(vector);
+    taskData->add_output(out);
+  }
+  Task task(taskData);
+  EXPECT_TRUE(task.validation());
+  task.pre_processing();
+  task.run();
+  task.post_processing();
+  return out;
+}
+
+inline const Shapes &default_shapes() {
+  static const Shapes shapes = {{1, 1}, {3, 400}, {400, 3}, {37, 38}, {500, 300}};
+  return shapes;
+}
+
+template <class RowSums, class Product>
+void check_results_match_reference(const Shapes &shapes = default_shapes(), bool has_inputs = true) {
+  for (const auto &[rows, cols] : shapes) {
+    for (auto format : {ppc::core::SparseFormat::CSR, ppc::core::SparseFormat::CSC}) {
+      auto matrix = random_sparse(rows, cols, format);
+      std::vector<double> x(cols);
+      for (std::size_t j = 0; j < x.size(); j++) x[j] = static_cast<double>(j % 7) - 3.0;
+      auto sums = run_task<RowSums>(matrix, nullptr, has_inputs);
+      auto product = run_task<Product>(matrix, &x, has_inputs);
+      if (!has_inputs) continue;
+      EXPECT_EQ(sums, (run_task<ppc::reference::SparseRowSums<double, uint64_t>>(matrix, nullptr)));
+      EXPECT_EQ(product, (run_task<ppc::reference::SparseMatrixVectorProduct<double, uint64_t>>(matrix, &x)));
+    }
+  }
+}
+
+template <class RowSums>
+void check_empty_rows_and_columns(bool has_inputs = true) {
+  // only the last row and the last column hold values
+  std::vector<double> dense(100 * 80);
+  for (std::size_t j = 0; j < 80; j++) dense[99 * 80 + j] = 1.0;
+  for (std::size_t i = 0; i < 100; i++) dense[i * 80 + 79] = 2.0;
+  std::vector<double> expected(100, 2.0);
+  expected[99] = 81.0;
+  for (auto format : {ppc::core::SparseFormat::CSR, ppc::core::SparseFormat::CSC}) {
+    auto matrix = Sparse::from_dense(ppc::core::MatrixView<double>::row_major(dense.data(), 100, 80), format);
+    auto sums = run_task<RowSums>(matrix, nullptr, has_inputs);
+    if (has_inputs) {
+      EXPECT_EQ(sums, expected);
+    }
+  }
+}
+
+// the product task given no vector, validation() is expected to fail where has_inputs is true
+template <class Product>
+void check_validation(bool has_inputs = true) {
+  auto matrix = random_sparse(10, 10, ppc::core::SparseFormat::CSR);
+  auto shape = matrix.shape();
+  std::vector<double> out(10);
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  if (has_inputs) {
+    taskData->add_input(matrix.values);
+    taskData->add_input(matrix.indices);
+    taskData->add_input(matrix.offsets);
+    taskData->add_input(shape);
+    taskData->add_output(out);
+  }
+  Product task(taskData);
+  EXPECT_EQ(task.validation(), !has_inputs);
+}
+
+}  // namespace ppc::test::sparse
+
+#endif  // MODULES_CORE_TESTS_SPARSE_TASK_TESTS_HPP_
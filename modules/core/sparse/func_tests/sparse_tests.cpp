@@ -0,0 +1,137 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+
+namespace {
+
+using ppc::core::SparseFormat;
+using Sparse = ppc::core::SparseMatrix<double, uint64_t>;
+
+// about one element of seven is nonzero, row 3 is dense and row 5 is empty
+std::vector<double> make_dense(std::size_t rows, std::size_t cols) {
+  std::vector<double> dense(rows * cols);
+  for (std::size_t i = 0; i < rows; i++) {
+    for (std::size_t j = 0; j < cols; j++) {
+      const bool nonzero = (i == 3 || (i * 5 + j * 3) % 7 == 0) && i != 5;
+      dense[i * cols + j] = nonzero ? static_cast<double>((i + 2 * j) % 9) - 4.0 : 0.0;
+    }
+  }
+  return dense;
+}
+
+std::vector<double> dense_product(const std::vector<double> &dense, std::size_t rows, std::size_t cols,
+                                  const std::vector<double> &x) {
+  std::vector<double> y(rows);
+  for (std::size_t i = 0; i < rows; i++) {
+    for (std::size_t j = 0; j < cols; j++) y[i] += dense[i * cols + j] * x[j];
+  }
+  return y;
+}
+
+std::vector<double> split_product(const Sparse &matrix, const double *x, std::size_t parts) {
+  ppc::core::SparseProduct<double, uint64_t> product(matrix.view(), x, parts);
+  std::vector<double> y(product.size());
+  for (std::size_t part = 0; part < product.parts(); part++) product.run(part, y.data());
+  product.finish(y.data());
+  return y;
+}
+
+}  // namespace
+
+TEST(sparse_tests, check_from_dense) {
+  // 2 x 3 matrix {{1, 0, 2}, {0, 0, 3}}
+  std::vector<double> dense = {1, 0, 2, 0, 0, 3};
+  auto view = ppc::core::MatrixView<double>::row_major(dense.data(), 2, 3);
+  auto csr = Sparse::from_dense(view, SparseFormat::CSR);
+  EXPECT_EQ(csr.values, (std::vector<double>{1, 2, 3}));
+  EXPECT_EQ(csr.indices, (std::vector<uint64_t>{0, 2, 2}));
+  EXPECT_EQ(csr.offsets, (std::vector<uint64_t>{0, 2, 3}));
+  auto csc = Sparse::from_dense(view, SparseFormat::CSC);
+  EXPECT_EQ(csc.values, (std::vector<double>{1, 2, 3}));
+  EXPECT_EQ(csc.indices, (std::vector<uint64_t>{0, 0, 1}));
+  EXPECT_EQ(csc.offsets, (std::vector<uint64_t>{0, 1, 1, 3}));
+  EXPECT_EQ(csc.shape(), (std::vector<uint64_t>{2, 3, 1}));
+}
+
+TEST(sparse_tests, check_nnz_balanced_chunks) {
+  // one heavy line among light ones
+  std::vector<uint64_t> offsets = {0, 1, 2, 102, 103, 104, 105, 106, 107};
+  const std::size_t lines = offsets.size() - 1;
+  std::size_t previous_end = 0;
+  for (std::size_t part = 0; part < 4; part++) {
+    auto [begin, end] = ppc::core::nnz_balanced_chunk(offsets.data(), lines, 4, part);
+    EXPECT_EQ(begin, previous_end);
+    previous_end = end;
+  }
+  EXPECT_EQ(previous_end, lines);
+  // the first chunk ends with the heavy line, the light lines after it are below one share
+  EXPECT_EQ(ppc::core::nnz_balanced_chunk(offsets.data(), lines, 4, 0).second, 3U);
+  EXPECT_EQ(ppc::core::nnz_balanced_chunk(offsets.data(), lines, 4, 3).second, lines);
+}
+
+TEST(sparse_tests, check_products_of_both_formats) {
+  const std::size_t rows = 300;
+  const std::size_t cols = 170;
+  auto dense = make_dense(rows, cols);
+  std::vector<double> x(cols);
+  for (std::size_t j = 0; j < cols; j++) x[j] = static_cast<double>(j % 5) - 2.0;
+  const std::vector<double> ones(cols, 1.0);
+  auto view = ppc::core::MatrixView<double>::row_major(dense.data(), rows, cols);
+  for (auto format : {SparseFormat::CSR, SparseFormat::CSC}) {
+    auto matrix = Sparse::from_dense(view, format);
+    for (std::size_t parts : {1, 3, 16}) {
+      EXPECT_EQ(split_product(matrix, x.data(), parts), dense_product(dense, rows, cols, x));
+      EXPECT_EQ(split_product(matrix, nullptr, parts), dense_product(dense, rows, cols, ones));
+    }
+  }
+}
+
+TEST(sparse_tests, check_thread_pool_product) {
+  ppc::core::ThreadPool pool(3);
+  const std::size_t rows = 1000;
+  const std::size_t cols = 40;
+  auto dense = make_dense(rows, cols);
+  std::vector<double> x(cols, 2.0);
+  auto view = ppc::core::MatrixView<double>::row_major(dense.data(), rows, cols);
+  for (auto format : {SparseFormat::CSR, SparseFormat::CSC}) {
+    auto matrix = Sparse::from_dense(view, format);
+    std::vector<double> y(rows);
+    ppc::core::sparse_product(pool, matrix.view(), x.data(), y.data());
+    EXPECT_EQ(y, dense_product(dense, rows, cols, x));
+  }
+}
+
+TEST(sparse_tests, check_task_structure) {
+  std::vector<double> dense = {1, 0, 2, 0, 0, 3};
+  auto matrix = Sparse::from_dense(ppc::core::MatrixView<double>::row_major(dense.data(), 2, 3), SparseFormat::CSR);
+  auto shape = matrix.shape();
+  std::vector<double> out(2);
+  ppc::core::TaskData taskData;
+  taskData.add_input(matrix.values);
+  taskData.add_input(matrix.indices);
+  taskData.add_input(matrix.offsets);
+  taskData.add_input(shape);
+  taskData.add_output(out);
+  EXPECT_TRUE(ppc::core::check_sparse_task<uint64_t>(taskData, false));
+  // product needs the vector
+  EXPECT_FALSE(ppc::core::check_sparse_task<uint64_t>(taskData, true));
+
+  // column index outside of the row
+  matrix.indices[1] = 3;
+  EXPECT_FALSE(ppc::core::check_sparse_task<uint64_t>(taskData, false));
+  matrix.indices[1] = 2;
+  // offsets go back
+  matrix.offsets[1] = 4;
+  EXPECT_FALSE(ppc::core::check_sparse_task<uint64_t>(taskData, false));
+  matrix.offsets[1] = 2;
+  // CSC of 3 columns needs 4 offsets
+  shape[2] = 1;
+  EXPECT_FALSE(ppc::core::check_sparse_task<uint64_t>(taskData, false));
+  // unknown format
+  shape[2] = 2;
+  EXPECT_FALSE(ppc::core::check_sparse_task<uint64_t>(taskData, false));
+}
@@ -0,0 +1,242 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_SPARSE_HPP_
+#define MODULES_CORE_INCLUDE_SPARSE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "core/matrix_reduce/include/matrix_reduce.hpp"
+#include "core/simd/include/simd.hpp"
+#include "core/task/include/task.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace ppc::core {
+
+// CSR stores rows one after another, CSC stores columns
+enum class SparseFormat : std::uint64_t { CSR = 0, CSC = 1 };
+
+// Compressed matrix in place. Line k (row for CSR, column for CSC) holds
+// values[offsets[k] .. offsets[k + 1]), indices are the positions of the
+// values inside their line.
+template <class T, class IndexType>
+struct SparseMatrixView {
+  SparseFormat format = SparseFormat::CSR;
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  const T *values = nullptr;
+  const IndexType *indices = nullptr;
+  const IndexType *offsets = nullptr;
+
+  // count of compressed lines and length of every line
+  [[nodiscard]] std::size_t lines() const { return format == SparseFormat::CSR ? rows : cols; }
+  [[nodiscard]] std::size_t line_length() const { return format == SparseFormat::CSR ? cols : rows; }
+  [[nodiscard]] std::size_t nnz() const { return static_cast<std::size_t>(offsets[lines()]); }
+  [[nodiscard]] std::size_t line_begin(std::size_t line) const { return static_cast<std::size_t>(offsets[line]); }
+};
+
+// Owning compressed matrix, the storage of SparseMatrixView
+template <class T, class IndexType>
+struct SparseMatrix {
+  SparseFormat format = SparseFormat::CSR;
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  std::vector<T> values;
+  std::vector<IndexType> indices;
+  std::vector<IndexType> offsets = {0};
+
+  // nonzero elements of a dense matrix in any layout
+  static SparseMatrix from_dense(const MatrixView<T> &dense, SparseFormat format) {
+    SparseMatrix matrix;
+    matrix.format = format;
+    matrix.rows = dense.rows;
+    matrix.cols = dense.cols;
+    const bool csr = format == SparseFormat::CSR;
+    const std::size_t lines = csr ? dense.rows : dense.cols;
+    const std::size_t length = csr ? dense.cols : dense.rows;
+    matrix.offsets.reserve(lines + 1);
+    for (std::size_t line = 0; line < lines; line++) {
+      for (std::size_t k = 0; k < length; k++) {
+        const T &value = csr ? dense(line, k) : dense(k, line);
+        if (value == T{}) continue;
+        matrix.values.push_back(value);
+        matrix.indices.push_back(static_cast<IndexType>(k));
+      }
+      matrix.offsets.push_back(static_cast<IndexType>(matrix.values.size()));
+    }
+    return matrix;
+  }
+
+  [[nodiscard]] SparseMatrixView<T, IndexType> view() const {
+    return {format, rows, cols, values.data(), indices.data(), offsets.data()};
+  }
+
+  // shape input of sparse tasks
+  [[nodiscard]] std::vector<IndexType> shape() const {
+    return {static_cast<IndexType>(rows), static_cast<IndexType>(cols), static_cast<IndexType>(format)};
+  }
+};
+
+// Bounds of the index-th of parts chunks of lines [0, lines) with about
+// nnz / parts nonzeros each, a line is never split. Long lines make some
+// chunks larger, empty lines cost nothing.
+template <class IndexType>
+std::pair<std::size_t, std::size_t> nnz_balanced_chunk(const IndexType *offsets, std::size_t lines,
+                                                       std::size_t parts, std::size_t index) {
+  const auto nnz = static_cast<std::size_t>(offsets[lines]);
+  auto boundary = [&](std::size_t part) -> std::size_t {
+    if (part == 0) return 0;
+    if (part >= parts) return lines;
+    // first line starting at or after the part's share of nonzeros
+    const auto target = static_cast<IndexType>(nnz / parts * part + nnz % parts * part / parts);
+    return static_cast<std::size_t>(std::lower_bound(offsets, offsets + lines, target) - offsets);
+  };
+  return {boundary(index), boundary(index + 1)};
+}
+
+namespace detail {
+
+// shorter rows are reduced without the vector kernels
+inline constexpr std::size_t sparse_short_row = 16;
+
+}  // namespace detail
+
+// y = A x split into parts with balanced counts of nonzeros, x of nullptr
+// stands for the vector of ones (row sums):
+//   SparseProduct<T, IndexType> product(matrix, x, parts);
+//   run(part, y) for every part, concurrently
+//   finish(y)    after all parts
+// CSR parts own their rows and write y directly. CSC parts own columns
+// which scatter into every row, so they accumulate private copies of y
+// combined by finish() in order of parts, taken from the scratch arena when
+// one is given.
+template <class T, class IndexType>
+class SparseProduct {
+ public:
+  SparseProduct(const SparseMatrixView<T, IndexType> &matrix, const T *x, std::size_t parts, Arena *scratch = nullptr)
+      : matrix_(matrix), x_(x) {
+    parts_ = std::max<std::size_t>(std::min(parts, matrix_.lines()), 1);
+    if (matrix_.format == SparseFormat::CSC && parts_ > 1) {
+      partials_.allocate(parts_, matrix_.rows, scratch);
+    }
+  }
+
+  // count of results
+  [[nodiscard]] std::size_t size() const { return matrix_.rows; }
+  [[nodiscard]] std::size_t parts() const { return parts_; }
+
+  void run(std::size_t part, T *y) {
+    auto [begin, end] = nnz_balanced_chunk(matrix_.offsets, matrix_.lines(), parts_, part);
+    if (matrix_.format == SparseFormat::CSR) {
+      for (std::size_t row = begin; row < end; row++) y[row] = row_value(row);
+      return;
+    }
+    T *out = partials_.empty() ? y : partials_[part];
+    std::fill(out, out + matrix_.rows, T{});
+    for (std::size_t col = begin; col < end; col++) {
+      const T scale = x_ != nullptr ? x_[col] : T{1};
+      for (auto k = matrix_.line_begin(col); k < matrix_.line_begin(col + 1); k++) {
+        out[static_cast<std::size_t>(matrix_.indices[k])] += matrix_.values[k] * scale;
+      }
+    }
+  }
+
+  void finish(T *y) const {
+    if (!partials_.empty()) partials_.combine(y);
+  }
+
+ private:
+  T row_value(std::size_t row) const {
+    const auto begin = matrix_.line_begin(row);
+    const auto length = matrix_.line_begin(row + 1) - begin;
+    const T *values = matrix_.values + begin;
+    if (x_ == nullptr && length >= detail::sparse_short_row) {
+      return simd::sum(values, length);
+    }
+    T sum{};
+    if (x_ == nullptr) {
+      for (std::size_t k = 0; k < length; k++) sum += values[k];
+    } else {
+      const IndexType *indices = matrix_.indices + begin;
+      for (std::size_t k = 0; k < length; k++) sum += values[k] * x_[static_cast<std::size_t>(indices[k])];
+    }
+    return sum;
+  }
+
+  SparseMatrixView<T, IndexType> matrix_;
+  const T *x_;
+  std::size_t parts_ = 1;
+  detail::PartialRows<T> partials_;
+};
+
+// sequential product
+template <class T, class IndexType>
+void sparse_product(const SparseMatrixView<T, IndexType> &matrix, const T *x, T *y) {
+  SparseProduct<T, IndexType> product(matrix, x, 1);
+  product.run(0, y);
+  product.finish(y);
+}
+
+// product on the pool threads
+template <class T, class IndexType>
+void sparse_product(ThreadPool &pool, const SparseMatrixView<T, IndexType> &matrix, const T *x, T *y,
+                    Arena *scratch = nullptr) {
+  SparseProduct<T, IndexType> product(matrix, x, static_cast<std::size_t>(pool.size()), scratch);
+  pool.run([&](int thread_index) {
+    const auto part = static_cast<std::size_t>(thread_index);
+    if (part < product.parts()) product.run(part, y);
+  });
+  product.finish(y);
+}
+
+// Sparse matrix of TaskData: inputs[0] - values, inputs[1] - indices,
+// inputs[2] - offsets (lines + 1 of them), inputs[3] - shape {rows, cols, format}
+// with format 0 for CSR and 1 for CSC. A product task has the vector x of cols
+// elements in inputs[4]. outputs[0] holds rows results.
+template <class IndexType>
+bool check_sparse_task(const TaskData &taskData, bool has_vector) {
+  if (taskData.inputs.size() != (has_vector ? 5U : 4U) || taskData.outputs.size() != 1) return false;
+  if (taskData.inputs_count[3] != 3) return false;
+  const auto *shape = reinterpret_cast<const IndexType *>(taskData.inputs[3]);
+  if (static_cast<std::uint64_t>(shape[2]) > static_cast<std::uint64_t>(SparseFormat::CSC)) return false;
+  const auto rows = static_cast<std::size_t>(shape[0]);
+  const auto cols = static_cast<std::size_t>(shape[1]);
+  const bool csr = static_cast<SparseFormat>(shape[2]) == SparseFormat::CSR;
+  const std::size_t lines = csr ? rows : cols;
+  const std::size_t line_length = csr ? cols : rows;
+  // 64-bit counts of the buffers, inputs_count saturates for more than UINT32_MAX elements
+  const auto count = [&](std::size_t i) { return static_cast<std::size_t>(taskData.input_buffer(i).count); };
+  if (count(2) != lines + 1 || taskData.output_buffer(0).count != rows) return false;
+  if (has_vector && count(4) != cols) return false;
+
+  const auto *offsets = reinterpret_cast<const IndexType *>(taskData.inputs[2]);
+  const auto nnz = static_cast<std::size_t>(offsets[lines]);
+  if (offsets[0] != 0 || count(0) != nnz || count(1) != nnz) return false;
+  for (std::size_t line = 0; line < lines; line++) {
+    if (offsets[line + 1] < offsets[line]) return false;
+  }
+  const auto *indices = reinterpret_cast<const IndexType *>(taskData.inputs[1]);
+  return std::all_of(indices, indices + nnz,
+                     [&](IndexType index) { return static_cast<std::size_t>(index) < line_length; });
+}
+
+// view of the matrix checked by check_sparse_task()
+template <class T, class IndexType>
+SparseMatrixView<T, IndexType> sparse_input(const TaskData &taskData) {
+  const auto *shape = reinterpret_cast<const IndexType *>(taskData.inputs[3]);
+  SparseMatrixView<T, IndexType> matrix;
+  matrix.format = static_cast<SparseFormat>(shape[2]);
+  matrix.rows = static_cast<std::size_t>(shape[0]);
+  matrix.cols = static_cast<std::size_t>(shape[1]);
+  matrix.values = taskData.input_view<T>(0).data();
+  matrix.indices = taskData.input_view<IndexType>(1).data();
+  matrix.offsets = taskData.input_view<IndexType>(2).data();
+  return matrix;
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_SPARSE_HPP_
@@ -0,0 +1,180 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/neighbor_scan/include/neighbor_scan.hpp"
+#include "core/stream/include/stream.hpp"
+
+namespace {
+
+std::vector<int> make_input(std::size_t size) {
+  std::vector<int> in(size);
+  for (std::size_t i = 0; i < size; i++) in[i] = static_cast<int>((i * 7919) % 201) - 100;
+  return in;
+}
+
+// file in the temporary directory removed at the end of the test
+class TempFile {
+ public:
+  explicit TempFile(const std::vector<int> &data)
+      : path_(std::filesystem::temp_directory_path() /
+              ("ppc_stream_" + std::to_string(reinterpret_cast<std::uintptr_t>(this)) + ".bin")) {
+    std::ofstream file(path_, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(int)));
+  }
+  ~TempFile() { std::filesystem::remove(path_); }
+  [[nodiscard]] std::string path() const { return path_.string(); }
+
+ private:
+  std::filesystem::path path_;
+};
+
+std::vector<int> read_all(ppc::core::ChunkSource &source, std::size_t chunk) {
+  ppc::core::ChunkStream<int> stream(source, chunk);
+  std::vector<int> out;
+  for (auto part = stream.next(); !part.empty(); part = stream.next()) {
+    EXPECT_LE(part.size(), chunk);
+    out.insert(out.end(), part.begin(), part.end());
+  }
+  // the end is reported again
+  EXPECT_TRUE(stream.next().empty());
+  return out;
+}
+
+// returns 1 to 7 elements per read, like a pipe or a socket
+class ShortReadSource : public ppc::core::MemorySource<int> {
+ public:
+  using MemorySource::MemorySource;
+  std::size_t read(void *dst, std::size_t count) override {
+    reads_++;
+    return MemorySource::read(dst, std::min<std::size_t>(count, reads_ % 7 + 1));
+  }
+
+ private:
+  std::size_t reads_ = 0;
+};
+
+}  // namespace
+
+TEST(stream_tests, check_sources_deliver_all_elements) {
+  const auto in = make_input(10007);
+  TempFile file(in);
+  ppc::core::MemorySource<int> memory(in);
+  ppc::core::FileSource<int> stream_file(file.path());
+  ppc::core::MappedFileSource<int> mapped(file.path());
+  ppc::core::GeneratorSource<int> generator(in.size(), [&](std::uint64_t first, int *dst, std::size_t count) {
+    std::copy_n(in.begin() + static_cast<std::ptrdiff_t>(first), count, dst);
+  });
+  std::vector<ppc::core::ChunkSource *> sources = {&memory, &stream_file, &mapped, &generator};
+  for (auto *source : sources) {
+    EXPECT_EQ(source->count(), in.size());
+    for (std::size_t chunk : {1, 1000, 20000}) {
+      // every stream starts a new pass
+      EXPECT_EQ(read_all(*source, chunk), in);
+    }
+  }
+}
+
+TEST(stream_tests, check_reductions_match_in_memory) {
+  const auto in = make_input(100003);
+  ppc::core::MemorySource<int> source(in);
+  for (std::size_t chunk : {1, 2, 999, 1 << 20}) {
+    ppc::core::ChunkStream<int> sum_stream(source, chunk);
+    EXPECT_EQ(ppc::core::stream_sum(sum_stream), std::accumulate(in.begin(), in.end(), 0));
+
+    ppc::core::ChunkStream<int> min_stream(source, chunk);
+    auto min = ppc::core::stream_extremum<true>(min_stream);
+    EXPECT_EQ(min.index, static_cast<std::size_t>(std::min_element(in.begin(), in.end()) - in.begin()));
+    ppc::core::ChunkStream<int> max_stream(source, chunk);
+    auto max = ppc::core::stream_extremum<false>(max_stream);
+    EXPECT_EQ(max.index, static_cast<std::size_t>(std::max_element(in.begin(), in.end()) - in.begin()));
+
+    // pairs across chunk boundaries are counted once
+    using Kernel = ppc::core::SignAlternationCount<int, uint64_t>;
+    ppc::core::ChunkStream<int> pair_stream(source, chunk);
+    EXPECT_EQ(ppc::core::stream_scan_neighbors<Kernel>(pair_stream),
+              ppc::core::scan_neighbors<Kernel>(in.data(), in.size()));
+  }
+}
+
+TEST(stream_tests, check_dot_of_two_streams) {
+  const auto a = make_input(5000);
+  const std::vector<int> b(5000, 2);
+  ppc::core::MemorySource<int> a_source(a);
+  ppc::core::MemorySource<int> b_source(b);
+  ppc::core::ChunkStream<int> a_stream(a_source, 300);
+  ppc::core::ChunkStream<int> b_stream(b_source, 300);
+  EXPECT_EQ(ppc::core::stream_dot(a_stream, b_stream), 2 * std::accumulate(a.begin(), a.end(), 0));
+
+  const std::vector<int> shorter(10, 1);
+  ppc::core::MemorySource<int> shorter_source(shorter);
+  ppc::core::ChunkStream<int> long_stream(a_source, 300);
+  ppc::core::ChunkStream<int> short_stream(shorter_source, 300);
+  EXPECT_THROW(ppc::core::stream_dot(long_stream, short_stream), std::invalid_argument);
+}
+
+TEST(stream_tests, check_dot_of_chunks_of_different_sizes) {
+  const auto a = make_input(5000);
+  const auto b = make_input(5003);
+  const int expected = std::inner_product(a.begin(), a.end(), b.begin(), 0);
+  ppc::core::MemorySource<int> a_source(a);
+  ShortReadSource b_source(std::span<const int>(b.data(), a.size()));
+  for (std::size_t a_chunk : {1, 300, 4096}) {
+    for (std::size_t b_chunk : {1, 7, 1000}) {
+      ppc::core::ChunkStream<int> a_stream(a_source, a_chunk);
+      ppc::core::ChunkStream<int> b_stream(b_source, b_chunk);
+      EXPECT_EQ(ppc::core::stream_dot(a_stream, b_stream), expected);
+      // in both orders
+      ppc::core::ChunkStream<int> b_first(b_source, b_chunk);
+      ppc::core::ChunkStream<int> a_second(a_source, a_chunk);
+      EXPECT_EQ(ppc::core::stream_dot(b_first, a_second), expected);
+    }
+  }
+
+  // the shorter stream ends in the middle of a chunk of the longer one
+  ppc::core::MemorySource<int> longer_source(b);
+  ppc::core::ChunkStream<int> longer(longer_source, 300);
+  ppc::core::ChunkStream<int> shorter(b_source, 7);
+  EXPECT_THROW(ppc::core::stream_dot(longer, shorter), std::invalid_argument);
+}
+
+TEST(stream_tests, check_errors) {
+  // wrong element type
+  const std::vector<double> in(10, 1.0);
+  ppc::core::MemorySource<double> source(in);
+  EXPECT_THROW(ppc::core::ChunkStream<int>(source, 4), std::invalid_argument);
+
+  // errors of the source reach the consumer
+  ppc::core::GeneratorSource<int> failing(100, [](std::uint64_t first, int *dst, std::size_t count) {
+    if (first >= 50) throw std::runtime_error("read error");
+    std::fill_n(dst, count, 1);
+  });
+  ppc::core::ChunkStream<int> stream(failing, 25);
+  EXPECT_EQ(stream.next().size(), 25U);
+  EXPECT_EQ(stream.next().size(), 25U);
+  EXPECT_THROW(stream.next(), std::runtime_error);
+
+  EXPECT_THROW(ppc::core::FileSource<int>("/nonexistent/ppc_stream.bin"), std::runtime_error);
+}
+
+TEST(stream_tests, check_streamed_task_data) {
+  const auto in = make_input(1000);
+  ppc::core::TaskData taskData;
+  taskData.add_input(ppc::core::stream_buffer(std::make_shared<ppc::core::MemorySource<int>>(in)));
+  EXPECT_TRUE(taskData.input_buffer(0).streamed());
+  EXPECT_EQ(taskData.inputs_count[0], in.size());
+  EXPECT_EQ(taskData.input_buffer(0).type, ppc::core::ElementType::INT32);
+  EXPECT_THROW(taskData.input_view<int>(0), std::invalid_argument);
+  auto stream = ppc::core::input_stream<int>(taskData, 0, 64);
+  EXPECT_EQ(ppc::core::stream_sum(stream), std::accumulate(in.begin(), in.end(), 0));
+}
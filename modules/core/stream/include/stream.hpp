@@ -0,0 +1,327 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_STREAM_HPP_
+#define MODULES_CORE_INCLUDE_STREAM_HPP_
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "core/arena/include/arena.hpp"
+#include "core/simd/include/simd.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+// Elements of a streamed input delivered in chunks. Sources are read from
+// the beginning once per run, rewind() starts the next pass.
+class ChunkSource {
+ public:
+  virtual ~ChunkSource() = default;
+  [[nodiscard]] virtual ElementType type() const = 0;
+  // count of elements of one pass
+  [[nodiscard]] virtual std::uint64_t count() const = 0;
+  // copies up to count next elements into dst, 0 at the end of the pass
+  virtual std::size_t read(void *dst, std::size_t count) = 0;
+  virtual void rewind() = 0;
+};
+
+// elements of a buffer in memory, mainly for tests
+template <class T>
+class MemorySource : public ChunkSource {
+ public:
+  explicit MemorySource(std::span<const T> data) : data_(data) {}
+  [[nodiscard]] ElementType type() const override { return element_type_of<T>(); }
+  [[nodiscard]] std::uint64_t count() const override { return data_.size(); }
+  std::size_t read(void *dst, std::size_t count) override {
+    count = std::min(count, data_.size() - position_);
+    std::copy_n(data_.data() + position_, count, static_cast<T *>(dst));
+    position_ += count;
+    return count;
+  }
+  void rewind() override { position_ = 0; }
+
+ private:
+  std::span<const T> data_;
+  std::size_t position_ = 0;
+};
+
+// count elements produced by fill(first, dst, count), which writes elements
+// [first, first + count) of the sequence into dst
+template <class T>
+class GeneratorSource : public ChunkSource {
+ public:
+  using Fill = std::function<void(std::uint64_t first, T *dst, std::size_t count)>;
+  GeneratorSource(std::uint64_t count, Fill fill) : count_(count), fill_(std::move(fill)) {}
+  [[nodiscard]] ElementType type() const override { return element_type_of<T>(); }
+  [[nodiscard]] std::uint64_t count() const override { return count_; }
+  std::size_t read(void *dst, std::size_t count) override {
+    count = static_cast<std::size_t>(std::min<std::uint64_t>(count, count_ - position_));
+    if (count != 0) fill_(position_, static_cast<T *>(dst), count);
+    position_ += count;
+    return count;
+  }
+  void rewind() override { position_ = 0; }
+
+ private:
+  std::uint64_t count_;
+  std::uint64_t position_ = 0;
+  Fill fill_;
+};
+
+// Raw elements of a binary file starting at offset bytes, read with buffered I/O
+template <class T>
+class FileSource : public ChunkSource {
+ public:
+  explicit FileSource(const std::string &path, std::uint64_t offset = 0)
+      : file_(path, std::ios::binary | std::ios::ate), offset_(offset) {
+    if (!file_) throw std::runtime_error("Can not open stream input file: " + path);
+    const auto bytes = static_cast<std::uint64_t>(file_.tellg());
+    count_ = bytes > offset ? (bytes - offset) / sizeof(T) : 0;
+    rewind();
+  }
+  [[nodiscard]] ElementType type() const override { return element_type_of<T>(); }
+  [[nodiscard]] std::uint64_t count() const override { return count_; }
+  std::size_t read(void *dst, std::size_t count) override {
+    count = static_cast<std::size_t>(std::min<std::uint64_t>(count, count_ - position_));
+    file_.read(static_cast<char *>(dst), static_cast<std::streamsize>(count * sizeof(T)));
+    if (static_cast<std::size_t>(file_.gcount()) != count * sizeof(T)) {
+      throw std::runtime_error("Stream input file is shorter than expected");
+    }
+    position_ += count;
+    return count;
+  }
+  void rewind() override {
+    file_.clear();
+    file_.seekg(static_cast<std::streamoff>(offset_));
+    position_ = 0;
+  }
+
+ private:
+  std::ifstream file_;
+  std::uint64_t offset_;
+  std::uint64_t count_ = 0;
+  std::uint64_t position_ = 0;
+};
+
+// expected access pattern of a mapping, selects the read-ahead of the kernel
+enum class MapAdvice { SEQUENTIAL, RANDOM, WILL_NEED };
+
+// Read-only shared mapping of a whole file: processes mapping the same file
+// share its pages in the page cache. populate faults the whole file in on
+// construction. Ranges read once can be released behind the reader, so the
+// resident set stays small for files larger than memory. Systems without
+// mmap read the file into memory.
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string &path, MapAdvice advice = MapAdvice::SEQUENTIAL, bool populate = false);
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  ~MappedFile();
+
+  [[nodiscard]] const std::byte *data() const { return data_; }
+  [[nodiscard]] std::size_t size() const { return size_; }
+  // pages of [offset, offset + bytes) are not needed anymore
+  void release(std::size_t offset, std::size_t bytes) const;
+
+ private:
+  const std::byte *data_ = nullptr;
+  std::size_t size_ = 0;
+  bool mapped_ = false;
+};
+
+// elements of a mapped file starting at offset bytes
+template <class T>
+class MappedFileSource : public ChunkSource {
+ public:
+  explicit MappedFileSource(const std::string &path, std::uint64_t offset = 0)
+      : file_(std::make_shared<MappedFile>(path)), offset_(static_cast<std::size_t>(offset)) {
+    count_ = file_->size() > offset_ ? (file_->size() - offset_) / sizeof(T) : 0;
+  }
+  [[nodiscard]] ElementType type() const override { return element_type_of<T>(); }
+  [[nodiscard]] std::uint64_t count() const override { return count_; }
+  std::size_t read(void *dst, std::size_t count) override {
+    count = static_cast<std::size_t>(std::min<std::uint64_t>(count, count_ - position_));
+    const std::size_t begin = offset_ + position_ * sizeof(T);
+    std::copy_n(file_->data() + begin, count * sizeof(T), static_cast<std::byte *>(dst));
+    file_->release(begin, count * sizeof(T));
+    position_ += count;
+    return count;
+  }
+  void rewind() override { position_ = 0; }
+
+ private:
+  std::shared_ptr<MappedFile> file_;
+  std::size_t offset_;
+  std::uint64_t count_ = 0;
+  std::uint64_t position_ = 0;
+};
+
+// descriptor of a streamed TaskData input:
+//   taskData->add_input(ppc::core::stream_buffer(source));
+Buffer stream_buffer(std::shared_ptr<ChunkSource> source);
+
+// Reads the source on a background thread into two buffers: while the
+// consumer processes one chunk, the next one is being read. Untyped part of
+// ChunkStream, chunks are given in elements of element_size bytes.
+class ChunkPrefetcher {
+ public:
+  ChunkPrefetcher(ChunkSource &source, std::size_t element_size, std::size_t chunk_elements);
+  ChunkPrefetcher(const ChunkPrefetcher &) = delete;
+  ChunkPrefetcher &operator=(const ChunkPrefetcher &) = delete;
+  ~ChunkPrefetcher();
+
+  // next chunk and its count of elements, count 0 at the end. The chunk
+  // stays valid until the next call. Errors of the source are rethrown here.
+  std::pair<const std::byte *, std::size_t> next();
+
+ private:
+  void produce();
+
+  ChunkSource &source_;
+  std::size_t element_size_;
+  std::size_t chunk_elements_;
+  Arena memory_;
+  std::byte *buffers_[2] = {nullptr, nullptr};
+  std::size_t counts_[2] = {0, 0};
+  // filled by the producer and not yet given back by the consumer
+  bool filled_[2] = {false, false};
+  int current_ = 0;
+  bool holding_ = false;
+  bool stop_ = false;
+  std::exception_ptr error_;
+  std::mutex mutex_;
+  std::condition_variable changed_;
+  std::thread producer_;
+};
+
+// chunk of 4 MiB by default, large enough to hide the latency of a read
+inline constexpr std::size_t default_stream_chunk_bytes = 4 * 1024 * 1024;
+
+// Typed chunks of one pass over a source:
+//   ChunkStream<T> stream(source);
+//   for (auto chunk = stream.next(); !chunk.empty(); chunk = stream.next()) ...
+template <class T>
+class ChunkStream {
+ public:
+  explicit ChunkStream(ChunkSource &source, std::size_t chunk_elements = 0) {
+    if (source.type() != ElementType::UNKNOWN && source.type() != element_type_of<T>()) {
+      throw std::invalid_argument(std::string("Stream holds ") + element_type_name(source.type()) +
+                                  " elements, requested " + element_type_name(element_type_of<T>()));
+    }
+    if (chunk_elements == 0) chunk_elements = std::max<std::size_t>(default_stream_chunk_bytes / sizeof(T), 1);
+    source.rewind();
+    prefetcher_ = std::make_unique<ChunkPrefetcher>(source, sizeof(T), chunk_elements);
+  }
+
+  std::span<const T> next() {
+    auto [data, count] = prefetcher_->next();
+    return {reinterpret_cast<const T *>(data), count};
+  }
+
+ private:
+  std::unique_ptr<ChunkPrefetcher> prefetcher_;
+};
+
+// stream of streamed input i of TaskData
+template <class T>
+ChunkStream<T> input_stream(const TaskData &taskData, std::size_t i, std::size_t chunk_elements = 0) {
+  auto buffer = taskData.input_buffer(i);
+  if (!buffer.streamed()) throw std::invalid_argument("TaskData input " + std::to_string(i) + " is not streamed");
+  return ChunkStream<T>(*buffer.source, chunk_elements);
+}
+
+// Reductions over one pass of a stream, the partial state is carried from
+// chunk to chunk
+
+template <class T>
+T stream_sum(ChunkStream<T> &stream) {
+  T sum{};
+  for (auto chunk = stream.next(); !chunk.empty(); chunk = stream.next()) {
+    sum += simd::sum(chunk.data(), chunk.size());
+  }
+  return sum;
+}
+
+// sum in Accumulator and count of elements
+template <class Accumulator, class T>
+std::pair<Accumulator, std::uint64_t> stream_accumulate(ChunkStream<T> &stream, Accumulator init) {
+  std::uint64_t count = 0;
+  for (auto chunk = stream.next(); !chunk.empty(); chunk = stream.next()) {
+    init = std::accumulate(chunk.begin(), chunk.end(), init);
+    count += chunk.size();
+  }
+  return {init, count};
+}
+
+// first smallest (Min) or largest element and its index in the whole stream
+template <bool Min, class T>
+simd::ArgExtremum<T> stream_extremum(ChunkStream<T> &stream) {
+  simd::ArgExtremum<T> best{T{}, 0};
+  std::uint64_t offset = 0;
+  for (auto chunk = stream.next(); !chunk.empty(); chunk = stream.next()) {
+    auto found = Min ? simd::min_element(chunk.data(), chunk.size()) : simd::max_element(chunk.data(), chunk.size());
+    if (offset == 0 || (Min ? found.value < best.value : best.value < found.value)) {
+      best = {found.value, static_cast<std::size_t>(offset + found.index)};
+    }
+    offset += chunk.size();
+  }
+  return best;
+}
+
+// Chunks of the streams may differ in size (sources may return short reads):
+// the rest of the longer chunk is kept and paired with the next chunk of the
+// other stream. Streams of different lengths throw; summed in
+// simd::dot_type<T> like simd::dot.
+template <class T>
+simd::dot_type<T> stream_dot(ChunkStream<T> &a, ChunkStream<T> &b) {
+  simd::dot_type<T> dot{};
+  std::span<const T> left;
+  std::span<const T> right;
+  while (true) {
+    if (left.empty()) left = a.next();
+    if (right.empty()) right = b.next();
+    if (left.empty() != right.empty()) throw std::invalid_argument("Streams of the dot product differ in length");
+    if (left.empty()) return dot;
+    const std::size_t count = std::min(left.size(), right.size());
+    dot += simd::dot(left.data(), right.data(), count);
+    left = left.subspan(count);
+    right = right.subspan(count);
+  }
+}
+
+// Neighbor scan over chunks, the last element of a chunk is carried to
+// pair it with the first element of the next one. For kernels whose results
+// do not refer to positions in the data (pair counts).
+template <class Kernel, class T>
+typename Kernel::Result stream_scan_neighbors(ChunkStream<T> &stream) {
+  auto result = Kernel::identity();
+  bool has_carry = false;
+  T carry{};
+  for (auto chunk = stream.next(); !chunk.empty(); chunk = stream.next()) {
+    if (has_carry) {
+      const T boundary[2] = {carry, chunk.front()};
+      result = Kernel::combine(result, Kernel::scan(boundary, 0, 1));
+    }
+    if (chunk.size() >= 2) result = Kernel::combine(result, Kernel::scan(chunk.data(), 0, chunk.size() - 1));
+    carry = chunk.back();
+    has_carry = true;
+  }
+  return result;
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_STREAM_HPP_
@@ -0,0 +1,154 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/stream/include/stream.hpp"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr std::size_t page_size = 4096;
+
+#if defined(__linux__)
+int advice_flag(ppc::core::MapAdvice advice) {
+  switch (advice) {
+    case ppc::core::MapAdvice::RANDOM:
+      return MADV_RANDOM;
+    case ppc::core::MapAdvice::WILL_NEED:
+      return MADV_WILLNEED;
+    default:
+      return MADV_SEQUENTIAL;
+  }
+}
+#endif
+
+}  // namespace
+
+ppc::core::MappedFile::MappedFile(const std::string &path, MapAdvice advice, bool populate) {
+#if defined(__linux__)
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) throw std::runtime_error("Can not open mapped file: " + path);
+  struct stat info {};
+  if (fstat(fd, &info) != 0) {
+    close(fd);
+    throw std::runtime_error("Can not stat mapped file: " + path);
+  }
+  size_ = static_cast<std::size_t>(info.st_size);
+  if (size_ != 0) {
+    void *data = mmap(nullptr, size_, PROT_READ, MAP_SHARED | (populate ? MAP_POPULATE : 0), fd, 0);
+    if (data == MAP_FAILED) {
+      close(fd);
+      throw std::runtime_error("Can not map file: " + path);
+    }
+    madvise(data, size_, advice_flag(advice));
+    data_ = static_cast<const std::byte *>(data);
+    mapped_ = true;
+  }
+  close(fd);
+#else
+  (void)advice;
+  (void)populate;
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file) throw std::runtime_error("Can not open mapped file: " + path);
+  size_ = static_cast<std::size_t>(file.tellg());
+  auto *data = new std::byte[size_];
+  file.seekg(0);
+  file.read(reinterpret_cast<char *>(data), static_cast<std::streamsize>(size_));
+  data_ = data;
+#endif
+}
+
+ppc::core::MappedFile::~MappedFile() {
+#if defined(__linux__)
+  if (mapped_) munmap(const_cast<std::byte *>(data_), size_);
+#else
+  delete[] data_;
+#endif
+}
+
+void ppc::core::MappedFile::release(std::size_t offset, std::size_t bytes) const {
+#if defined(__linux__)
+  if (!mapped_) return;
+  // whole pages inside of the range only, the neighbours may still be read
+  const std::size_t begin = (offset + page_size - 1) / page_size * page_size;
+  const std::size_t end = (offset + bytes) / page_size * page_size;
+  if (begin < end) madvise(const_cast<std::byte *>(data_) + begin, end - begin, MADV_DONTNEED);
+#else
+  (void)offset;
+  (void)bytes;
+#endif
+}
+
+ppc::core::Buffer ppc::core::stream_buffer(std::shared_ptr<ChunkSource> source) {
+  Buffer buffer;
+  buffer.type = source->type();
+  buffer.count = source->count();
+  buffer.source = std::move(source);
+  return buffer;
+}
+
+ppc::core::ChunkPrefetcher::ChunkPrefetcher(ChunkSource &source, std::size_t element_size,
+                                            std::size_t chunk_elements)
+    : source_(source),
+      element_size_(element_size),
+      chunk_elements_(chunk_elements),
+      memory_(2 * element_size * chunk_elements + 2 * cache_line_size) {
+  for (auto &buffer : buffers_) buffer = static_cast<std::byte *>(memory_.allocate(element_size * chunk_elements));
+  producer_ = std::thread(&ChunkPrefetcher::produce, this);
+}
+
+ppc::core::ChunkPrefetcher::~ChunkPrefetcher() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  changed_.notify_all();
+  producer_.join();
+}
+
+void ppc::core::ChunkPrefetcher::produce() {
+  int index = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      changed_.wait(lock, [&] { return stop_ || !filled_[index]; });
+      if (stop_) return;
+    }
+    std::size_t count = 0;
+    std::exception_ptr error;
+    try {
+      count = source_.read(buffers_[index], chunk_elements_);
+    } catch (...) {
+      error = std::current_exception();
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      counts_[index] = count;
+      filled_[index] = true;
+      error_ = error;
+    }
+    changed_.notify_all();
+    // an empty chunk or an error ends the pass
+    if (count == 0 || error) return;
+    index ^= 1;
+  }
+}
+
+std::pair<const std::byte *, std::size_t> ppc::core::ChunkPrefetcher::next() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (holding_) {
+    // the previous chunk goes back to the producer
+    if (counts_[current_] == 0) return {buffers_[current_], 0};
+    filled_[current_] = false;
+    holding_ = false;
+    current_ ^= 1;
+    changed_.notify_all();
+  }
+  changed_.wait(lock, [&] { return filled_[current_]; });
+  if (error_) std::rethrow_exception(error_);
+  holding_ = true;
+  return {buffers_[current_], counts_[current_]};
+}
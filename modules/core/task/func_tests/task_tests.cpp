@@ -1,6 +1,7 @@
 // Copyright 2023 Nesterov Alexander
 #include <gtest/gtest.h>
 
+#include <limits>
 #include <vector>
 
 #include "core/task/func_tests/test_task.hpp"
@@ -154,6 +155,152 @@ TEST(task_tests, check_wrong_order) {
   ASSERT_ANY_THROW(testTask.post_processing());
 }
 
+TEST(task_tests, check_input_view_is_zero_copy) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  auto input = taskData->input_view<int32_t>(0);
+  EXPECT_EQ(input.data(), in.data());
+  EXPECT_EQ(input.size(), in.size());
+  EXPECT_EQ(input.size_bytes(), in.size() * sizeof(int32_t));
+  EXPECT_GE(input.alignment(), alignof(int32_t));
+  EXPECT_TRUE(input.is_aligned(alignof(int32_t)));
+
+  auto output = taskData->output_view<int32_t>(0);
+  output[0] = 5;
+  EXPECT_EQ(out[0], 5);
+}
+
+TEST(task_tests, check_input_view_bounds) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+
+  auto input = taskData->input_view<int32_t>(0);
+  EXPECT_EQ(input.at(19), 1);
+  EXPECT_THROW(input.at(20), std::out_of_range);
+  EXPECT_THROW(taskData->input_view<int32_t>(1), std::out_of_range);
+  EXPECT_THROW(taskData->output_view<int32_t>(0), std::out_of_range);
+}
+
+TEST(task_tests, check_input_copy_is_owning) {
+  // Create data
+  std::vector<double> in(20, 1);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+
+  auto copy = taskData->input_copy<double>(0);
+  ASSERT_EQ(copy.size(), in.size());
+  copy[0] = 2;
+  EXPECT_NE(copy.data(), in.data());
+  EXPECT_EQ(in[0], 1);
+}
+
+TEST(task_tests, check_typed_buffers) {
+  // Create data
+  std::vector<float> in(20, 1);
+  std::vector<float> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_output(out);
+
+  auto buffer = taskData->input_buffer(0);
+  EXPECT_EQ(buffer.type, ppc::core::ElementType::FLOAT32);
+  EXPECT_EQ(buffer.count, in.size());
+  EXPECT_EQ(buffer.stride, 1u);
+  EXPECT_GE(buffer.alignment, alignof(float));
+  EXPECT_FALSE(buffer.owning());
+
+  // Raw vectors are kept in sync for existing tasks
+  ASSERT_EQ(taskData->inputs.size(), 1u);
+  EXPECT_EQ(taskData->inputs[0], reinterpret_cast<uint8_t *>(in.data()));
+  EXPECT_EQ(taskData->inputs_count[0], in.size());
+
+  // Create Task
+  ppc::test::TestTask<float> testTask(taskData);
+  ASSERT_EQ(testTask.validation(), true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  EXPECT_NEAR(out[0], in.size(), 1e-3);
+}
+
+TEST(task_tests, check_typed_buffer_type_mismatch) {
+  // Create data
+  std::vector<float> in(20, 1);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+
+  EXPECT_NO_THROW(taskData->input_view<float>(0));
+  EXPECT_THROW(taskData->input_view<int32_t>(0), std::invalid_argument);
+}
+
+TEST(task_tests, check_typed_buffer_64bit_count) {
+  // Create data, buffer memory is never touched
+  std::vector<uint8_t> in(1, 1);
+  const uint64_t count = 5'000'000'000ull;
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in.data(), count);
+
+  EXPECT_EQ(taskData->input_buffer(0).count, count);
+  EXPECT_EQ(taskData->input_view<uint8_t>(0).size(), count);
+  EXPECT_EQ(taskData->inputs_count[0], std::numeric_limits<uint32_t>::max());
+}
+
+TEST(task_tests, check_owning_and_legacy_buffers) {
+  // Create data
+  std::vector<int32_t> legacy(10, 2);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(legacy.data()));
+  taskData->inputs_count.emplace_back(legacy.size());
+  taskData->add_input(ppc::core::Buffer::own(std::vector<int64_t>(5, 3)));
+
+  auto legacy_buffer = taskData->input_buffer(0);
+  EXPECT_EQ(legacy_buffer.type, ppc::core::ElementType::UNKNOWN);
+  EXPECT_EQ(legacy_buffer.count, legacy.size());
+  EXPECT_EQ(taskData->input_view<int32_t>(0)[9], 2);
+
+  auto owned_buffer = taskData->input_buffer(1);
+  EXPECT_TRUE(owned_buffer.owning());
+  EXPECT_EQ(owned_buffer.type, ppc::core::ElementType::INT64);
+  EXPECT_EQ(taskData->input_view<int64_t>(1)[4], 3);
+}
+
+TEST(task_tests, check_strided_buffer_has_no_view) {
+  // Create data
+  std::vector<double> in(20, 1);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(ppc::core::Buffer::borrow(in.data(), in.size() / 2, 2));
+
+  EXPECT_FALSE(taskData->input_buffer(0).contiguous());
+  EXPECT_THROW(taskData->input_view<double>(0), std::invalid_argument);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
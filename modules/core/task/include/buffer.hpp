@@ -0,0 +1,151 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_BUFFER_HPP_
+#define MODULES_CORE_INCLUDE_BUFFER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/data_view.hpp"
+
+namespace ppc::core {
+
+enum class ElementType : std::uint8_t {
+  UNKNOWN,
+  INT8,
+  UINT8,
+  INT16,
+  UINT16,
+  INT32,
+  UINT32,
+  INT64,
+  UINT64,
+  FLOAT32,
+  FLOAT64
+};
+
+template <class T>
+constexpr ElementType element_type_of() {
+  using U = std::remove_cv_t<T>;
+  if constexpr (std::is_same_v<U, float>) {
+    return ElementType::FLOAT32;
+  } else if constexpr (std::is_same_v<U, double>) {
+    return ElementType::FLOAT64;
+  } else if constexpr (std::is_integral_v<U> && !std::is_same_v<U, bool>) {
+    constexpr bool is_signed = std::is_signed_v<U>;
+    if constexpr (sizeof(U) == 1) return is_signed ? ElementType::INT8 : ElementType::UINT8;
+    if constexpr (sizeof(U) == 2) return is_signed ? ElementType::INT16 : ElementType::UINT16;
+    if constexpr (sizeof(U) == 4) return is_signed ? ElementType::INT32 : ElementType::UINT32;
+    if constexpr (sizeof(U) == 8) return is_signed ? ElementType::INT64 : ElementType::UINT64;
+    return ElementType::UNKNOWN;
+  } else {
+    return ElementType::UNKNOWN;
+  }
+}
+
+// source of a streamed buffer, see core/stream
+class ChunkSource;
+
+// size of one element in bytes, 0 for UNKNOWN
+constexpr std::size_t element_size(ElementType type) {
+  switch (type) {
+    case ElementType::INT8:
+    case ElementType::UINT8:
+      return 1;
+    case ElementType::INT16:
+    case ElementType::UINT16:
+      return 2;
+    case ElementType::INT32:
+    case ElementType::UINT32:
+    case ElementType::FLOAT32:
+      return 4;
+    case ElementType::INT64:
+    case ElementType::UINT64:
+    case ElementType::FLOAT64:
+      return 8;
+    case ElementType::UNKNOWN:
+      break;
+  }
+  return 0;
+}
+
+constexpr const char *element_type_name(ElementType type) {
+  switch (type) {
+    case ElementType::INT8:
+      return "int8";
+    case ElementType::UINT8:
+      return "uint8";
+    case ElementType::INT16:
+      return "int16";
+    case ElementType::UINT16:
+      return "uint16";
+    case ElementType::INT32:
+      return "int32";
+    case ElementType::UINT32:
+      return "uint32";
+    case ElementType::INT64:
+      return "int64";
+    case ElementType::UINT64:
+      return "uint64";
+    case ElementType::FLOAT32:
+      return "float32";
+    case ElementType::FLOAT64:
+      return "float64";
+    case ElementType::UNKNOWN:
+      break;
+  }
+  return "unknown";
+}
+
+// Descriptor of one TaskData buffer: element type, 64-bit element count,
+// stride and alignment. Owning buffers keep their memory alive through owner.
+// Streamed buffers have no data, their elements are read in chunks from source.
+struct Buffer {
+  uint8_t *data = nullptr;
+  ElementType type = ElementType::UNKNOWN;
+  std::uint64_t count = 0;
+  // distance between consecutive elements in elements, 1 for contiguous data
+  std::uint64_t stride = 1;
+  std::size_t alignment = 1;
+  // size of one element in bytes when it is known without type, e.g. borrowed structs
+  std::size_t element_bytes = 0;
+  std::shared_ptr<void> owner;
+  std::shared_ptr<ChunkSource> source;
+
+  [[nodiscard]] bool owning() const { return owner != nullptr; }
+  [[nodiscard]] bool streamed() const { return source != nullptr; }
+  [[nodiscard]] bool contiguous() const { return stride == 1; }
+  // bytes spanned by the elements, 0 when the element size is unknown (raw TaskData pointers)
+  [[nodiscard]] std::uint64_t byte_size() const {
+    const std::size_t size = type != ElementType::UNKNOWN ? element_size(type) : element_bytes;
+    return count * stride * size;
+  }
+
+  template <class T>
+  static Buffer borrow(T *data, std::uint64_t count, std::uint64_t stride = 1) {
+    Buffer buffer;
+    buffer.data = reinterpret_cast<uint8_t *>(const_cast<std::remove_cv_t<T> *>(data));
+    buffer.type = element_type_of<T>();
+    buffer.element_bytes = sizeof(T);
+    buffer.count = count;
+    buffer.stride = stride;
+    buffer.alignment = address_alignment(data);
+    return buffer;
+  }
+
+  template <class T>
+  static Buffer own(std::vector<T> data) {
+    auto storage = std::make_shared<std::vector<T>>(std::move(data));
+    Buffer buffer = borrow(storage->data(), storage->size());
+    buffer.owner = std::move(storage);
+    return buffer;
+  }
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_BUFFER_HPP_
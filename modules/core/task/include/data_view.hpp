@@ -0,0 +1,70 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_DATA_VIEW_HPP_
+#define MODULES_CORE_INCLUDE_DATA_VIEW_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace ppc::core {
+
+// Largest power of two (up to cap) dividing the address
+inline std::size_t address_alignment(const void *address, std::size_t cap = 64) {
+  if (address == nullptr) return cap;
+  auto value = reinterpret_cast<std::uintptr_t>(address);
+  std::size_t alignment = 1;
+  while (alignment < cap && (value & alignment) == 0) {
+    alignment <<= 1;
+  }
+  return alignment;
+}
+
+// Non-owning typed view of a TaskData buffer. Carries the element count
+// and the alignment of the first element, so tasks can read inputs in place
+// instead of copying them into private vectors.
+template <class T>
+class DataView {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  static constexpr std::size_t element_size = sizeof(T);
+  // Alignment reported by alignment() is capped at a cache line
+  static constexpr std::size_t max_alignment = 64;
+
+  DataView() = default;
+  DataView(T *data, std::size_t size) : data_(data), size_(size) {}
+
+  [[nodiscard]] T *data() const { return data_; }
+  [[nodiscard]] std::size_t size() const { return size_; }
+  [[nodiscard]] std::size_t size_bytes() const { return size_ * element_size; }
+  [[nodiscard]] bool empty() const { return size_ == 0; }
+
+  T *begin() const { return data_; }
+  T *end() const { return data_ + size_; }
+
+  T &operator[](std::size_t i) const { return data_[i]; }
+  T &at(std::size_t i) const {
+    if (i >= size_) {
+      throw std::out_of_range("DataView index " + std::to_string(i) + " is out of range " + std::to_string(size_));
+    }
+    return data_[i];
+  }
+
+  [[nodiscard]] std::span<T> span() const { return std::span<T>(data_, size_); }
+
+  // Largest power of two (up to max_alignment) dividing the address of data()
+  [[nodiscard]] std::size_t alignment() const { return address_alignment(data_, max_alignment); }
+  [[nodiscard]] bool is_aligned(std::size_t bytes) const { return alignment() >= bytes; }
+
+ private:
+  T *data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_DATA_VIEW_HPP_
@@ -7,9 +7,14 @@
 #include <cstdint>
 #include <iostream>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
+#include "core/arena/include/arena.hpp"
+#include "core/task/include/buffer.hpp"
+#include "core/task/include/data_view.hpp"
+
 namespace ppc::core {
 
 struct TaskData {
@@ -17,7 +22,80 @@ struct TaskData {
   std::vector<std::uint32_t> inputs_count;
   std::vector<uint8_t *> outputs;
   std::vector<std::uint32_t> outputs_count;
+  // Typed descriptors, index-aligned with inputs and outputs. Buffers pushed
+  // directly into the raw vectors above have no descriptor (data == nullptr).
+  std::vector<Buffer> input_buffers;
+  std::vector<Buffer> output_buffers;
   enum StateOfTesting { FUNC, PERF } state_of_testing;
+
+  // register buffer with its descriptor, raw vectors are filled too and
+  // the 32-bit counts saturate at UINT32_MAX for larger buffers
+  void add_input(Buffer buffer);
+  void add_output(Buffer buffer);
+
+  template <class T>
+  void add_input(T *data, std::uint64_t count) {
+    add_input(Buffer::borrow(data, count));
+  }
+  template <class T>
+  void add_input(std::vector<T> &data) {
+    add_input(Buffer::borrow(data.data(), data.size()));
+  }
+  template <class T>
+  void add_output(T *data, std::uint64_t count) {
+    add_output(Buffer::borrow(data, count));
+  }
+  template <class T>
+  void add_output(std::vector<T> &data) {
+    add_output(Buffer::borrow(data.data(), data.size()));
+  }
+
+  // descriptor of buffer, synthesized from the raw vectors when the buffer
+  // has no descriptor (element type is UNKNOWN then)
+  [[nodiscard]] Buffer input_buffer(size_t i) const;
+  [[nodiscard]] Buffer output_buffer(size_t i) const;
+
+  // typed in-place view of input buffer, no data is copied
+  template <class T>
+  DataView<const T> input_view(size_t i) const {
+    return make_view<const T>(input_buffer(i));
+  }
+
+  // typed in-place view of output buffer
+  template <class T>
+  DataView<T> output_view(size_t i) const {
+    return make_view<T>(output_buffer(i));
+  }
+
+  // owning copy of input buffer, only for tasks which modify their input
+  template <class T>
+  std::vector<T> input_copy(size_t i) const {
+    auto view = input_view<T>(i);
+    return std::vector<T>(view.begin(), view.end());
+  }
+
+ private:
+  template <class T>
+  static DataView<T> make_view(const Buffer &buffer) {
+    constexpr auto requested = element_type_of<T>();
+    if (buffer.type != ElementType::UNKNOWN && requested != ElementType::UNKNOWN && buffer.type != requested) {
+      throw std::invalid_argument(std::string("TaskData buffer holds ") + element_type_name(buffer.type) +
+                                  " elements, requested " + element_type_name(requested));
+    }
+    if (buffer.streamed()) {
+      throw std::invalid_argument("TaskData buffer is streamed, view requires data in memory");
+    }
+    if (!buffer.contiguous()) {
+      throw std::invalid_argument("TaskData buffer is strided, view requires contiguous data");
+    }
+    return DataView<T>(reinterpret_cast<T *>(buffer.data), buffer.count);
+  }
+};
+
+// seconds spent in communication: between ranks of one node and between nodes
+struct CommunicationTimes {
+  double intra_node = 0.0;
+  double inter_node = 0.0;
 };
 
 // Memory of inputs and outputs need to be initialized before create object of
@@ -44,10 +122,22 @@ class Task {
   // get input and output data
   [[nodiscard]] std::shared_ptr<TaskData> get_data() const;
 
+  // usage of the scratch arena over all runs
+  [[nodiscard]] const ArenaStats &scratch_stats() const { return scratch_.stats(); }
+  // communication time of all runs, filled by distributed tasks
+  [[nodiscard]] const CommunicationTimes &communication_times() const { return communication_times_; }
+
   virtual ~Task();
 
  protected:
   void internal_order_test(const std::string &str = __builtin_FUNCTION());
+  // temporary memory of run(), released at the start of the next run
+  Arena &scratch() { return scratch_; }
+  // adds seconds of communication between ranks of one node or between nodes
+  void add_communication_time(double intra_node, double inter_node) {
+    communication_times_.intra_node += intra_node;
+    communication_times_.inter_node += inter_node;
+  }
   std::shared_ptr<TaskData> taskData;
 
  private:
@@ -55,6 +145,8 @@ class Task {
   std::vector<std::string> right_functions_order = {"validation", "pre_processing", "run", "post_processing"};
   const double max_test_time = 1.0;
   std::chrono::high_resolution_clock::time_point tmp_time_point;
+  Arena scratch_;
+  CommunicationTimes communication_times_;
 };
 
 }  // namespace ppc::core
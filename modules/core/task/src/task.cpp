@@ -3,9 +3,56 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <limits>
 #include <stdexcept>
 #include <utility>
 
+namespace {
+
+std::uint32_t saturated_count(std::uint64_t count) {
+  return static_cast<std::uint32_t>(std::min<std::uint64_t>(count, std::numeric_limits<std::uint32_t>::max()));
+}
+
+ppc::core::Buffer find_buffer(const std::vector<ppc::core::Buffer>& buffers, const std::vector<uint8_t*>& data,
+                              const std::vector<std::uint32_t>& counts, size_t i, const std::string& kind) {
+  if (i >= data.size() || i >= counts.size()) {
+    throw std::out_of_range("TaskData has no " + kind + " buffer with index " + std::to_string(i));
+  }
+  if (i < buffers.size() && (buffers[i].data != nullptr || buffers[i].streamed())) {
+    return buffers[i];
+  }
+  ppc::core::Buffer buffer;
+  buffer.data = data[i];
+  buffer.count = counts[i];
+  buffer.alignment = ppc::core::address_alignment(data[i]);
+  return buffer;
+}
+
+}  // namespace
+
+void ppc::core::TaskData::add_input(Buffer buffer) {
+  input_buffers.resize(inputs.size());
+  inputs.emplace_back(buffer.data);
+  inputs_count.emplace_back(saturated_count(buffer.count));
+  input_buffers.emplace_back(std::move(buffer));
+}
+
+void ppc::core::TaskData::add_output(Buffer buffer) {
+  output_buffers.resize(outputs.size());
+  outputs.emplace_back(buffer.data);
+  outputs_count.emplace_back(saturated_count(buffer.count));
+  output_buffers.emplace_back(std::move(buffer));
+}
+
+ppc::core::Buffer ppc::core::TaskData::input_buffer(size_t i) const {
+  return find_buffer(input_buffers, inputs, inputs_count, i, "input");
+}
+
+ppc::core::Buffer ppc::core::TaskData::output_buffer(size_t i) const {
+  return find_buffer(output_buffers, outputs, outputs_count, i, "output");
+}
+
 void ppc::core::Task::set_data(std::shared_ptr<TaskData> taskData_) {
   taskData_->state_of_testing = TaskData::StateOfTesting::FUNC;
   functions_order.clear();
@@ -17,6 +64,7 @@ std::shared_ptr<ppc::core::TaskData> ppc::core::Task::get_data() const { return
 ppc::core::Task::Task(std::shared_ptr<TaskData> taskData_) { set_data(std::move(taskData_)); }
 
 void ppc::core::Task::internal_order_test(const std::string& str) {
+  if (str == "run") scratch_.reset();
   if (!functions_order.empty() && str == functions_order.back() && str == "run") return;
 
   functions_order.push_back(str);
@@ -0,0 +1,180 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "core/task/func_tests/test_task.hpp"
+#include "core/task_graph/include/task_graph.hpp"
+#include "ref/average_of_vector_elements/include/ref_task.hpp"
+#include "ref/max_of_vector_elements/include/ref_task.hpp"
+#include "ref/min_of_vector_elements/include/ref_task.hpp"
+#include "ref/vector_dot_product/include/ref_task.hpp"
+
+namespace {
+
+std::shared_ptr<ppc::core::Task> sum_task(std::vector<int> &in, std::vector<int> &out) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_output(out);
+  return std::make_shared<ppc::test::TestTask<int>>(taskData);
+}
+
+// task failing validation
+class FailingTask : public ppc::core::Task {
+ public:
+  explicit FailingTask(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool validation() override {
+    internal_order_test();
+    return false;
+  }
+  bool pre_processing() override { return true; }
+  bool run() override { return true; }
+  bool post_processing() override { return true; }
+};
+
+}  // namespace
+
+TEST(task_graph_tests, check_dependencies_from_buffers) {
+  std::vector<int> in(100, 1);
+  std::vector<int> first(1, 0);
+  std::vector<int> second(1, 0);
+  std::vector<int> independent(1, 0);
+
+  ppc::core::TaskGraph graph;
+  auto a = graph.add_task(sum_task(in, first), "a");
+  // reads the output of a
+  auto b = graph.add_task(sum_task(first, second), "b");
+  // only shares the input with a
+  auto c = graph.add_task(sum_task(in, independent), "c");
+
+  EXPECT_EQ(graph.successors(a), std::vector<ppc::core::TaskGraph::NodeId>{b});
+  EXPECT_TRUE(graph.successors(c).empty());
+
+  ppc::core::Scheduler scheduler(4);
+  ASSERT_TRUE(graph.run(scheduler));
+  EXPECT_EQ(first[0], 100);
+  EXPECT_EQ(second[0], 100);
+  EXPECT_EQ(independent[0], 100);
+  EXPECT_GE(graph.timings()[b].start, graph.timings()[a].finish);
+
+  auto path = graph.critical_path();
+  ASSERT_FALSE(path.empty());
+  EXPECT_EQ(path.back(), graph.timings()[b].path_time >= graph.timings()[c].path_time ? b : c);
+  EXPECT_GE(graph.critical_path_time(), graph.timings()[a].duration + graph.timings()[b].duration);
+}
+
+TEST(task_graph_tests, check_reductions_share_input) {
+  std::vector<int> in = {3, -7, 12, 5, 0, 9, -2, 4};
+  std::vector<int> other(in.size(), 2);
+  std::vector<int> min_value(1);
+  std::vector<uint64_t> min_index(1);
+  std::vector<int> max_value(1);
+  std::vector<uint64_t> max_index(1);
+  std::vector<double> average(1);
+  std::vector<int> dot(1);
+
+  auto min_data = std::make_shared<ppc::core::TaskData>();
+  min_data->add_input(in);
+  min_data->add_output(min_value);
+  min_data->add_output(min_index);
+  auto max_data = std::make_shared<ppc::core::TaskData>();
+  max_data->add_input(in);
+  max_data->add_output(max_value);
+  max_data->add_output(max_index);
+  auto average_data = std::make_shared<ppc::core::TaskData>();
+  average_data->add_input(in);
+  average_data->add_output(average);
+  auto dot_data = std::make_shared<ppc::core::TaskData>();
+  dot_data->add_input(in);
+  dot_data->add_input(other);
+  dot_data->add_output(dot);
+
+  ppc::core::TaskGraph graph;
+  graph.add_task(std::make_shared<ppc::reference::MinOfVectorElements<int, uint64_t>>(min_data), "min");
+  graph.add_task(std::make_shared<ppc::reference::MaxOfVectorElements<int, uint64_t>>(max_data), "max");
+  graph.add_task(std::make_shared<ppc::reference::AverageOfVectorElements<int, double>>(average_data), "average");
+  graph.add_task(std::make_shared<ppc::reference::VectorDotProduct<int>>(dot_data), "dot");
+  for (size_t node = 0; node < graph.size(); node++) {
+    EXPECT_TRUE(graph.successors(node).empty());
+  }
+
+  ASSERT_TRUE(graph.run());
+  EXPECT_EQ(min_value[0], -7);
+  EXPECT_EQ(min_index[0], 1U);
+  EXPECT_EQ(max_value[0], 12);
+  EXPECT_EQ(max_index[0], 2U);
+  EXPECT_DOUBLE_EQ(average[0], 3.0);
+  EXPECT_EQ(dot[0], 48);
+
+  std::stringstream report;
+  graph.print_timings(report);
+  EXPECT_NE(report.str().find("critical path:"), std::string::npos);
+}
+
+TEST(task_graph_tests, check_explicit_dependencies_and_cycles) {
+  std::vector<int> in(10, 1);
+  std::vector<int> first(1, 0);
+  std::vector<int> second(1, 0);
+
+  ppc::core::TaskGraph graph;
+  auto a = graph.add_task(sum_task(in, first));
+  auto b = graph.add_task(sum_task(in, second));
+  EXPECT_THROW(graph.add_dependency(a, 5), std::out_of_range);
+  EXPECT_THROW(graph.add_dependency(a, a), std::invalid_argument);
+  graph.add_dependency(b, a);
+  ASSERT_TRUE(graph.run());
+  EXPECT_GE(graph.timings()[a].start, graph.timings()[b].finish);
+  EXPECT_EQ(graph.critical_path(), (std::vector<ppc::core::TaskGraph::NodeId>{b, a}));
+
+  graph.add_dependency(a, b);
+  EXPECT_THROW(graph.run(), std::invalid_argument);
+}
+
+TEST(task_graph_tests, check_failed_node_skips_successors) {
+  std::vector<int> in(10, 1);
+  std::vector<int> out(1, 0);
+  std::vector<int> next(1, 0);
+  auto failing_data = std::make_shared<ppc::core::TaskData>();
+  failing_data->add_input(in);
+  failing_data->add_output(out);
+
+  ppc::core::TaskGraph graph;
+  auto failing = graph.add_task(std::make_shared<FailingTask>(failing_data), "failing");
+  auto skipped = graph.add_task(sum_task(out, next), "skipped");
+  EXPECT_FALSE(graph.run());
+  EXPECT_TRUE(graph.timings()[failing].executed);
+  EXPECT_FALSE(graph.timings()[failing].succeeded);
+  EXPECT_FALSE(graph.timings()[skipped].executed);
+  EXPECT_EQ(next[0], 0);
+}
+
+TEST(task_graph_tests, check_untyped_buffers) {
+  // 16 bytes per element, the buffer has no ElementType
+  struct Pair {
+    int64_t first;
+    int64_t second;
+  };
+  std::vector<Pair> pairs(4);
+  auto writer_data = std::make_shared<ppc::core::TaskData>();
+  writer_data->add_output(pairs);
+  // ints of the third pair, past the first 4 bytes of the buffer
+  auto reader_data = std::make_shared<ppc::core::TaskData>();
+  reader_data->add_input(reinterpret_cast<int *>(pairs.data()) + 8, 4);
+
+  ppc::core::TaskGraph graph;
+  auto writer = graph.add_task(std::make_shared<FailingTask>(writer_data), "writer");
+  auto reader = graph.add_task(std::make_shared<FailingTask>(reader_data), "reader");
+  EXPECT_EQ(graph.successors(writer), std::vector<ppc::core::TaskGraph::NodeId>{reader});
+
+  // raw pointers carry no element size, their range is unknown
+  std::vector<int> raw(4);
+  auto raw_data = std::make_shared<ppc::core::TaskData>();
+  raw_data->inputs.push_back(reinterpret_cast<uint8_t *>(raw.data()));
+  raw_data->inputs_count.push_back(raw.size());
+  EXPECT_THROW(graph.add_task(std::make_shared<FailingTask>(raw_data)), std::invalid_argument);
+  EXPECT_EQ(graph.size(), 2U);
+}
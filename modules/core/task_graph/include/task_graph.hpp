@@ -0,0 +1,78 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_TASK_GRAPH_HPP_
+#define MODULES_CORE_INCLUDE_TASK_GRAPH_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "core/scheduler/include/scheduler.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+struct NodeTiming {
+  std::string name;
+  // seconds from the start of TaskGraph::run()
+  double start = 0.0;
+  double finish = 0.0;
+  double duration = 0.0;
+  // duration of the longest chain of predecessors ending with this node
+  double path_time = 0.0;
+  bool executed = false;
+  bool succeeded = false;
+  bool on_critical_path = false;
+};
+
+// DAG of tasks. Every node runs the whole lifecycle of its task
+// (validation, pre_processing, run, post_processing) once per TaskGraph::run().
+// Dependencies are inferred from TaskData buffers in the order nodes are added:
+// a node depends on an earlier node when it reads or writes memory the earlier
+// node writes, or writes memory the earlier node reads. Nodes only reading the
+// same buffers run concurrently on the shared data without copies.
+class TaskGraph {
+ public:
+  using NodeId = std::size_t;
+
+  // name is used in timings, "node <id>" by default. Throws std::invalid_argument
+  // for buffers of unknown element size (raw TaskData pointers), use add_input/add_output.
+  NodeId add_task(std::shared_ptr<Task> task, std::string name = "");
+  // explicit edge, the after node starts when the before node finished
+  void add_dependency(NodeId before, NodeId after);
+
+  [[nodiscard]] std::size_t size() const { return nodes_.size(); }
+  [[nodiscard]] const std::vector<NodeId> &successors(NodeId node) const { return nodes_.at(node).successors; }
+
+  // Runs independent nodes concurrently. Nodes after a failed node (any stage
+  // returned false) are skipped. Returns true when every node succeeded,
+  // throws std::invalid_argument when explicit edges form a cycle.
+  bool run(Scheduler &scheduler = Scheduler::global());
+
+  // results of the last run
+  [[nodiscard]] const std::vector<NodeTiming> &timings() const { return timings_; }
+  [[nodiscard]] std::vector<NodeId> critical_path() const;
+  [[nodiscard]] double critical_path_time() const;
+  [[nodiscard]] double wall_time() const { return wall_time_; }
+  void print_timings(std::ostream &stream) const;
+
+ private:
+  struct Node {
+    std::shared_ptr<Task> task;
+    std::string name;
+    std::vector<NodeId> predecessors;
+    std::vector<NodeId> successors;
+  };
+
+  [[nodiscard]] std::vector<NodeId> topological_order() const;
+
+  std::vector<Node> nodes_;
+  std::vector<NodeTiming> timings_;
+  double wall_time_ = 0.0;
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_TASK_GRAPH_HPP_
@@ -0,0 +1,207 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/task_graph/include/task_graph.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+struct MemoryRange {
+  const uint8_t *begin;
+  const uint8_t *end;
+};
+
+// byte ranges of buffers, buffers of unknown element size are rejected: their
+// counts are in elements, a range made of them could miss an overlap
+std::vector<MemoryRange> buffer_ranges(const ppc::core::TaskData &taskData, bool outputs) {
+  std::vector<MemoryRange> ranges;
+  const auto count = outputs ? taskData.outputs.size() : taskData.inputs.size();
+  for (size_t i = 0; i < count; i++) {
+    auto buffer = outputs ? taskData.output_buffer(i) : taskData.input_buffer(i);
+    if (buffer.data == nullptr) continue;
+    const auto bytes = buffer.byte_size();
+    if (bytes == 0 && buffer.count != 0) {
+      throw std::invalid_argument(std::string("TaskGraph needs typed buffers, ") + (outputs ? "output " : "input ") +
+                                  std::to_string(i) + " has no element type");
+    }
+    ranges.push_back({buffer.data, buffer.data + std::max<std::uint64_t>(bytes, 1)});
+  }
+  return ranges;
+}
+
+bool overlap(const std::vector<MemoryRange> &a, const std::vector<MemoryRange> &b) {
+  return std::any_of(a.begin(), a.end(), [&](const MemoryRange &x) {
+    return std::any_of(b.begin(), b.end(), [&](const MemoryRange &y) { return x.begin < y.end && y.begin < x.end; });
+  });
+}
+
+}  // namespace
+
+ppc::core::TaskGraph::NodeId ppc::core::TaskGraph::add_task(std::shared_ptr<Task> task, std::string name) {
+  if (!task) {
+    throw std::invalid_argument("TaskGraph node needs a task");
+  }
+  const NodeId id = nodes_.size();
+  if (name.empty()) {
+    name = "node " + std::to_string(id);
+  }
+
+  Node node;
+  auto data = task->get_data();
+  auto reads = buffer_ranges(*data, false);
+  auto writes = buffer_ranges(*data, true);
+  for (NodeId other = 0; other < id; other++) {
+    auto other_data = nodes_[other].task->get_data();
+    auto other_reads = buffer_ranges(*other_data, false);
+    auto other_writes = buffer_ranges(*other_data, true);
+    // read after write, write after write, write after read
+    if (overlap(reads, other_writes) || overlap(writes, other_writes) || overlap(writes, other_reads)) {
+      nodes_[other].successors.push_back(id);
+      node.predecessors.push_back(other);
+    }
+  }
+  node.task = std::move(task);
+  node.name = std::move(name);
+  nodes_.push_back(std::move(node));
+  return id;
+}
+
+void ppc::core::TaskGraph::add_dependency(NodeId before, NodeId after) {
+  if (before >= nodes_.size() || after >= nodes_.size()) {
+    throw std::out_of_range("TaskGraph has no node with index " + std::to_string(std::max(before, after)));
+  }
+  if (before == after) {
+    throw std::invalid_argument("TaskGraph node can not depend on itself");
+  }
+  auto &successors = nodes_[before].successors;
+  if (std::find(successors.begin(), successors.end(), after) != successors.end()) return;
+  successors.push_back(after);
+  nodes_[after].predecessors.push_back(before);
+}
+
+std::vector<ppc::core::TaskGraph::NodeId> ppc::core::TaskGraph::topological_order() const {
+  std::vector<std::size_t> in_degree(nodes_.size());
+  for (const auto &node : nodes_) {
+    for (auto successor : node.successors) in_degree[successor]++;
+  }
+  std::vector<NodeId> order;
+  for (NodeId id = 0; id < nodes_.size(); id++) {
+    if (in_degree[id] == 0) order.push_back(id);
+  }
+  for (std::size_t i = 0; i < order.size(); i++) {
+    for (auto successor : nodes_[order[i]].successors) {
+      if (--in_degree[successor] == 0) order.push_back(successor);
+    }
+  }
+  if (order.size() != nodes_.size()) {
+    throw std::invalid_argument("TaskGraph dependencies form a cycle");
+  }
+  return order;
+}
+
+bool ppc::core::TaskGraph::run(Scheduler &scheduler) {
+  const auto order = topological_order();
+
+  timings_.assign(nodes_.size(), NodeTiming{});
+  std::vector<std::atomic<std::size_t>> remaining(nodes_.size());
+  std::vector<std::atomic<bool>> upstream_failed(nodes_.size());
+  for (NodeId id = 0; id < nodes_.size(); id++) {
+    timings_[id].name = nodes_[id].name;
+    remaining[id] = nodes_[id].predecessors.size();
+    upstream_failed[id] = false;
+  }
+
+  const auto t0 = std::chrono::steady_clock::now();
+  auto seconds_since_start = [&] {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+  };
+
+  TaskGroup group(scheduler);
+  std::function<void(NodeId)> execute_node = [&](NodeId id) {
+    auto &timing = timings_[id];
+    bool succeeded = false;
+    if (!upstream_failed[id]) {
+      auto &task = *nodes_[id].task;
+      timing.executed = true;
+      timing.start = seconds_since_start();
+      succeeded = task.validation() && task.pre_processing() && task.run() && task.post_processing();
+      timing.finish = seconds_since_start();
+      timing.duration = timing.finish - timing.start;
+    }
+    timing.succeeded = succeeded;
+    for (auto successor : nodes_[id].successors) {
+      if (!succeeded) upstream_failed[successor] = true;
+      if (remaining[successor].fetch_sub(1) == 1) {
+        group.run([&execute_node, successor] { execute_node(successor); });
+      }
+    }
+  };
+  for (auto id : order) {
+    if (nodes_[id].predecessors.empty()) {
+      group.run([&execute_node, id] { execute_node(id); });
+    }
+  }
+  group.wait();
+  wall_time_ = seconds_since_start();
+
+  // longest chain of node durations ending with every node
+  for (auto id : order) {
+    double longest = 0.0;
+    for (auto predecessor : nodes_[id].predecessors) {
+      longest = std::max(longest, timings_[predecessor].path_time);
+    }
+    timings_[id].path_time = longest + timings_[id].duration;
+  }
+  for (auto id : critical_path()) {
+    timings_[id].on_critical_path = true;
+  }
+
+  return std::all_of(timings_.begin(), timings_.end(), [](const NodeTiming &timing) { return timing.succeeded; });
+}
+
+std::vector<ppc::core::TaskGraph::NodeId> ppc::core::TaskGraph::critical_path() const {
+  std::vector<NodeId> path;
+  if (timings_.empty()) return path;
+  auto by_path_time = [&](NodeId a, NodeId b) { return timings_[a].path_time < timings_[b].path_time; };
+  NodeId current = 0;
+  for (NodeId id = 1; id < timings_.size(); id++) {
+    if (by_path_time(current, id)) current = id;
+  }
+  while (true) {
+    path.push_back(current);
+    const auto &predecessors = nodes_[current].predecessors;
+    if (predecessors.empty()) break;
+    current = *std::max_element(predecessors.begin(), predecessors.end(), by_path_time);
+  }
+  std::reverse(path.begin(), path.end());
+  return path;
+}
+
+double ppc::core::TaskGraph::critical_path_time() const {
+  double time = 0.0;
+  for (const auto &timing : timings_) {
+    time = std::max(time, timing.path_time);
+  }
+  return time;
+}
+
+void ppc::core::TaskGraph::print_timings(std::ostream &stream) const {
+  stream << std::fixed << std::setprecision(6);
+  for (const auto &timing : timings_) {
+    stream << timing.name << ": start=" << timing.start << " duration=" << timing.duration
+           << " path=" << timing.path_time << (timing.on_critical_path ? " critical" : "")
+           << (timing.executed ? "" : " skipped") << (timing.executed && !timing.succeeded ? " failed" : "")
+           << std::endl;
+  }
+  stream << "critical path:";
+  for (auto id : critical_path()) {
+    stream << " " << timings_[id].name;
+  }
+  stream << " (" << critical_path_time() << " secs), wall time " << wall_time_ << " secs" << std::endl;
+}
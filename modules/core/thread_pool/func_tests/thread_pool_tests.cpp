@@ -0,0 +1,112 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/thread_pool/include/parallel_reduce.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/util.hpp"
+
+TEST(thread_pool_tests, check_balanced_chunks) {
+  using Chunk = std::pair<size_t, size_t>;
+  // 10 elements in 4 chunks: 3, 3, 2, 2
+  EXPECT_EQ(ppc::core::balanced_chunk(0, 10, 4, 0), Chunk(0, 3));
+  EXPECT_EQ(ppc::core::balanced_chunk(0, 10, 4, 1), Chunk(3, 6));
+  EXPECT_EQ(ppc::core::balanced_chunk(0, 10, 4, 2), Chunk(6, 8));
+  EXPECT_EQ(ppc::core::balanced_chunk(0, 10, 4, 3), Chunk(8, 10));
+  EXPECT_EQ(ppc::core::balanced_chunk(5, 7, 4, 3), Chunk(7, 7));
+}
+
+TEST(thread_pool_tests, check_run_on_every_thread) {
+  ppc::core::ThreadPool pool(4);
+  ASSERT_EQ(pool.size(), 4);
+  std::vector<int> visits(4, 0);
+  pool.run([&](int thread_index) { visits[thread_index]++; });
+  EXPECT_EQ(visits, std::vector<int>(4, 1));
+}
+
+TEST(thread_pool_tests, check_parallel_for_covers_range_once) {
+  ppc::core::ThreadPool pool(3);
+  // fewer elements than threads and sizes not divisible by the count of threads
+  for (size_t count : {0, 1, 2, 7, 100, 1001}) {
+    std::vector<std::atomic<int>> visits(count);
+    pool.parallel_for(0, count, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; i++) {
+        visits[i]++;
+      }
+    });
+    for (size_t i = 0; i < count; i++) {
+      EXPECT_EQ(visits[i].load(), 1);
+    }
+  }
+}
+
+TEST(thread_pool_tests, check_parallel_reduce_sum) {
+  ppc::core::ThreadPool pool(4);
+  std::vector<int> in(1003);
+  std::iota(in.begin(), in.end(), 1);
+  for (int repeat = 0; repeat < 100; repeat++) {
+    auto sum = ppc::core::parallel_reduce(
+        pool, 0, in.size(), 0,
+        [&](size_t begin, size_t end) { return std::accumulate(in.begin() + begin, in.begin() + end, 0); },
+        std::plus<>());
+    ASSERT_EQ(sum, 1003 * 1004 / 2);
+  }
+}
+
+TEST(thread_pool_tests, check_parallel_reduce_in_place) {
+  ppc::core::ThreadPool pool(3);
+  // sizes smaller than and not divisible by the count of threads
+  for (size_t count : {0, 1, 2, 4, 5, 1000, 1001}) {
+    std::vector<int64_t> in(count);
+    std::iota(in.begin(), in.end(), 1);
+    auto sum = ppc::core::parallel_reduce(pool, in.data(), in.data() + in.size(), int64_t{0}, std::plus<>());
+    EXPECT_EQ(sum, static_cast<int64_t>(count * (count + 1) / 2));
+  }
+}
+
+TEST(thread_pool_tests, check_tree_combine_keeps_order) {
+  std::vector<ppc::core::PaddedValue<std::string>> partials;
+  for (char c = 'a'; c <= 'g'; c++) {
+    partials.push_back({std::string(1, c)});
+  }
+  EXPECT_EQ(ppc::core::tree_combine(partials, std::plus<>()), "abcdefg");
+}
+
+TEST(thread_pool_tests, check_partials_are_padded) {
+  EXPECT_EQ(alignof(ppc::core::PaddedValue<int>), ppc::core::cache_line_size);
+  EXPECT_EQ(sizeof(ppc::core::PaddedValue<int>), ppc::core::cache_line_size);
+  std::vector<ppc::core::PaddedValue<int>> partials(2);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(&partials[1]) - reinterpret_cast<uintptr_t>(&partials[0]),
+            ppc::core::cache_line_size);
+}
+
+TEST(thread_pool_tests, check_exception_is_rethrown) {
+  ppc::core::ThreadPool pool(3);
+  EXPECT_THROW(pool.run([](int thread_index) {
+    if (thread_index == 2) throw std::runtime_error("error in worker");
+  }),
+               std::runtime_error);
+  // pool is still usable after the exception
+  std::atomic<int> count = 0;
+  pool.run([&](int) { count++; });
+  EXPECT_EQ(count.load(), 3);
+}
+
+TEST(thread_pool_tests, check_nested_jobs_run_inline) {
+  ppc::core::ThreadPool pool(2);
+  std::atomic<int> count = 0;
+  pool.run([&](int) { pool.run([&](int) { count++; }); });
+  EXPECT_EQ(count.load(), 4);
+}
+
+TEST(thread_pool_tests, check_global_pool_size) {
+  EXPECT_EQ(ppc::core::ThreadPool::global().size(), ppc::util::get_num_threads());
+}
@@ -0,0 +1,90 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_PARALLEL_REDUCE_HPP_
+#define MODULES_CORE_INCLUDE_PARALLEL_REDUCE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/arena/include/arena.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace ppc::core {
+
+// Partial result of one thread on its own cache line, so threads writing
+// neighbouring partials do not invalidate each other's lines
+template <class T>
+struct alignas(cache_line_size) PaddedValue {
+  T value;
+};
+
+// Combines partials pairwise in log2(n) levels keeping their order:
+// (p0 + p1) + (p2 + p3), so combine does not need to be commutative
+template <class T, class Combine>
+T tree_combine(std::span<PaddedValue<T>> partials, Combine &&combine) {
+  const std::size_t count = partials.size();
+  for (std::size_t step = 1; step < count; step *= 2) {
+    for (std::size_t i = 0; i + step < count; i += 2 * step) {
+      partials[i].value = combine(partials[i].value, partials[i + step].value);
+    }
+  }
+  return partials.front().value;
+}
+
+template <class T, class Combine>
+T tree_combine(std::vector<PaddedValue<T>> &partials, Combine &&combine) {
+  return tree_combine(std::span<PaddedValue<T>>(partials), std::forward<Combine>(combine));
+}
+
+// Reduces map(chunk_begin, chunk_end) over balanced chunks of [begin, end),
+// one chunk per pool thread, the remainder is spread over the first chunks
+template <class T, class Map, class Combine>
+T parallel_reduce(ThreadPool &pool, std::size_t begin, std::size_t end, T identity, Map &&map, Combine &&combine) {
+  if (begin >= end) return identity;
+  const auto parts = std::min<std::size_t>(static_cast<std::size_t>(pool.size()), end - begin);
+  auto reduce = [&](std::span<PaddedValue<T>> partials) {
+    pool.run([&](int thread_index) {
+      const auto index = static_cast<std::size_t>(thread_index);
+      if (index >= parts) return;
+      auto [chunk_begin, chunk_end] = balanced_chunk(begin, end, parts, index);
+      partials[index].value = map(chunk_begin, chunk_end);
+    });
+    return tree_combine(partials, combine);
+  };
+  if constexpr (std::is_trivially_destructible_v<T>) {
+    // partials of repeated reductions reuse the memory of the calling thread
+    ArenaScope scope(thread_arena());
+    return reduce(thread_arena().allocate_array(parts, PaddedValue<T>{identity}));
+  } else {
+    std::vector<PaddedValue<T>> partials(parts, PaddedValue<T>{identity});
+    return reduce(partials);
+  }
+}
+
+// Reduces contiguous elements [first, last) in place with combine(accumulator, element)
+template <class T, class U, class Combine>
+T parallel_reduce(ThreadPool &pool, const U *first, const U *last, T identity, Combine &&combine) {
+  return parallel_reduce(
+      pool, 0, static_cast<std::size_t>(last - first), identity,
+      [&](std::size_t chunk_begin, std::size_t chunk_end) {
+        T accumulator = identity;
+        for (const U *it = first + chunk_begin; it != first + chunk_end; ++it) {
+          accumulator = combine(accumulator, *it);
+        }
+        return accumulator;
+      },
+      combine);
+}
+
+template <class T, class U, class Combine>
+T parallel_reduce(const U *first, const U *last, T identity, Combine &&combine) {
+  return parallel_reduce(ThreadPool::global(), first, last, identity, std::forward<Combine>(combine));
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_PARALLEL_REDUCE_HPP_
@@ -0,0 +1,91 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_THREAD_POOL_HPP_
+#define MODULES_CORE_INCLUDE_THREAD_POOL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "core/numa/include/numa.hpp"
+
+namespace ppc::core {
+
+// Bounds of the index-th of parts contiguous chunks of [begin, end).
+// Chunk sizes differ by at most one element, the remainder goes to the first chunks.
+inline std::pair<std::size_t, std::size_t> balanced_chunk(std::size_t begin, std::size_t end, std::size_t parts,
+                                                          std::size_t index) {
+  const std::size_t size = end - begin;
+  const std::size_t base = size / parts;
+  const std::size_t remainder = size % parts;
+  const std::size_t first = begin + index * base + std::min(index, remainder);
+  return {first, first + base + (index < remainder ? 1 : 0)};
+}
+
+// Persistent pool of threads created once and reused by every run of a task.
+// The calling thread takes part in each job as thread 0, so a pool of size n
+// owns n - 1 worker threads. Jobs submitted from a pool thread (nested
+// parallelism) run inline on that thread.
+class ThreadPool {
+ public:
+  // num_threads: 0 - ppc::util::get_num_threads()
+  // affinity: placement of worker i on thread_cpu(NumaTopology::system(), affinity, i),
+  // the calling thread is never pinned (Linux only)
+  explicit ThreadPool(int num_threads = 0, AffinityPolicy affinity = AffinityPolicy::NONE);
+  // pool of cpus.size() threads, worker i is pinned to cpus[i] (-1 - not pinned);
+  // cpus[0] is the place of the calling thread, the pool does not pin it
+  explicit ThreadPool(const std::vector<int> &cpus);
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ~ThreadPool();
+
+  [[nodiscard]] int size() const { return static_cast<int>(workers_.size()) + 1; }
+
+  // Runs job(thread_index) once on every thread of the pool and waits for all of them.
+  // The first exception thrown by the job is rethrown in the calling thread.
+  void run(const std::function<void(int)> &job);
+
+  // Calls body(chunk_begin, chunk_end) for size() balanced chunks of [begin, end)
+  template <class Body>
+  void parallel_for(std::size_t begin, std::size_t end, Body &&body) {
+    if (begin >= end) return;
+    const auto parts = std::min<std::size_t>(static_cast<std::size_t>(size()), end - begin);
+    run([&](int thread_index) {
+      const auto index = static_cast<std::size_t>(thread_index);
+      if (index >= parts) return;
+      auto [chunk_begin, chunk_end] = balanced_chunk(begin, end, parts, index);
+      body(chunk_begin, chunk_end);
+    });
+  }
+
+  // Pool shared by all tasks: ppc::util::get_num_threads() threads placed by
+  // affinity_policy(). Created on first use.
+  static ThreadPool &global();
+
+ private:
+  void worker_loop(int thread_index, int cpu);
+
+  std::vector<std::thread> workers_;
+  // serializes jobs submitted from different threads
+  std::mutex submit_mutex_;
+  std::mutex mutex_;
+  std::condition_variable job_ready_;
+  std::condition_variable job_done_;
+  const std::function<void(int)> *job_ = nullptr;
+  std::atomic<std::uint64_t> generation_ = 0;
+  std::atomic<int> pending_ = 0;
+  std::exception_ptr error_;
+  bool stop_ = false;
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_THREAD_POOL_HPP_
@@ -0,0 +1,118 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/thread_pool/include/thread_pool.hpp"
+
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// set for threads owned by any pool, jobs submitted from them run inline
+thread_local bool inside_pool = false;
+
+// yields before blocking on the condition variable, short jobs follow each other closely in perf runs
+constexpr int spin_count = 1000;
+
+}  // namespace
+
+ppc::core::ThreadPool::ThreadPool(int num_threads, AffinityPolicy affinity) {
+  if (num_threads <= 0) {
+    num_threads = ppc::util::get_num_threads();
+  }
+  workers_.reserve(num_threads - 1);
+  for (int i = 1; i < num_threads; i++) {
+    const int cpu = thread_cpu(NumaTopology::system(), affinity, i);
+    workers_.emplace_back(&ThreadPool::worker_loop, this, i, cpu);
+  }
+}
+
+ppc::core::ThreadPool::ThreadPool(const std::vector<int> &cpus) {
+  workers_.reserve(cpus.empty() ? 0 : cpus.size() - 1);
+  for (std::size_t i = 1; i < cpus.size(); i++) {
+    workers_.emplace_back(&ThreadPool::worker_loop, this, static_cast<int>(i), cpus[i]);
+  }
+}
+
+ppc::core::ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  job_ready_.notify_all();
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+void ppc::core::ThreadPool::run(const std::function<void(int)> &job) {
+  if (workers_.empty() || inside_pool) {
+    for (int i = 0; i < size(); i++) {
+      job(i);
+    }
+    return;
+  }
+
+  std::lock_guard<std::mutex> submit_lock(submit_mutex_);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    job_ = &job;
+    error_ = nullptr;
+    pending_.store(static_cast<int>(workers_.size()), std::memory_order_relaxed);
+    generation_.fetch_add(1, std::memory_order_release);
+  }
+  job_ready_.notify_all();
+
+  inside_pool = true;
+  try {
+    job(0);
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!error_) error_ = std::current_exception();
+  }
+  inside_pool = false;
+
+  for (int spin = 0; spin < spin_count && pending_.load(std::memory_order_acquire) != 0; spin++) {
+    std::this_thread::yield();
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  job_done_.wait(lock, [this] { return pending_.load(std::memory_order_acquire) == 0; });
+  job_ = nullptr;
+  if (error_) {
+    auto error = error_;
+    error_ = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+void ppc::core::ThreadPool::worker_loop(int thread_index, int cpu) {
+  // pinned before the first job, so first touches of the worker are on its node
+  if (cpu >= 0) pin_current_thread(cpu);
+  inside_pool = true;
+  std::uint64_t seen_generation = 0;
+  while (true) {
+    for (int spin = 0; spin < spin_count && generation_.load(std::memory_order_acquire) == seen_generation; spin++) {
+      std::this_thread::yield();
+    }
+    const std::function<void(int)> *job = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      job_ready_.wait(lock, [&] { return stop_ || generation_.load(std::memory_order_acquire) != seen_generation; });
+      if (stop_) return;
+      seen_generation = generation_.load(std::memory_order_acquire);
+      job = job_;
+    }
+    try {
+      (*job)(thread_index);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!error_) error_ = std::current_exception();
+    }
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      job_done_.notify_one();
+    }
+  }
+}
+
+ppc::core::ThreadPool &ppc::core::ThreadPool::global() {
+  static ThreadPool pool(ppc::util::get_num_threads(), affinity_policy());
+  return pool;
+}
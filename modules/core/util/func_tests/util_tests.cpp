@@ -0,0 +1,66 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// sets or removes (value == nullptr) an environment variable
+void set_env(const char *name, const char *value) {
+#ifdef _WIN32
+  _putenv_s(name, value != nullptr ? value : "");
+#else
+  if (value != nullptr) {
+    setenv(name, value, 1);
+  } else {
+    unsetenv(name);
+  }
+#endif
+}
+
+}  // namespace
+
+TEST(util_tests, check_num_threads_from_env) {
+  set_env("PPC_NUM_THREADS", "3");
+  EXPECT_EQ(ppc::util::get_num_threads(), 3);
+  set_env("PPC_NUM_THREADS", nullptr);
+}
+
+TEST(util_tests, check_num_threads_default) {
+  set_env("PPC_NUM_THREADS", nullptr);
+  EXPECT_EQ(ppc::util::get_num_threads(), std::max(1, static_cast<int>(std::thread::hardware_concurrency())));
+  set_env("PPC_NUM_THREADS", "abc");
+  EXPECT_EQ(ppc::util::get_num_threads(), std::max(1, static_cast<int>(std::thread::hardware_concurrency())));
+  set_env("PPC_NUM_THREADS", "0");
+  EXPECT_GE(ppc::util::get_num_threads(), 1);
+  set_env("PPC_NUM_THREADS", nullptr);
+}
+
+TEST(util_tests, check_perf_size_scale) {
+  set_env("PPC_PERF_SCALE", nullptr);
+  EXPECT_EQ(ppc::util::get_perf_size(100), 100U);
+  set_env("PPC_PERF_SCALE", "2.5");
+  EXPECT_DOUBLE_EQ(ppc::util::get_perf_scale(), 2.5);
+  EXPECT_EQ(ppc::util::get_perf_size(100), 250U);
+  set_env("PPC_PERF_SCALE", "0.001");
+  EXPECT_EQ(ppc::util::get_perf_size(100), 1U);
+  set_env("PPC_PERF_SCALE", "-1");
+  EXPECT_EQ(ppc::util::get_perf_size(100), 100U);
+  set_env("PPC_PERF_SCALE", nullptr);
+}
+
+TEST(util_tests, check_seed_from_env) {
+  set_env("PPC_SEED", nullptr);
+  const auto default_seed = ppc::util::get_seed();
+  set_env("PPC_SEED", "12345");
+  EXPECT_EQ(ppc::util::get_seed(), 12345U);
+  set_env("PPC_SEED", "-3");
+  EXPECT_EQ(ppc::util::get_seed(), default_seed);
+  set_env("PPC_SEED", "7x");
+  EXPECT_EQ(ppc::util::get_seed(), default_seed);
+  set_env("PPC_SEED", nullptr);
+}
@@ -0,0 +1,31 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_UTIL_HPP_
+#define MODULES_CORE_INCLUDE_UTIL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ppc::util {
+
+// Count of threads used by parallel tasks: PPC_NUM_THREADS when it is set to
+// a positive number, otherwise the count of hardware threads (at least 1).
+int get_num_threads();
+
+// Pinning of pool threads to cores: disabled when PPC_PIN_THREADS is 0.
+bool get_pin_threads();
+
+// Multiplier of perf tests input sizes: PPC_PERF_SCALE when it is set to
+// a positive number, otherwise 1.
+double get_perf_scale();
+
+// Input size of a perf test with the given base size scaled by get_perf_scale()
+std::size_t get_perf_size(std::size_t base_size);
+
+// Seed of generated inputs: PPC_SEED when it is set to a non-negative
+// integer, otherwise a fixed default, so runs are reproducible.
+std::uint64_t get_seed();
+
+}  // namespace ppc::util
+
+#endif  // MODULES_CORE_INCLUDE_UTIL_HPP_
@@ -0,0 +1,54 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/util/include/util.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+namespace {
+
+// positive value of a numeric environment variable, 0 when it is unset or invalid
+double positive_env_value(const char *name) {
+  const char *value = std::getenv(name);
+  if (value == nullptr) return 0.0;
+  char *end = nullptr;
+  double result = std::strtod(value, &end);
+  if (end == value || *end != '\0' || !std::isfinite(result) || result <= 0.0) return 0.0;
+  return result;
+}
+
+}  // namespace
+
+int ppc::util::get_num_threads() {
+  double num_threads = positive_env_value("PPC_NUM_THREADS");
+  if (num_threads >= 1.0) {
+    return static_cast<int>(std::min(num_threads, 1024.0));
+  }
+  return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+bool ppc::util::get_pin_threads() {
+  const char *value = std::getenv("PPC_PIN_THREADS");
+  return value == nullptr || std::string(value) != "0";
+}
+
+double ppc::util::get_perf_scale() {
+  double scale = positive_env_value("PPC_PERF_SCALE");
+  return scale > 0.0 ? scale : 1.0;
+}
+
+std::size_t ppc::util::get_perf_size(std::size_t base_size) {
+  auto size = static_cast<std::size_t>(std::llround(static_cast<double>(base_size) * get_perf_scale()));
+  return std::max<std::size_t>(size, 1);
+}
+
+std::uint64_t ppc::util::get_seed() {
+  constexpr std::uint64_t default_seed = 20240601;
+  const char *value = std::getenv("PPC_SEED");
+  if (value == nullptr || *value == '\0' || *value == '-') return default_seed;
+  char *end = nullptr;
+  const std::uint64_t seed = std::strtoull(value, &end, 10);
+  return *end == '\0' ? seed : default_seed;
+}
@@ -1,8 +1,10 @@
 // Copyright 2023 Nesterov Alexander
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <vector>
 
+#include "core/stream/include/stream.hpp"
 #include "core/task/include/task.hpp"
 #include "ref/average_of_vector_elements/include/ref_task.hpp"
 
@@ -133,3 +135,27 @@ TEST(average_of_vector_elements, check_float) {
   testTask.post_processing();
   EXPECT_NEAR(out[0], 1.5, 1e-5);
 }
+
+TEST(average_of_vector_elements, check_streamed_input) {
+  // Create data
+  std::vector<int32_t> in(1256);
+  std::vector<double> out(1, 0);
+  for (size_t i = 0; i < in.size(); i++) {
+    in[i] = static_cast<int32_t>(i % 3);
+  }
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(ppc::core::stream_buffer(std::make_shared<ppc::core::MemorySource<int32_t>>(in)));
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::AverageOfVectorElements<int32_t, double> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  EXPECT_NEAR(out[0], 1255.0 / 1256.0, 1e-5);
+}
@@ -9,6 +9,7 @@
 #include <numeric>
 #include <vector>
 
+#include "core/stream/include/stream.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ppc {
@@ -20,12 +21,9 @@ class AverageOfVectorElements : public ppc::core::Task {
   explicit AverageOfVectorElements(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
   bool pre_processing() override {
     internal_order_test();
-    // Init vectors
-    input_ = std::vector<InType>(taskData->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InType*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init view of input data, streamed inputs are read in run()
+    streamed_ = taskData->input_buffer(0).streamed();
+    if (!streamed_) input_ = taskData->input_view<InType>(0);
     // Init value for output
     average = 0.0;
     return true;
@@ -39,8 +37,14 @@ class AverageOfVectorElements : public ppc::core::Task {
 
   bool run() override {
     internal_order_test();
+    if (streamed_) {
+      auto stream = ppc::core::input_stream<InType>(*taskData, 0);
+      auto [sum, count] = ppc::core::stream_accumulate(stream, 0.0);
+      average = static_cast<OutType>(sum) / static_cast<OutType>(count);
+      return true;
+    }
     average = static_cast<OutType>(std::accumulate(input_.begin(), input_.end(), 0.0));
-    average /= static_cast<OutType>(taskData->inputs_count[0]);
+    average /= static_cast<OutType>(input_.size());
     return true;
   }
 
@@ -51,7 +55,8 @@ class AverageOfVectorElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InType> input_;
+  bool streamed_ = false;
+  ppc::core::DataView<const InType> input_;
   OutType average;
 };
 
@@ -1,8 +1,10 @@
 // Copyright 2023 Nesterov Alexander
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <vector>
 
+#include "core/stream/include/stream.hpp"
 #include "core/task/include/task.hpp"
 #include "ref/max_of_vector_elements/include/ref_task.hpp"
 
@@ -181,3 +183,30 @@ TEST(max_of_vector_elements, check_float) {
   EXPECT_NEAR(out[0], 1.01f, 1e-6f);
   ASSERT_EQ(out_index[0], 0ull);
 }
+
+TEST(max_of_vector_elements, check_streamed_input) {
+  // Create data
+  std::vector<int32_t> in(1256, 1);
+  std::vector<int32_t> out(1, 0);
+  std::vector<uint64_t> out_index(1, 0);
+  in[328] = 10;
+  in[900] = 10;
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(ppc::core::stream_buffer(std::make_shared<ppc::core::MemorySource<int32_t>>(in)));
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out_index.data()));
+  taskData->outputs_count.emplace_back(out_index.size());
+
+  // Create Task
+  ppc::reference::MaxOfVectorElements<int32_t, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  ASSERT_EQ(out[0], 10);
+  ASSERT_EQ(out_index[0], 328ull);
+}
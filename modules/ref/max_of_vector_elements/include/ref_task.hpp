@@ -5,11 +5,11 @@
 
 #include <gtest/gtest.h>
 
-#include <algorithm>
 #include <memory>
-#include <numeric>
 #include <vector>
 
+#include "core/simd/include/simd.hpp"
+#include "core/stream/include/stream.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ppc {
@@ -21,12 +21,9 @@ class MaxOfVectorElements : public ppc::core::Task {
   explicit MaxOfVectorElements(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
   bool pre_processing() override {
     internal_order_test();
-    // Init vectors
-    input_ = std::vector<InOutType>(taskData->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init view of input data, streamed inputs are read in run()
+    streamed_ = taskData->input_buffer(0).streamed();
+    if (!streamed_) input_ = taskData->input_view<InOutType>(0);
     // Init value for output
     max = 0.0;
     max_index = 0;
@@ -41,14 +38,22 @@ class MaxOfVectorElements : public ppc::core::Task {
     isCountValuesCorrect = taskData->outputs_count[0] == 1;
     isCountIndexesCorrect = taskData->outputs_count[1] == 1;
 
-    return isCountValuesCorrect && isCountIndexesCorrect;
+    // Check the input is not empty
+    return isCountValuesCorrect && isCountIndexesCorrect && taskData->inputs_count[0] > 0;
   }
 
   bool run() override {
     internal_order_test();
-    auto result = std::max_element(input_.begin(), input_.end());
-    max = static_cast<InOutType>(*result);
-    max_index = static_cast<IndexType>(std::distance(input_.begin(), result));
+    if (streamed_) {
+      auto stream = ppc::core::input_stream<InOutType>(*taskData, 0);
+      auto result = ppc::core::stream_extremum<false>(stream);
+      max = result.value;
+      max_index = static_cast<IndexType>(result.index);
+      return true;
+    }
+    auto result = ppc::core::simd::max_element(input_.data(), input_.size());
+    max = result.value;
+    max_index = static_cast<IndexType>(result.index);
     return true;
   }
 
@@ -60,7 +65,8 @@ class MaxOfVectorElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  bool streamed_ = false;
+  ppc::core::DataView<const InOutType> input_;
   InOutType max;
   IndexType max_index;
 };
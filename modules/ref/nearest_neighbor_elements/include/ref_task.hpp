@@ -5,12 +5,9 @@
 
 #include <gtest/gtest.h>
 
-#include <algorithm>
-#include <functional>
 #include <memory>
-#include <numeric>
-#include <vector>
 
+#include "core/neighbor_scan/include/neighbor_scan.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ppc {
@@ -18,16 +15,14 @@ namespace reference {
 
 template <class InOutType, class IndexType>
 class NearestNeighborElements : public ppc::core::Task {
+  using Kernel = ppc::core::NearestPair<InOutType, IndexType>;
+
  public:
   explicit NearestNeighborElements(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
   bool pre_processing() override {
     internal_order_test();
-    // Init vectors
-    input_ = std::vector<InOutType>(taskData->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init view of input data
+    input_ = taskData->input_view<InOutType>(0);
     // Init value for output
     l_elem = r_elem = 0;
     l_elem_index = r_elem_index = 0;
@@ -36,26 +31,19 @@ class NearestNeighborElements : public ppc::core::Task {
 
   bool validation() override {
     internal_order_test();
-    // Check count elements of output
-    return taskData->outputs_count[0] == 2 && taskData->outputs_count[1] == 2;
+    // Check count elements of input and output
+    return Kernel::check(*taskData);
   }
 
   bool run() override {
     internal_order_test();
-    auto rotate_in = input_;
-    int rot_left = 1;
-    rotate(rotate_in.begin(), rotate_in.begin() + rot_left, rotate_in.end());
-
-    auto temp_res = std::vector<InOutType>(input_.size());
-    std::transform(input_.begin(), input_.end(), rotate_in.begin(), temp_res.begin(),
-                   [](InOutType x, InOutType y) { return std::abs(x - y); });
-
-    auto result = std::min_element(temp_res.begin(), temp_res.end() - 1);
-    l_elem_index = static_cast<IndexType>(std::distance(temp_res.begin(), result));
-    l_elem = input_[l_elem_index];
+    // single pass over adjacent pairs of the view
+    auto result = ppc::core::scan_neighbors<Kernel>(input_.data(), input_.size());
+    l_elem_index = static_cast<IndexType>(result.index);
+    l_elem = input_[result.index];
 
     r_elem_index = l_elem_index + 1;
-    r_elem = input_[r_elem_index];
+    r_elem = input_[result.index + 1];
     return true;
   }
 
@@ -69,7 +57,7 @@ class NearestNeighborElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  ppc::core::DataView<const InOutType> input_;
   InOutType l_elem, r_elem;
   IndexType l_elem_index, r_elem_index;
 };
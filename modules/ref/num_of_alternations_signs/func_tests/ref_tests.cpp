@@ -2,8 +2,10 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <memory>
 #include <vector>
 
+#include "core/stream/include/stream.hpp"
 #include "core/task/include/task.hpp"
 #include "ref/num_of_alternations_signs/include/ref_task.hpp"
 
@@ -144,3 +146,29 @@ TEST(num_of_alternations_signs, check_float) {
   testTask.post_processing();
   ASSERT_EQ(out[0], 2ull);
 }
+
+TEST(num_of_alternations_signs, check_streamed_input) {
+  // Create data
+  std::vector<int32_t> in(1256, 1);
+  std::vector<uint64_t> out(1, 0);
+  for (size_t i = 0; i < in.size(); i++) {
+    if (i % 2 == 0) {
+      in[i] *= -1;
+    }
+  }
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(ppc::core::stream_buffer(std::make_shared<ppc::core::MemorySource<int32_t>>(in)));
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::NumOfAlternationsSigns<int32_t, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  ASSERT_EQ(out[0], in.size() - 1);
+}
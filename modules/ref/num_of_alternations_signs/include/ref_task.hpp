@@ -5,12 +5,10 @@
 
 #include <gtest/gtest.h>
 
-#include <algorithm>
-#include <functional>
 #include <memory>
-#include <numeric>
-#include <vector>
 
+#include "core/neighbor_scan/include/neighbor_scan.hpp"
+#include "core/stream/include/stream.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ppc {
@@ -18,16 +16,15 @@ namespace reference {
 
 template <class InOutType, class CountType>
 class NumOfAlternationsSigns : public ppc::core::Task {
+  using Kernel = ppc::core::SignAlternationCount<InOutType, CountType>;
+
  public:
   explicit NumOfAlternationsSigns(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
   bool pre_processing() override {
     internal_order_test();
-    // Init vectors
-    input_ = std::vector<InOutType>(taskData->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init view of input data, streamed inputs are read in run()
+    streamed_ = taskData->input_buffer(0).streamed();
+    if (!streamed_) input_ = taskData->input_view<InOutType>(0);
     // Init value for output
     num = 0;
     return true;
@@ -35,20 +32,20 @@ class NumOfAlternationsSigns : public ppc::core::Task {
 
   bool validation() override {
     internal_order_test();
-    // Check count elements of output
-    return taskData->outputs_count[0] == 1;
+    // Check count elements of input and output
+    return Kernel::check(*taskData);
   }
 
   bool run() override {
     internal_order_test();
-    auto rotate_in = input_;
-    int rot_left = 1;
-    rotate(rotate_in.begin(), rotate_in.begin() + rot_left, rotate_in.end());
-
-    auto temp_res = input_;
-    std::transform(input_.begin(), input_.end(), rotate_in.begin(), temp_res.begin(), std::multiplies<>());
-
-    num = std::count_if(temp_res.begin(), temp_res.end() - 1, [](InOutType elem) { return elem < 0; });
+    if (streamed_) {
+      // pairs across chunk boundaries are counted with the carried element
+      auto stream = ppc::core::input_stream<InOutType>(*taskData, 0);
+      num = ppc::core::stream_scan_neighbors<Kernel>(stream);
+      return true;
+    }
+    // single pass over adjacent pairs of the view
+    num = ppc::core::scan_neighbors<Kernel>(input_.data(), input_.size());
     return true;
   }
 
@@ -59,7 +56,8 @@ class NumOfAlternationsSigns : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  bool streamed_ = false;
+  ppc::core::DataView<const InOutType> input_;
   CountType num;
 };
 
@@ -0,0 +1,72 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/sparse_matrix_vector_product/include/ref_task.hpp"
+
+namespace {
+
+// 3 x 4 matrix {{1, 0, 0, 2}, {0, 0, 0, 0}, {3, 4, 0, 5}} times {1, 2, 3, 4}
+template <class InOutType>
+std::vector<InOutType> run_product(ppc::core::SparseFormat format) {
+  std::vector<InOutType> dense = {1, 0, 0, 2, 0, 0, 0, 0, 3, 4, 0, 5};
+  auto matrix = ppc::core::SparseMatrix<InOutType, uint64_t>::from_dense(
+      ppc::core::MatrixView<InOutType>::row_major(dense.data(), 3, 4), format);
+  auto shape = matrix.shape();
+  std::vector<InOutType> x = {1, 2, 3, 4};
+  std::vector<InOutType> out(3);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(matrix.values);
+  taskData->add_input(matrix.indices);
+  taskData->add_input(matrix.offsets);
+  taskData->add_input(shape);
+  taskData->add_input(x);
+  taskData->add_output(out);
+
+  // Create Task
+  ppc::reference::SparseMatrixVectorProduct<InOutType, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  EXPECT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  return out;
+}
+
+}  // namespace
+
+TEST(sparse_matrix_vector_product, check_csr_int32_t) {
+  ASSERT_EQ(run_product<int32_t>(ppc::core::SparseFormat::CSR), (std::vector<int32_t>{9, 0, 31}));
+}
+
+TEST(sparse_matrix_vector_product, check_csc_double) {
+  ASSERT_EQ(run_product<double>(ppc::core::SparseFormat::CSC), (std::vector<double>{9, 0, 31}));
+}
+
+TEST(sparse_matrix_vector_product, check_validate_func) {
+  // Create data, the vector is shorter than a row
+  std::vector<double> values = {1, 2};
+  std::vector<uint64_t> indices = {0, 1};
+  std::vector<uint64_t> offsets = {0, 1, 2};
+  std::vector<uint64_t> shape = {2, 2, 0};
+  std::vector<double> x(1, 1.0);
+  std::vector<double> out(2, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(values);
+  taskData->add_input(indices);
+  taskData->add_input(offsets);
+  taskData->add_input(shape);
+  taskData->add_input(x);
+  taskData->add_output(out);
+
+  // Create Task
+  ppc::reference::SparseMatrixVectorProduct<double, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, false);
+}
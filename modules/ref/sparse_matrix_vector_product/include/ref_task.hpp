@@ -0,0 +1,61 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_SPARSE_MATRIX_VECTOR_PRODUCT_REF_TASK_HPP_
+#define MODULES_REFERENCE_SPARSE_MATRIX_VECTOR_PRODUCT_REF_TASK_HPP_
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc {
+namespace reference {
+
+// y = A x for a CSR or CSC matrix A, inputs are described by ppc::core::check_sparse_task()
+template <class InOutType, class IndexType>
+class SparseMatrixVectorProduct : public ppc::core::Task {
+ public:
+  explicit SparseMatrixVectorProduct(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
+  bool pre_processing() override {
+    internal_order_test();
+    // Init view of input data
+    matrix_ = ppc::core::sparse_input<InOutType, IndexType>(*taskData);
+    x_ = taskData->input_view<InOutType>(4);
+
+    // Init value for output
+    product_ = std::vector<InOutType>(matrix_.rows, InOutType{});
+    return true;
+  }
+
+  bool validation() override {
+    internal_order_test();
+    // Check structure of matrix, size of vector and count elements of output
+    return ppc::core::check_sparse_task<IndexType>(*taskData, true);
+  }
+
+  bool run() override {
+    internal_order_test();
+    ppc::core::sparse_product<InOutType, IndexType>(matrix_, x_.data(), product_.data());
+    return true;
+  }
+
+  bool post_processing() override {
+    internal_order_test();
+    std::copy(product_.begin(), product_.end(), reinterpret_cast<InOutType*>(taskData->outputs[0]));
+    return true;
+  }
+
+ private:
+  ppc::core::SparseMatrixView<InOutType, IndexType> matrix_;
+  ppc::core::DataView<const InOutType> x_;
+  std::vector<InOutType> product_;
+};
+
+}  // namespace reference
+}  // namespace ppc
+
+#endif  // MODULES_REFERENCE_SPARSE_MATRIX_VECTOR_PRODUCT_REF_TASK_HPP_
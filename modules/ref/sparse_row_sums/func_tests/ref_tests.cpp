@@ -0,0 +1,86 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/sparse_row_sums/include/ref_task.hpp"
+
+TEST(sparse_row_sums, check_csr_double) {
+  // Create data, row i of 37 x 38 matrix holds i + 1 at every (i + 1)-th column
+  std::vector<double> dense(1406, 0.0);
+  for (size_t i = 0; i < 37; i++) {
+    for (size_t j = 0; j < 38; j += i + 1) dense[i * 38 + j] = static_cast<double>(i + 1);
+  }
+  auto matrix = ppc::core::SparseMatrix<double, uint64_t>::from_dense(
+      ppc::core::MatrixView<double>::row_major(dense.data(), 37, 38), ppc::core::SparseFormat::CSR);
+  auto shape = matrix.shape();
+  std::vector<double> out(37, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(matrix.values);
+  taskData->add_input(matrix.indices);
+  taskData->add_input(matrix.offsets);
+  taskData->add_input(shape);
+  taskData->add_output(out);
+
+  // Create Task
+  ppc::reference::SparseRowSums<double, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  for (size_t i = 0; i < 37; i++) {
+    EXPECT_DOUBLE_EQ(out[i], static_cast<double>((i + 1) * ((37 / (i + 1)) + 1)));
+  }
+}
+
+TEST(sparse_row_sums, check_csc_int32_t) {
+  // Create data, 3 x 4 matrix {{1, 0, 0, 2}, {0, 0, 0, 0}, {3, 4, 0, 5}} by columns
+  std::vector<int32_t> values = {1, 3, 4, 2, 5};
+  std::vector<uint64_t> indices = {0, 2, 2, 0, 2};
+  std::vector<uint64_t> offsets = {0, 2, 3, 3, 5};
+  std::vector<uint64_t> shape = {3, 4, 1};
+  std::vector<int32_t> out(3, -1);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(values);
+  taskData->add_input(indices);
+  taskData->add_input(offsets);
+  taskData->add_input(shape);
+  taskData->add_output(out);
+
+  // Create Task
+  ppc::reference::SparseRowSums<int32_t, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  ASSERT_EQ(out, (std::vector<int32_t>{3, 0, 12}));
+}
+
+TEST(sparse_row_sums, check_validate_func) {
+  // Create data, the last offset does not match the count of values
+  std::vector<int32_t> values = {1, 2};
+  std::vector<uint64_t> indices = {0, 1};
+  std::vector<uint64_t> offsets = {0, 1, 3};
+  std::vector<uint64_t> shape = {2, 2, 0};
+  std::vector<int32_t> out(2, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(values);
+  taskData->add_input(indices);
+  taskData->add_input(offsets);
+  taskData->add_input(shape);
+  taskData->add_output(out);
+
+  // Create Task
+  ppc::reference::SparseRowSums<int32_t, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, false);
+}
@@ -0,0 +1,59 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_SPARSE_ROW_SUMS_REF_TASK_HPP_
+#define MODULES_REFERENCE_SPARSE_ROW_SUMS_REF_TASK_HPP_
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc {
+namespace reference {
+
+// Row sums of a CSR or CSC matrix, inputs are described by ppc::core::check_sparse_task()
+template <class InOutType, class IndexType>
+class SparseRowSums : public ppc::core::Task {
+ public:
+  explicit SparseRowSums(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
+  bool pre_processing() override {
+    internal_order_test();
+    // Init view of input data
+    matrix_ = ppc::core::sparse_input<InOutType, IndexType>(*taskData);
+
+    // Init value for output
+    sum_ = std::vector<InOutType>(matrix_.rows, InOutType{});
+    return true;
+  }
+
+  bool validation() override {
+    internal_order_test();
+    // Check structure of matrix and count elements of output
+    return ppc::core::check_sparse_task<IndexType>(*taskData, false);
+  }
+
+  bool run() override {
+    internal_order_test();
+    ppc::core::sparse_product<InOutType, IndexType>(matrix_, nullptr, sum_.data());
+    return true;
+  }
+
+  bool post_processing() override {
+    internal_order_test();
+    std::copy(sum_.begin(), sum_.end(), reinterpret_cast<InOutType*>(taskData->outputs[0]));
+    return true;
+  }
+
+ private:
+  ppc::core::SparseMatrixView<InOutType, IndexType> matrix_;
+  std::vector<InOutType> sum_;
+};
+
+}  // namespace reference
+}  // namespace ppc
+
+#endif  // MODULES_REFERENCE_SPARSE_ROW_SUMS_REF_TASK_HPP_
@@ -1,8 +1,11 @@
 // Copyright 2023 Nesterov Alexander
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <numeric>
 #include <vector>
 
+#include "core/stream/include/stream.hpp"
 #include "core/task/include/task.hpp"
 #include "ref/sum_of_vector_elements/include/ref_task.hpp"
 
@@ -121,3 +124,26 @@ TEST(sum_of_vector_elements, check_float) {
   testTask.post_processing();
   EXPECT_NEAR(out[0], static_cast<float>(in.size()), 1e-3f);
 }
+
+TEST(sum_of_vector_elements, check_streamed_input) {
+  // Create data, larger than one chunk of the stream
+  const uint64_t count = 2500000;
+  std::vector<int64_t> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  auto source = std::make_shared<ppc::core::GeneratorSource<int64_t>>(
+      count, [](uint64_t first, int64_t* dst, std::size_t n) { std::iota(dst, dst + n, static_cast<int64_t>(first)); });
+  taskData->add_input(ppc::core::stream_buffer(source));
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::SumOfVectorElements<int64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  ASSERT_EQ(out[0], static_cast<int64_t>(count * (count - 1) / 2));
+}
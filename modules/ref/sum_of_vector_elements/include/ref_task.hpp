@@ -5,9 +5,10 @@
 #include <gtest/gtest.h>
 
 #include <memory>
-#include <numeric>
 #include <vector>
 
+#include "core/simd/include/simd.hpp"
+#include "core/stream/include/stream.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ppc::reference {
@@ -18,12 +19,9 @@ class SumOfVectorElements : public ppc::core::Task {
   explicit SumOfVectorElements(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
   bool pre_processing() override {
     internal_order_test();
-    // Init vectors
-    input_ = std::vector<InOutType>(taskData->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init view of input data, streamed inputs are read in run()
+    streamed_ = taskData->input_buffer(0).streamed();
+    if (!streamed_) input_ = taskData->input_view<InOutType>(0);
     // Init value for output
     sum = 0;
     return true;
@@ -37,7 +35,12 @@ class SumOfVectorElements : public ppc::core::Task {
 
   bool run() override {
     internal_order_test();
-    sum = std::accumulate(input_.begin(), input_.end(), 0);
+    if (streamed_) {
+      auto stream = ppc::core::input_stream<InOutType>(*taskData, 0);
+      sum = ppc::core::stream_sum(stream);
+      return true;
+    }
+    sum = ppc::core::simd::sum(input_.data(), input_.size());
     return true;
   }
 
@@ -48,7 +51,8 @@ class SumOfVectorElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  bool streamed_ = false;
+  ppc::core::DataView<const InOutType> input_;
   InOutType sum;
 };
 
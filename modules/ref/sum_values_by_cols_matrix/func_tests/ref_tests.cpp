@@ -0,0 +1,103 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/sum_values_by_cols_matrix/include/ref_task.hpp"
+
+TEST(sum_values_by_cols_matrix, check_int32_t) {
+  // Create data
+  std::vector<int32_t> in(1406);
+  std::vector<uint64_t> in_index = {37, 38};
+  std::vector<int32_t> out(38, 0);
+  for (size_t i = 0; i < in.size(); ++i) {
+    in[i] = static_cast<int32_t>(i % 38);
+  }
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_input(in_index);
+  taskData->add_output(out);
+
+  // Create Task
+  ppc::reference::SumValuesByColsMatrix<int32_t, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  for (size_t j = 0; j < in_index[1]; j++) {
+    ASSERT_EQ(out[j], static_cast<int32_t>(37 * j));
+  }
+}
+
+TEST(sum_values_by_cols_matrix, check_double_col_major) {
+  // Create data
+  std::vector<double> in(1406, 1.0 / 37.0);
+  std::vector<uint64_t> in_index = {37, 38, 1, 0};
+  std::vector<double> out(38, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_input(in_index);
+  taskData->add_output(out);
+
+  // Create Task
+  ppc::reference::SumValuesByColsMatrix<double, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  for (size_t j = 0; j < in_index[1]; j++) {
+    EXPECT_NEAR(out[j], 1.0, 1e-6);
+  }
+}
+
+TEST(sum_values_by_cols_matrix, check_float_row_major_with_leading_dimension) {
+  // Create data, rows of 4 elements followed by 2 elements of padding
+  std::vector<float> in(18, 100.f);
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 4; j++) in[i * 6 + j] = static_cast<float>(i * j);
+  }
+  std::vector<uint64_t> in_index = {3, 4, 0, 6};
+  std::vector<float> out(4, 0.f);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_input(in_index);
+  taskData->add_output(out);
+
+  // Create Task
+  ppc::reference::SumValuesByColsMatrix<float, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  for (size_t j = 0; j < in_index[1]; j++) {
+    EXPECT_FLOAT_EQ(out[j], static_cast<float>(3 * j));
+  }
+}
+
+TEST(sum_values_by_cols_matrix, check_validate_func) {
+  // Create data
+  std::vector<int32_t> in(1406, 2);
+  std::vector<uint64_t> in_index = {37, 38};
+  std::vector<int32_t> out(37, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_input(in_index);
+  taskData->add_output(out);
+
+  // Create Task, one output per column is expected
+  ppc::reference::SumValuesByColsMatrix<int32_t, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, false);
+}
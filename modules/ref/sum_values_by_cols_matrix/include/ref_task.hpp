@@ -0,0 +1,60 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_SUM_VALUES_BY_COLS_MATRIX_REF_TASK_HPP_
+#define MODULES_REFERENCE_SUM_VALUES_BY_COLS_MATRIX_REF_TASK_HPP_
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "core/matrix_reduce/include/matrix_reduce.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc {
+namespace reference {
+
+// inputs[1] is the shape {rows, cols} or {rows, cols, layout, leading dimension},
+// see ppc::core::check_matrix_task()
+template <class InOutType, class IndexType>
+class SumValuesByColsMatrix : public ppc::core::Task {
+ public:
+  explicit SumValuesByColsMatrix(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
+  bool pre_processing() override {
+    internal_order_test();
+    // Init view of input data
+    matrix_ = ppc::core::matrix_input<InOutType, IndexType>(*taskData);
+
+    // Init value for output
+    sum_ = std::vector<InOutType>(matrix_.cols, InOutType{});
+    return true;
+  }
+
+  bool validation() override {
+    internal_order_test();
+    // Check shape of matrix and count elements of output
+    return ppc::core::check_matrix_task<IndexType>(*taskData, ppc::core::MatrixAxis::COLS);
+  }
+
+  bool run() override {
+    internal_order_test();
+    ppc::core::matrix_sums(matrix_, ppc::core::MatrixAxis::COLS, sum_.data());
+    return true;
+  }
+
+  bool post_processing() override {
+    internal_order_test();
+    std::copy(sum_.begin(), sum_.end(), reinterpret_cast<InOutType*>(taskData->outputs[0]));
+    return true;
+  }
+
+ private:
+  ppc::core::MatrixView<InOutType> matrix_;
+  std::vector<InOutType> sum_;
+};
+
+}  // namespace reference
+}  // namespace ppc
+
+#endif  // MODULES_REFERENCE_SUM_VALUES_BY_COLS_MATRIX_REF_TASK_HPP_
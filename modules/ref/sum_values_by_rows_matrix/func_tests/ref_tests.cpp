@@ -192,3 +192,48 @@ TEST(sum_values_by_rows_matrix, check_float) {
     EXPECT_NEAR(out[i], in_index[1] * (in_index[1] + 1) * (2 * in_index[1] + 1) / 6.f, 1e-6);
   }
 }
+
+TEST(sum_values_by_rows_matrix, check_col_major_with_leading_dimension) {
+  // Create data, column j of 3 x 4 matrix is {j, j, j} followed by 2 elements of padding
+  std::vector<double> in(20, 100.0);
+  for (size_t j = 0; j < 4; j++) {
+    for (size_t i = 0; i < 3; i++) in[j * 5 + i] = static_cast<double>(j + i);
+  }
+  std::vector<uint64_t> in_index = {3, 4, 1, 5};
+  std::vector<double> out(3, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_input(in_index);
+  taskData->add_output(out);
+
+  // Create Task
+  ppc::reference::SumValuesByRowsMatrix<double, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  for (size_t i = 0; i < in_index[0]; i++) {
+    EXPECT_DOUBLE_EQ(out[i], static_cast<double>(6 + 4 * i));
+  }
+}
+
+TEST(sum_values_by_rows_matrix, check_validate_leading_dimension) {
+  // Create data
+  std::vector<int32_t> in(1406, 2);
+  std::vector<uint64_t> in_index = {37, 38, 0, 37};
+  std::vector<int32_t> out(37, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_input(in_index);
+  taskData->add_output(out);
+
+  // Create Task, rows of 38 elements do not fit leading dimension 37
+  ppc::reference::SumValuesByRowsMatrix<int32_t, uint64_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, false);
+}
@@ -5,61 +5,52 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <memory>
-#include <numeric>
 #include <vector>
 
+#include "core/matrix_reduce/include/matrix_reduce.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ppc {
 namespace reference {
 
+// inputs[1] is the shape {rows, cols} or {rows, cols, layout, leading dimension},
+// see ppc::core::check_matrix_task()
 template <class InOutType, class IndexType>
 class SumValuesByRowsMatrix : public ppc::core::Task {
  public:
   explicit SumValuesByRowsMatrix(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
   bool pre_processing() override {
     internal_order_test();
-    // Init vectors
-    input_ = std::vector<InOutType>(taskData->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
-    rows = reinterpret_cast<IndexType*>(taskData->inputs[1])[0];
-    cols = reinterpret_cast<IndexType*>(taskData->inputs[1])[1];
+    // Init view of input data
+    matrix_ = ppc::core::matrix_input<InOutType, IndexType>(*taskData);
 
     // Init value for output
-    sum_ = std::vector<InOutType>(cols, 0.f);
+    sum_ = std::vector<InOutType>(matrix_.rows, InOutType{});
     return true;
   }
 
   bool validation() override {
     internal_order_test();
-    // Check count elements of output
-    return static_cast<bool>(taskData->inputs_count[1] == 2 &&
-                             taskData->outputs_count[0] == reinterpret_cast<IndexType*>(taskData->inputs[1])[0]);
+    // Check shape of matrix and count elements of output
+    return ppc::core::check_matrix_task<IndexType>(*taskData, ppc::core::MatrixAxis::ROWS);
   }
 
   bool run() override {
     internal_order_test();
-    for (size_t i = 0; i < rows; i++) {
-      sum_[i] = std::accumulate(input_.begin() + cols * i, input_.begin() + cols * (i + 1), 0.f);
-    }
+    ppc::core::matrix_sums(matrix_, ppc::core::MatrixAxis::ROWS, sum_.data());
     return true;
   }
 
   bool post_processing() override {
     internal_order_test();
-    for (IndexType i = 0; i < rows; i++) {
-      reinterpret_cast<InOutType*>(taskData->outputs[0])[i] = sum_[i];
-    }
+    std::copy(sum_.begin(), sum_.end(), reinterpret_cast<InOutType*>(taskData->outputs[0]));
     return true;
   }
 
  private:
-  std::vector<InOutType> input_;
-  IndexType rows, cols;
+  ppc::core::MatrixView<InOutType> matrix_;
   std::vector<InOutType> sum_;
 };
 
@@ -1,8 +1,11 @@
 // Copyright 2023 Nesterov Alexander
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <numeric>
 #include <vector>
 
+#include "core/stream/include/stream.hpp"
 #include "core/task/include/task.hpp"
 #include "ref/vector_dot_product/include/ref_task.hpp"
 
@@ -185,3 +188,94 @@ TEST(vector_dot_product, check_float) {
   testTask.post_processing();
   EXPECT_NEAR(out[0], in1.size() * (-1.3f) * 1.2f, 1e-3f);
 }
+
+TEST(vector_dot_product, check_large_magnitude_float) {
+  // partial sums of float lose the low digits, the result matches a double accumulator
+  std::vector<float> in1(300001, 1000.1f);
+  std::vector<float> in2(in1.size(), 1.0f);
+  std::vector<float> out(1, 0.f);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in1);
+  taskData->add_input(in2);
+  taskData->add_output(out);
+
+  // Create Task
+  ppc::reference::VectorDotProduct<float> testTask(taskData);
+  ASSERT_TRUE(testTask.validation());
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  EXPECT_EQ(out[0], static_cast<float>(std::inner_product(in1.begin(), in1.end(), in2.begin(), 0.0)));
+}
+
+TEST(vector_dot_product, check_typed_buffers) {
+  // Create data
+  std::vector<double> in1(1256, 0.5);
+  std::vector<double> in2(1256, 2.0);
+  std::vector<double> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in1);
+  taskData->add_input(in2);
+  taskData->add_output(out);
+
+  // Create Task
+  ppc::reference::VectorDotProduct<double> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  EXPECT_NEAR(out[0], static_cast<double>(in1.size()), 1e-9);
+}
+
+TEST(vector_dot_product, check_streamed_input) {
+  // Create data
+  const uint64_t count_data = 1256;
+  std::vector<int32_t> in1(count_data, 1);
+  std::vector<int32_t> in2(count_data, 1);
+  std::vector<int32_t> out(1, 0);
+  for (size_t i = 0; i < count_data; i++) {
+    in1[i] = i + 1;
+    in2[i] = i + 1;
+  }
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(ppc::core::stream_buffer(std::make_shared<ppc::core::MemorySource<int32_t>>(in1)));
+  taskData->add_input(ppc::core::stream_buffer(std::make_shared<ppc::core::MemorySource<int32_t>>(in2)));
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::VectorDotProduct<int32_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  ASSERT_EQ(static_cast<uint64_t>(out[0]), (count_data * (count_data + 1) * (2 * count_data + 1)) / 6);
+}
+
+TEST(vector_dot_product, check_validate_streamed_and_memory_inputs) {
+  // Create data
+  std::vector<int32_t> in1(125, 1);
+  std::vector<int32_t> in2(125, 1);
+  std::vector<int32_t> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(ppc::core::stream_buffer(std::make_shared<ppc::core::MemorySource<int32_t>>(in1)));
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in2.data()));
+  taskData->inputs_count.emplace_back(in2.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::reference::VectorDotProduct<int32_t> testTask(taskData);
+  bool isValid = testTask.validation();
+  ASSERT_EQ(isValid, false);
+}
@@ -5,10 +5,12 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <memory>
-#include <numeric>
 #include <vector>
 
+#include "core/simd/include/simd.hpp"
+#include "core/stream/include/stream.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ppc {
@@ -20,14 +22,10 @@ class VectorDotProduct : public ppc::core::Task {
   explicit VectorDotProduct(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
   bool pre_processing() override {
     internal_order_test();
-    // Init vectors
-    input_ = std::vector<std::vector<InOutType> >(2);
-    for (size_t i = 0; i < input_.size(); i++) {
-      input_[i] = std::vector<InOutType>(taskData->inputs_count[i]);
-      auto tmp_ptr_ = reinterpret_cast<InOutType*>(taskData->inputs[i]);
-      for (unsigned j = 0; j < taskData->inputs_count[i]; j++) {
-        input_[i][j] = tmp_ptr_[j];
-      }
+    // Init view of input data, streamed inputs are read in run()
+    streamed_ = taskData->input_buffer(0).streamed();
+    for (size_t i = 0; i < input_.size() && !streamed_; i++) {
+      input_[i] = taskData->input_view<InOutType>(i);
     }
 
     // Init value for output
@@ -37,25 +35,34 @@ class VectorDotProduct : public ppc::core::Task {
 
   bool validation() override {
     internal_order_test();
-    // Check count elements of output
-    return taskData->outputs_count[0] == 1 && taskData->inputs_count[0] == taskData->inputs_count[1];
+    // Check count elements of output, both inputs are in memory or both are streamed
+    return taskData->outputs_count[0] == 1 && taskData->input_buffer(0).count == taskData->input_buffer(1).count &&
+           taskData->input_buffer(0).streamed() == taskData->input_buffer(1).streamed();
   }
 
   bool run() override {
     internal_order_test();
-    dor_product = std::inner_product(input_[0].begin(), input_[0].end(), input_[1].begin(), 0.0);
+    if (streamed_) {
+      auto a = ppc::core::input_stream<InOutType>(*taskData, 0);
+      auto b = ppc::core::input_stream<InOutType>(*taskData, 1);
+      dor_product = ppc::core::stream_dot(a, b);
+      return true;
+    }
+    dor_product = ppc::core::simd::dot(input_[0].data(), input_[1].data(), input_[0].size());
     return true;
   }
 
   bool post_processing() override {
     internal_order_test();
-    reinterpret_cast<InOutType*>(taskData->outputs[0])[0] = dor_product;
+    reinterpret_cast<InOutType*>(taskData->outputs[0])[0] = static_cast<InOutType>(dor_product);
     return true;
   }
 
  private:
-  std::vector<std::vector<InOutType> > input_;
-  InOutType dor_product;
+  bool streamed_ = false;
+  std::array<ppc::core::DataView<const InOutType>, 2> input_;
+  // products are summed in double or 64-bit integers, narrow types neither lose precision nor overflow
+  ppc::core::simd::dot_type<InOutType> dor_product;
 };
 
 }  // namespace reference
@@ -0,0 +1,159 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "ref/average_of_vector_elements/include/ref_task.hpp"
+#include "ref/max_of_vector_elements/include/ref_task.hpp"
+#include "ref/min_of_vector_elements/include/ref_task.hpp"
+#include "ref/num_of_alternations_signs/include/ref_task.hpp"
+#include "ref/vector_statistics/include/ref_task.hpp"
+
+namespace {
+
+template <class T>
+struct Statistics {
+  std::vector<T> min{0};
+  std::vector<uint64_t> min_index{0};
+  std::vector<T> max{0};
+  std::vector<uint64_t> max_index{0};
+  std::vector<T> sum{0};
+  std::vector<double> mean{0};
+  std::vector<uint64_t> alternations{0};
+};
+
+template <class T>
+bool run_statistics(std::vector<T> &in, Statistics<T> &out) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_output(out.min);
+  taskData->add_output(out.min_index);
+  taskData->add_output(out.max);
+  taskData->add_output(out.max_index);
+  taskData->add_output(out.sum);
+  taskData->add_output(out.mean);
+  taskData->add_output(out.alternations);
+  ppc::reference::VectorStatistics<T, uint64_t> testTask(taskData);
+  if (!testTask.validation()) return false;
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  return true;
+}
+
+// every statistic computed by the separate reference task
+template <class T>
+void check_against_separate_tasks(std::vector<T> &in, const Statistics<T> &out) {
+  std::vector<T> value(1);
+  std::vector<uint64_t> index(1);
+  auto minData = std::make_shared<ppc::core::TaskData>();
+  minData->add_input(in);
+  minData->add_output(value);
+  minData->add_output(index);
+  ppc::reference::MinOfVectorElements<T, uint64_t> minTask(minData);
+  ASSERT_TRUE(minTask.validation() && minTask.pre_processing() && minTask.run() && minTask.post_processing());
+  EXPECT_EQ(out.min[0], value[0]);
+  EXPECT_EQ(out.min_index[0], index[0]);
+
+  auto maxData = std::make_shared<ppc::core::TaskData>();
+  maxData->add_input(in);
+  maxData->add_output(value);
+  maxData->add_output(index);
+  ppc::reference::MaxOfVectorElements<T, uint64_t> maxTask(maxData);
+  ASSERT_TRUE(maxTask.validation() && maxTask.pre_processing() && maxTask.run() && maxTask.post_processing());
+  EXPECT_EQ(out.max[0], value[0]);
+  EXPECT_EQ(out.max_index[0], index[0]);
+
+  std::vector<double> mean(1);
+  auto averageData = std::make_shared<ppc::core::TaskData>();
+  averageData->add_input(in);
+  averageData->add_output(mean);
+  ppc::reference::AverageOfVectorElements<T, double> averageTask(averageData);
+  ASSERT_TRUE(averageTask.validation() && averageTask.pre_processing() && averageTask.run() &&
+              averageTask.post_processing());
+  EXPECT_NEAR(out.mean[0], mean[0], 1e-9);
+
+  std::vector<uint64_t> alternations(1);
+  auto alternationsData = std::make_shared<ppc::core::TaskData>();
+  alternationsData->add_input(in);
+  alternationsData->add_output(alternations);
+  ppc::reference::NumOfAlternationsSigns<T, uint64_t> alternationsTask(alternationsData);
+  ASSERT_TRUE(alternationsTask.validation() && alternationsTask.pre_processing() && alternationsTask.run() &&
+              alternationsTask.post_processing());
+  EXPECT_EQ(out.alternations[0], alternations[0]);
+}
+
+}  // namespace
+
+TEST(vector_statistics, check_int32_t) {
+  // Create data
+  std::vector<int32_t> in(5000);
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int32_t> dist(-1000, 1000);
+  for (auto &value : in) value = dist(gen);
+  Statistics<int32_t> out;
+
+  ASSERT_TRUE(run_statistics(in, out));
+  int64_t sum = 0;
+  for (auto value : in) sum += value;
+  EXPECT_EQ(out.sum[0], sum);
+  check_against_separate_tasks(in, out);
+}
+
+TEST(vector_statistics, check_double) {
+  // Create data
+  std::vector<double> in(25680);
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<double> dist(-10.0, 10.0);
+  for (auto &value : in) value = dist(gen);
+  Statistics<double> out;
+
+  ASSERT_TRUE(run_statistics(in, out));
+  double sum = 0.0;
+  for (auto value : in) sum += value;
+  EXPECT_NEAR(out.sum[0], sum, 1e-6);
+  check_against_separate_tasks(in, out);
+}
+
+TEST(vector_statistics, check_repeated_extremes_in_later_blocks) {
+  // Create data
+  std::vector<int64_t> in(3000, 5);
+  in[10] = in[1500] = in[2999] = -3;
+  in[2048] = in[2049] = 9;
+  Statistics<int64_t> out;
+
+  ASSERT_TRUE(run_statistics(in, out));
+  EXPECT_EQ(out.min[0], -3);
+  EXPECT_EQ(out.min_index[0], 10ull);
+  EXPECT_EQ(out.max[0], 9);
+  EXPECT_EQ(out.max_index[0], 2048ull);
+  EXPECT_EQ(out.alternations[0], 5ull);
+  check_against_separate_tasks(in, out);
+}
+
+TEST(vector_statistics, check_single_element) {
+  // Create data
+  std::vector<float> in(1, -2.5f);
+  Statistics<float> out;
+
+  ASSERT_TRUE(run_statistics(in, out));
+  EXPECT_EQ(out.min[0], -2.5f);
+  EXPECT_EQ(out.max[0], -2.5f);
+  EXPECT_EQ(out.min_index[0], 0ull);
+  EXPECT_EQ(out.max_index[0], 0ull);
+  EXPECT_DOUBLE_EQ(out.mean[0], -2.5);
+  EXPECT_EQ(out.alternations[0], 0ull);
+}
+
+TEST(vector_statistics, check_validate_func) {
+  // Create data
+  std::vector<int32_t> in;
+  Statistics<int32_t> out;
+  EXPECT_FALSE(run_statistics(in, out));
+
+  in.assign(10, 1);
+  out.sum.resize(2);
+  EXPECT_FALSE(run_statistics(in, out));
+}
@@ -0,0 +1,120 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_VECTOR_STATISTICS_REF_TASK_HPP_
+#define MODULES_REFERENCE_VECTOR_STATISTICS_REF_TASK_HPP_
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace ppc {
+namespace reference {
+
+// Min/argmin, max/argmax, sum, mean and count of sign alternations of a vector
+// in one pass over the input. Results match MinOfVectorElements,
+// MaxOfVectorElements, SumOfVectorElements, AverageOfVectorElements and
+// NumOfAlternationsSigns, the first index is reported for repeated extremes.
+// Outputs: min, min index, max, max index, sum, mean, alternations.
+template <class InOutType, class IndexType, class MeanType = double>
+class VectorStatistics : public ppc::core::Task {
+ public:
+  // elements per block, a block stays in L1 for the index search
+  static constexpr std::size_t block_size = 1024;
+
+  explicit VectorStatistics(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
+  bool pre_processing() override {
+    internal_order_test();
+    // Init view of input data
+    input_ = taskData->input_view<InOutType>(0);
+    // Init value for output
+    min = max = sum = 0;
+    min_index = max_index = alternations = 0;
+    mean = 0;
+    return true;
+  }
+
+  bool validation() override {
+    internal_order_test();
+    // Check count elements of input and outputs
+    if (taskData->inputs_count.empty() || taskData->inputs_count[0] == 0) return false;
+    if (taskData->outputs_count.size() != 7) return false;
+    return std::all_of(taskData->outputs_count.begin(), taskData->outputs_count.end(),
+                       [](auto count) { return count == 1; });
+  }
+
+  bool run() override {
+    internal_order_test();
+    const InOutType* data = input_.data();
+    const std::size_t size = input_.size();
+    min = max = data[0];
+    double total = 0.0;
+    for (std::size_t begin = 0; begin < size; begin += block_size) {
+      const std::size_t end = std::min(begin + block_size, size);
+      // branch free reductions over the block, vectorized by the compiler
+      InOutType block_min = data[begin];
+      InOutType block_max = data[begin];
+      InOutType block_sum = 0;
+      double block_total = 0.0;
+      IndexType block_alternations = 0;
+      for (std::size_t i = begin; i < end; i++) {
+        const InOutType value = data[i];
+        block_min = value < block_min ? value : block_min;
+        block_max = block_max < value ? value : block_max;
+        block_sum += value;
+        block_total += static_cast<double>(value);
+      }
+      for (std::size_t i = std::max<std::size_t>(begin, 1); i < end; i++) {
+        const InOutType prev = data[i - 1];
+        const InOutType value = data[i];
+        block_alternations += static_cast<IndexType>((prev < 0 && 0 < value) || (0 < prev && value < 0));
+      }
+      sum += block_sum;
+      total += block_total;
+      alternations += block_alternations;
+      // the block is still in cache when an index has to be found
+      if (block_min < min || begin == 0) {
+        min = block_min;
+        min_index = static_cast<IndexType>(std::find(data + begin, data + end, block_min) - data);
+      }
+      if (max < block_max || begin == 0) {
+        max = block_max;
+        max_index = static_cast<IndexType>(std::find(data + begin, data + end, block_max) - data);
+      }
+    }
+    mean = static_cast<MeanType>(total / static_cast<double>(size));
+    return true;
+  }
+
+  bool post_processing() override {
+    internal_order_test();
+    reinterpret_cast<InOutType*>(taskData->outputs[0])[0] = min;
+    reinterpret_cast<IndexType*>(taskData->outputs[1])[0] = min_index;
+    reinterpret_cast<InOutType*>(taskData->outputs[2])[0] = max;
+    reinterpret_cast<IndexType*>(taskData->outputs[3])[0] = max_index;
+    reinterpret_cast<InOutType*>(taskData->outputs[4])[0] = sum;
+    reinterpret_cast<MeanType*>(taskData->outputs[5])[0] = mean;
+    reinterpret_cast<IndexType*>(taskData->outputs[6])[0] = alternations;
+    return true;
+  }
+
+ private:
+  ppc::core::DataView<const InOutType> input_;
+  InOutType min;
+  InOutType max;
+  InOutType sum;
+  IndexType min_index;
+  IndexType max_index;
+  IndexType alternations;
+  MeanType mean;
+};
+
+}  // namespace reference
+}  // namespace ppc
+
+#endif  // MODULES_REFERENCE_VECTOR_STATISTICS_REF_TASK_HPP_
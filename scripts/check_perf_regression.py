@@ -0,0 +1,167 @@
+import argparse
+import json
+import math
+import os
+import subprocess
+import sys
+import tempfile
+
+# Compares perf records of the *_perf_tests binaries (see PPC_PERF_OUTPUT)
+# with a stored baseline. A task regresses when its median time grew by more
+# than a noise-aware threshold and the slowdown is statistically significant.
+
+BASELINE_VERSION = 2
+PERF_BINARIES = ["omp_perf_tests", "seq_perf_tests", "stl_perf_tests", "tbb_perf_tests"]
+BASELINE_FIELDS = ["median", "mean", "ci_low", "ci_high", "relative_error", "num_threads", "num_procs",
+                   "input_size", "isa_level", "samples"]
+
+parser = argparse.ArgumentParser(description="Check perf tests for regressions against a baseline")
+parser.add_argument('-b', '--baseline', help='Baseline file path (.json)',
+                    default=os.path.join(os.path.dirname(os.path.abspath(__file__)), 'perf_baseline.json'))
+parser.add_argument('-i', '--input', help='Use existing perf records (.jsonl) instead of running perf tests')
+parser.add_argument('--bin-dir', help='Directory with *_perf_tests binaries', default=os.path.join('build', 'bin'))
+parser.add_argument('--mpi-procs', help='Number of MPI processes for mpi_perf_tests, 0 to skip', type=int, default=4)
+parser.add_argument('--threshold', help='Minimal relative slowdown reported as regression', type=float, default=0.05)
+parser.add_argument('--noise-factor', help='Threshold multiplier of the combined relative error', type=float,
+                    default=2.0)
+parser.add_argument('--alpha', help='Significance level of the rank test', type=float, default=0.01)
+parser.add_argument('--update-baseline', help='Store current results as the new baseline', action='store_true')
+args = parser.parse_args()
+
+
+def run_perf_tests(output_path):
+    env = dict(os.environ, PPC_PERF_OUTPUT=output_path)
+    commands = []
+    if args.mpi_procs > 0 and os.path.exists(os.path.join(args.bin_dir, "mpi_perf_tests")):
+        commands.append(["mpirun", "--oversubscribe", "--bind-to", "none", "-np", str(args.mpi_procs),
+                         os.path.join(args.bin_dir, "mpi_perf_tests")])
+    for binary in PERF_BINARIES:
+        path = os.path.join(args.bin_dir, binary)
+        if os.path.exists(path):
+            commands.append([path])
+    if not commands:
+        sys.exit("No perf tests binaries found in " + args.bin_dir)
+    for command in commands:
+        print("Running " + " ".join(command), flush=True)
+        completed = subprocess.run(command, env=env, stdout=subprocess.DEVNULL)
+        if completed.returncode != 0:
+            sys.exit(command[-1] + " failed with exit code " + str(completed.returncode))
+
+
+def load_records(path):
+    results = {}
+    with open(path, "r") as records_file:
+        for line in records_file:
+            if not line.strip():
+                continue
+            record = json.loads(line)
+            key = "/".join([record["backend"], record["task"], record["type"], record.get("test", "")])
+            # records with one key measure different benchmarks or come from repeated runs,
+            # merging them would compare mixed distributions
+            if key in results:
+                sys.exit("Duplicate perf record " + key + " in " + path)
+            results[key] = {field: record[field] for field in BASELINE_FIELDS if field in record}
+    return results
+
+
+def mann_whitney_greater(current, baseline):
+    # one-sided p-value of "current samples are larger than baseline samples",
+    # normal approximation with tie correction
+    n1 = len(current)
+    n2 = len(baseline)
+    if n1 < 3 or n2 < 3:
+        return None
+    values = sorted([(value, 0) for value in current] + [(value, 1) for value in baseline])
+    ranks = [0.0] * len(values)
+    tie_term = 0.0
+    i = 0
+    while i < len(values):
+        j = i
+        while j + 1 < len(values) and values[j + 1][0] == values[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1.0
+        ties = j - i + 1
+        tie_term += ties ** 3 - ties
+        i = j + 1
+    rank_sum = sum(rank for rank, (_, group) in zip(ranks, values) if group == 0)
+    u = rank_sum - n1 * (n1 + 1) / 2.0
+    n = n1 + n2
+    variance = n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1)))
+    if variance <= 0:
+        return None
+    z = (u - n1 * n2 / 2.0 - 0.5) / math.sqrt(variance)
+    return 0.5 * math.erfc(z / math.sqrt(2.0))
+
+
+def compare(key, current, baseline):
+    for field in ["num_threads", "num_procs", "input_size", "isa_level"]:
+        if field in current and field in baseline and current[field] != baseline[field]:
+            return "SKIPPED", field + " changed: " + str(baseline[field]) + " -> " + str(current[field])
+    if baseline["median"] <= 0:
+        return "SKIPPED", "baseline median is zero"
+    delta = (current["median"] - baseline["median"]) / baseline["median"]
+    noise = math.hypot(current.get("relative_error", 0.0), baseline.get("relative_error", 0.0))
+    limit = max(args.threshold, args.noise_factor * noise)
+    p_value = mann_whitney_greater(current.get("samples", []), baseline.get("samples", []))
+    if p_value is not None:
+        significant = p_value < args.alpha
+        evidence = "p=%.2g" % p_value
+    else:
+        # no samples stored, fall back to non-overlapping confidence intervals
+        significant = current["ci_low"] > baseline["ci_high"]
+        evidence = "ci overlap" if not significant else "ci disjoint"
+    details = "median %.6g -> %.6g (%+.1f%%, limit %.1f%%, %s)" % (baseline["median"], current["median"],
+                                                                      delta * 100, limit * 100, evidence)
+    if delta > limit and significant:
+        return "REGRESSION", details
+    if delta < -limit:
+        return "IMPROVED", details
+    return "OK", details
+
+
+if args.input:
+    current_results = load_records(os.path.abspath(args.input))
+else:
+    with tempfile.TemporaryDirectory() as temp_dir:
+        records_path = os.path.join(temp_dir, "perf_results.jsonl")
+        run_perf_tests(records_path)
+        current_results = load_records(records_path) if os.path.exists(records_path) else {}
+
+if not current_results:
+    sys.exit("No perf records were produced")
+
+if args.update_baseline:
+    with open(args.baseline, "w") as baseline_file:
+        json.dump({"version": BASELINE_VERSION, "results": current_results}, baseline_file, indent=1, sort_keys=True)
+        baseline_file.write("\n")
+    print("Baseline with " + str(len(current_results)) + " results written to " + args.baseline)
+    sys.exit(0)
+
+if not os.path.exists(args.baseline):
+    sys.exit("Baseline " + args.baseline + " does not exist, create it with --update-baseline")
+with open(args.baseline, "r") as baseline_file:
+    baseline_data = json.load(baseline_file)
+if baseline_data.get("version") != BASELINE_VERSION:
+    sys.exit("Unsupported baseline version " + str(baseline_data.get("version")))
+baseline_results = baseline_data["results"]
+
+statuses = {}
+key_width = max(len(key) for key in list(current_results) + list(baseline_results))
+for key in sorted(set(current_results) | set(baseline_results)):
+    if key not in baseline_results:
+        status, details = "NEW", "no baseline"
+    elif key not in current_results:
+        status, details = "MISSING", "not found in current run"
+    else:
+        status, details = compare(key, current_results[key], baseline_results[key])
+    statuses[key] = status
+    print(key.ljust(key_width) + "  " + status.ljust(10) + " " + details)
+
+regressions = [key for key, status in statuses.items() if status == "REGRESSION"]
+if regressions:
+    print("\n" + str(len(regressions)) + " perf regression(s) found:")
+    for key in regressions:
+        print("  " + key)
+    sys.exit(1)
+print("\nNo perf regressions found")
@@ -1,11 +1,10 @@
 import argparse
+import json
 import os
-import re
 import xlsxwriter
-import multiprocessing
 
 parser = argparse.ArgumentParser()
-parser.add_argument('-i', '--input', help='Input file path (logs of perf tests, .txt)', required=True)
+parser.add_argument('-i', '--input', help='Input file path (perf records of perf tests, .jsonl)', required=True)
 parser.add_argument('-o', '--output', help='Output file path (path to .xlsx table)', required=True)
 args = parser.parse_args()
 logs_path = os.path.abspath(args.input)
@@ -14,31 +13,27 @@ xlsx_path = os.path.abspath(args.output)
 list_of_type_of_tasks = ["mpi", "omp", "seq", "stl", "tbb"]
 
 result_tables = {"pipeline": {}, "task_run": {}}
-set_of_task_name = []
+cpu_num = 1
 
-logs_file = open(logs_path, "r")
-logs_lines = logs_file.readlines()
-for line in logs_lines:
-    pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
-    result = re.findall(pattern, line)
-    if len(result):
-        task_name = result[0][1]
-        perf_type = result[0][2]
-        set_of_task_name.append(task_name)
-        result_tables[perf_type][task_name] = {}
+with open(logs_path, "r") as logs_file:
+    records = [json.loads(line) for line in logs_file if line.strip()]
 
-        for ttype in list_of_type_of_tasks:
-            result_tables[perf_type][task_name][ttype] = -1.0
-
-for line in logs_lines:
-    pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
-    result = re.findall(pattern, line)
-    if len(result):
-        task_type = result[0][0]
-        task_name = result[0][1]
-        perf_type = result[0][2]
-        perf_time = float(result[0][3])
-        result_tables[perf_type][task_name][task_type] = perf_time
+for record in records:
+    # tests besides test_pipeline_run and test_task_run measure other variants of the task
+    # (in-place inputs, other kernels...) and get their own rows, like in the perf tests output
+    test_name = record.get("test", "")
+    task_name = record["task"]
+    if test_name and test_name not in ("test_pipeline_run", "test_task_run"):
+        task_name += ":" + test_name
+    perf_type = record["type"]
+    if perf_type not in result_tables:
+        continue
+    if task_name not in result_tables[perf_type]:
+        result_tables[perf_type][task_name] = {ttype: -1.0 for ttype in list_of_type_of_tasks}
+    # times outside of allowed limits are marked as -1 like in the perf tests output
+    perf_time = record["time_sec"] if record["within_limits"] else -1.0
+    result_tables[perf_type][task_name][record["backend"]] = perf_time
+    cpu_num = max(cpu_num, record["num_threads"])
 
 
 for table_name in result_tables:
@@ -47,7 +42,6 @@ for table_name in result_tables:
     worksheet.set_column('A:Z', 23)
     right_bold_border = workbook.add_format({'bold': True, 'right': 2, 'bottom': 2})
     bottom_bold_border = workbook.add_format({'bold': True, 'bottom': 2})
-    cpu_num = multiprocessing.cpu_count()
     worksheet.write(0, 0, "cpu_num = " + str(cpu_num), right_bold_border)
 
     it = 1
@@ -62,18 +56,21 @@ for table_name in result_tables:
                         "S(" + str(cpu_num) + ")" + " / " + str(cpu_num), right_bold_border)
         it += 1
 
+    # every table lists the tasks measured with its type of running only
+    task_names = sorted(result_tables[table_name])
     it = 1
-    for task_name in list(set(set_of_task_name)):
+    for task_name in task_names:
         worksheet.write(it, 0, task_name, workbook.add_format({'bold': True, 'right': 2}))
         it += 1
 
     it_i = 1
     it_j = 1
     right_border = workbook.add_format({'right': 2})
-    for task_name in list(set(set_of_task_name)):
+    for task_name in task_names:
+        task_times = result_tables[table_name][task_name]
         for type_of_task in list_of_type_of_tasks:
-            par_time = result_tables[table_name][task_name][type_of_task]
-            seq_time = result_tables[table_name][task_name]["seq"]
+            par_time = task_times[type_of_task]
+            seq_time = task_times["seq"]
             speed_up = seq_time / par_time
             efficiency = speed_up / cpu_num
             worksheet.write(it_j, it_i, par_time)
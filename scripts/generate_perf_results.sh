@@ -1,3 +1,5 @@
 mkdir build/perf_stat_dir
+export PPC_PERF_OUTPUT=build/perf_stat_dir/perf_results.jsonl
+rm -f $PPC_PERF_OUTPUT
 source scripts/run_perf_collector.sh &> build/perf_stat_dir/perf_log.txt
-python3 scripts/create_perf_table.py --input build/perf_stat_dir/perf_log.txt --output build/perf_stat_dir
+python3 scripts/create_perf_table.py --input $PPC_PERF_OUTPUT --output build/perf_stat_dir
@@ -16,11 +16,11 @@ fi
 
 if [[ -z "$ASAN_RUN" ]]; then
   if [[ $OSTYPE == "linux-gnu" ]]; then
-    mpirun --oversubscribe -np 4 ./build/bin/sample_mpi
-    mpirun --oversubscribe -np 4 ./build/bin/sample_mpi_boost
+    mpirun --oversubscribe --bind-to none -np 4 ./build/bin/sample_mpi
+    mpirun --oversubscribe --bind-to none -np 4 ./build/bin/sample_mpi_boost
   elif [[ $OSTYPE == "darwin"* ]]; then
-    mpirun -np 2 ./build/bin/sample_mpi
-    mpirun -np 2 ./build/bin/sample_mpi_boost
+    mpirun --bind-to none -np 2 ./build/bin/sample_mpi
+    mpirun --bind-to none -np 2 ./build/bin/sample_mpi_boost
   fi
 fi
 ./build/bin/sample_omp
@@ -39,9 +39,9 @@ fi
 
 if [[ -z "$ASAN_RUN" ]]; then
   if [[ $OSTYPE == "linux-gnu" ]]; then
-    mpirun --oversubscribe -np 4 ./build/bin/mpi_func_tests --gtest_also_run_disabled_tests --gtest_repeat=10 --gtest_recreate_environments_when_repeating
+    mpirun --oversubscribe --bind-to none -np 4 ./build/bin/mpi_func_tests --gtest_also_run_disabled_tests --gtest_repeat=10 --gtest_recreate_environments_when_repeating
   elif [[ $OSTYPE == "darwin"* ]]; then
-    mpirun -np 2 ./build/bin/mpi_func_tests --gtest_also_run_disabled_tests --gtest_repeat=10 --gtest_recreate_environments_when_repeating
+    mpirun --bind-to none -np 2 ./build/bin/mpi_func_tests --gtest_also_run_disabled_tests --gtest_repeat=10 --gtest_recreate_environments_when_repeating
   fi
 fi
 
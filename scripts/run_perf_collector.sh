@@ -2,9 +2,9 @@
 
 if [[ -z "$ASAN_RUN" ]]; then
   if [[ $OSTYPE == "linux-gnu" ]]; then
-    mpirun --oversubscribe -np 4 ./build/bin/mpi_perf_tests
+    mpirun --oversubscribe --bind-to none -np 4 ./build/bin/mpi_perf_tests
   elif [[ $OSTYPE == "darwin"* ]]; then
-    mpirun -np 2 ./build/bin/mpi_perf_tests
+    mpirun --bind-to none -np 2 ./build/bin/mpi_perf_tests
   fi
 fi
 ./build/bin/omp_perf_tests
@@ -0,0 +1,142 @@
+import argparse
+import csv
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+# Runs perf tests of parallel backends across thread counts (MPI process
+# counts for mpi) and input sizes, then computes speedup and efficiency.
+# Strong scaling keeps the input size fixed, weak scaling grows it with the
+# count of workers. Sizes are controlled by PPC_PERF_SCALE, threads by
+# PPC_NUM_THREADS (see modules/core/util).
+
+
+def parse_counts(value):
+    return sorted({int(item) for item in value.split(",") if item.strip()})
+
+
+def default_counts():
+    counts = []
+    count = 1
+    while count <= (os.cpu_count() or 1):
+        counts.append(count)
+        count *= 2
+    return ",".join(str(count) for count in counts)
+
+
+parser = argparse.ArgumentParser(description="Strong and weak scaling sweep of perf tests")
+parser.add_argument('--bin-dir', help='Directory with *_perf_tests binaries', default=os.path.join('build', 'bin'))
+parser.add_argument('-o', '--output', help='Output directory', default=os.path.join('build', 'scaling_results'))
+parser.add_argument('--backends', help='Comma separated backends', default="omp,tbb,stl,mpi")
+parser.add_argument('--threads', help='Comma separated thread counts', default=default_counts())
+parser.add_argument('--procs', help='Comma separated MPI process counts', default=default_counts())
+parser.add_argument('--scales', help='Comma separated input size scales for strong scaling', default="1")
+parser.add_argument('--weak-scale', help='Input size scale per worker for weak scaling', type=float, default=1.0)
+parser.add_argument('--mode', help='Kind of scaling', choices=["strong", "weak", "both"], default="both")
+parser.add_argument('--mpirun', help='MPI launcher command', default="mpirun --oversubscribe --bind-to none")
+parser.add_argument('--min-efficiency', help='Efficiency treated as scaling limit', type=float, default=0.5)
+args = parser.parse_args()
+
+
+def run_config(backend, workers, scale):
+    binary = os.path.join(args.bin_dir, backend + "_perf_tests")
+    with tempfile.TemporaryDirectory() as temp_dir:
+        records_path = os.path.join(temp_dir, "perf_results.jsonl")
+        num_threads = 1 if backend == "mpi" else workers
+        env = dict(os.environ, PPC_PERF_OUTPUT=records_path, PPC_PERF_SCALE=repr(scale),
+                   PPC_NUM_THREADS=str(num_threads), OMP_NUM_THREADS=str(num_threads))
+        command = [binary]
+        if backend == "mpi":
+            command = args.mpirun.split() + ["-np", str(workers), binary]
+        print("Running " + backend + " workers=" + str(workers) + " scale=" + repr(scale), flush=True)
+        completed = subprocess.run(command, env=env, stdout=subprocess.DEVNULL)
+        # perf tests also fail when the time is outside of limits, records are still usable
+        if completed.returncode != 0:
+            print("  exit code " + str(completed.returncode))
+        if not os.path.exists(records_path):
+            return []
+        with open(records_path, "r") as records_file:
+            return [json.loads(line) for line in records_file if line.strip()]
+
+
+def scaling_rows(mode, scale, runs):
+    # runs: list of (workers, record) of one task and type of running
+    runs = sorted(runs, key=lambda run: run[0])
+    base_workers, base_record = runs[0]
+    rows = []
+    for workers, record in runs:
+        # speedup is relative to the smallest count of workers assuming linear scaling up to it
+        ratio = base_record["median"] / record["median"] if record["median"] > 0 else 0.0
+        if mode == "strong":
+            speedup = ratio * base_workers
+            efficiency = speedup / workers
+        else:
+            speedup = ratio * workers
+            efficiency = ratio
+        rows.append({"backend": record["backend"], "task": record["task"], "type": record["type"],
+                     "test": record.get("test", ""), "mode": mode,
+                     "scale": scale, "workers": workers, "input_size": record["input_size"],
+                     "median": record["median"], "ci_low": record["ci_low"], "ci_high": record["ci_high"],
+                     "speedup": speedup, "efficiency": efficiency})
+    return rows
+
+
+modes = ["strong", "weak"] if args.mode == "both" else [args.mode]
+backends = [backend for backend in args.backends.split(",") if backend]
+os.makedirs(args.output, exist_ok=True)
+
+all_rows = []
+raw_records = []
+for backend in backends:
+    if not os.path.exists(os.path.join(args.bin_dir, backend + "_perf_tests")):
+        print("Skipping " + backend + ": perf tests binary not found")
+        continue
+    counts = parse_counts(args.procs if backend == "mpi" else args.threads)
+    for mode in modes:
+        scales = [float(item) for item in args.scales.split(",")] if mode == "strong" else [args.weak_scale]
+        for scale in scales:
+            groups = {}
+            for workers in counts:
+                run_scale = scale if mode == "strong" else scale * workers
+                for record in run_config(backend, workers, run_scale):
+                    record.update({"mode": mode, "scale": scale, "workers": workers})
+                    raw_records.append(record)
+                    key = (record["task"], record["type"], record.get("test", ""))
+                    groups.setdefault(key, []).append((workers, record))
+            for key in sorted(groups):
+                all_rows.extend(scaling_rows(mode, scale, groups[key]))
+
+if not all_rows:
+    sys.exit("No perf records were produced")
+
+with open(os.path.join(args.output, "scaling_records.jsonl"), "w") as records_file:
+    for record in raw_records:
+        records_file.write(json.dumps(record) + "\n")
+
+fields = ["backend", "task", "type", "test", "mode", "scale", "workers", "input_size", "median", "ci_low", "ci_high",
+          "speedup", "efficiency"]
+with open(os.path.join(args.output, "scaling.csv"), "w", newline="") as csv_file:
+    writer = csv.DictWriter(csv_file, fieldnames=fields)
+    writer.writeheader()
+    writer.writerows(all_rows)
+
+curves = {}
+for row in all_rows:
+    key = (row["backend"], row["task"], row["type"], row["test"], row["mode"], row["scale"])
+    curves.setdefault(key, []).append(row)
+for (backend, task, perf_type, test, mode, scale), rows in curves.items():
+    print("\n" + "/".join([backend, task, perf_type, test]) + " " + mode + " scaling, scale " + repr(scale))
+    print("  workers  input_size      median   speedup  efficiency")
+    limit = rows[0]["workers"]
+    scaling = True
+    for row in rows:
+        print("  %7d  %10d  %10.6f  %8.2f  %10.2f" % (row["workers"], row["input_size"], row["median"],
+                                                     row["speedup"], row["efficiency"]))
+        scaling = scaling and row["efficiency"] >= args.min_efficiency
+        if scaling:
+            limit = row["workers"]
+    print("  scales up to " + str(limit) + " workers (efficiency >= " + str(args.min_efficiency) + ")")
+
+print("\nResults written to " + os.path.abspath(args.output))
@@ -0,0 +1,53 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "mpi/distribution/include/distribution.hpp"
+
+namespace {
+
+int element(std::uint64_t index) { return static_cast<int>(index % 1000) - 500; }
+
+}  // namespace
+
+TEST(mpi_distribution, check_balanced_partition) {
+  auto partition = ppc::mpi::Partition::balanced(10, 3);
+  EXPECT_EQ(partition.counts, (std::vector<std::uint64_t>{4, 3, 3}));
+  EXPECT_EQ(partition.displs, (std::vector<std::uint64_t>{0, 4, 7}));
+  partition = ppc::mpi::Partition::balanced(2, 4);
+  EXPECT_EQ(partition.counts, (std::vector<std::uint64_t>{1, 1, 0, 0}));
+  EXPECT_EQ(partition.displs, (std::vector<std::uint64_t>{0, 1, 2, 2}));
+}
+
+TEST(mpi_distribution, check_slices_cover_input_with_remainder) {
+  boost::mpi::communicator world;
+  for (std::uint64_t total : {0, 1, 7, 100003}) {
+    for (std::size_t blocks : {1, 3}) {
+      std::vector<int> input;
+      if (world.rank() == 0) {
+        input.resize(total);
+        for (std::uint64_t i = 0; i < total; i++) input[i] = element(i);
+      }
+      ppc::mpi::ScatteredSlice<int> slice(world, input.data(), total, blocks);
+      EXPECT_EQ(slice.total(), total);
+      std::uint64_t offset = slice.first();
+      for (std::size_t b = 0; b < slice.blocks(); b++) {
+        for (int value : slice.block(b)) EXPECT_EQ(value, element(offset++));
+      }
+      EXPECT_EQ(offset, slice.first() + slice.count());
+      if (world.rank() == 0 && total != 0) {
+        // root reads its slice in place
+        EXPECT_EQ(slice.view().data(), input.data());
+      }
+      // no element is lost or counted twice
+      std::uint64_t covered = 0;
+      all_reduce(world, slice.count(), covered, std::plus<>());
+      EXPECT_EQ(covered, total);
+    }
+  }
+}
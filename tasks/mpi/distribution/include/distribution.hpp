@@ -0,0 +1,74 @@
+// Copyright 2024 Nesterov Alexander
+#ifndef TASKS_MPI_DISTRIBUTION_INCLUDE_DISTRIBUTION_HPP_
+#define TASKS_MPI_DISTRIBUTION_INCLUDE_DISTRIBUTION_HPP_
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/nonblocking.hpp>
+#include <boost/mpi/request.hpp>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "core/task/include/data_view.hpp"
+
+namespace ppc::mpi {
+
+// Balanced split of total elements between procs ranks: counts differ by at
+// most one element, the remainder goes to the first ranks.
+struct Partition {
+  std::vector<std::uint64_t> counts;
+  std::vector<std::uint64_t> displs;
+
+  static Partition balanced(std::uint64_t total, int procs);
+};
+
+// Balanced slice of every rank of an array held by root. Root posts
+// non-blocking sends of the other slices straight from its input, so the
+// input is neither copied nor staged, and keeps a view of its own slice.
+// A slice travels in blocks, each with its own receive: block(0) is ready
+// while later blocks of the slice are still in flight.
+//   ppc::mpi::ScatteredSlice<int> slice(world, data, count);
+//   for (std::size_t b = 0; b < slice.blocks(); b++) process(slice.block(b));
+// The constructor is collective, data and total are read on root only.
+// Root must keep data unchanged until wait() or the destructor.
+template <class T>
+class ScatteredSlice {
+ public:
+  ScatteredSlice(const boost::mpi::communicator &world, const T *data, std::uint64_t total, std::size_t blocks = 4,
+                 int root = 0);
+  ScatteredSlice(const ScatteredSlice &) = delete;
+  ScatteredSlice &operator=(const ScatteredSlice &) = delete;
+  ~ScatteredSlice() { wait(); }
+
+  [[nodiscard]] std::uint64_t total() const { return total_; }
+  // index of the first element of the slice in the whole array
+  [[nodiscard]] std::uint64_t first() const { return first_; }
+  [[nodiscard]] std::uint64_t count() const { return count_; }
+  [[nodiscard]] std::size_t blocks() const { return block_begin_.size() - 1; }
+
+  // block b of the slice, waits for its arrival
+  std::span<const T> block(std::size_t b);
+  // whole slice, waits for all blocks
+  ppc::core::DataView<const T> view();
+  // completes every pending send and receive
+  void wait();
+
+ private:
+  std::uint64_t total_ = 0;
+  std::uint64_t first_ = 0;
+  std::uint64_t count_ = 0;
+  // root: its slice inside of the input, other ranks: storage_
+  const T *data_ = nullptr;
+  std::vector<T> storage_;
+  std::vector<std::uint64_t> block_begin_;
+  std::vector<boost::mpi::request> receives_;
+  std::vector<boost::mpi::request> sends_;
+  std::vector<bool> arrived_;
+};
+
+extern template class ScatteredSlice<int>;
+extern template class ScatteredSlice<double>;
+
+}  // namespace ppc::mpi
+
+#endif  // TASKS_MPI_DISTRIBUTION_INCLUDE_DISTRIBUTION_HPP_
@@ -0,0 +1,100 @@
+// Copyright 2024 Nesterov Alexander
+#include "mpi/distribution/include/distribution.hpp"
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <limits>
+
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+constexpr int slice_tag = 0x5C;
+
+// first element of every block of a slice of count elements, messages stay below INT_MAX elements
+std::vector<std::uint64_t> block_bounds(std::uint64_t count, std::size_t blocks) {
+  constexpr std::uint64_t max_message = std::numeric_limits<int>::max();
+  blocks = std::max<std::size_t>({blocks, 1, static_cast<std::size_t>((count + max_message - 1) / max_message)});
+  blocks = std::min<std::size_t>(blocks, std::max<std::uint64_t>(count, 1));
+  std::vector<std::uint64_t> bounds(blocks + 1);
+  for (std::size_t b = 0; b < blocks; b++) bounds[b] = ppc::core::balanced_chunk(0, count, blocks, b).first;
+  bounds[blocks] = count;
+  return bounds;
+}
+
+}  // namespace
+
+ppc::mpi::Partition ppc::mpi::Partition::balanced(std::uint64_t total, int procs) {
+  Partition partition;
+  const auto parts = static_cast<std::size_t>(procs);
+  for (std::size_t proc = 0; proc < parts; proc++) {
+    auto [begin, end] = ppc::core::balanced_chunk(0, total, parts, proc);
+    partition.displs.push_back(begin);
+    partition.counts.push_back(end - begin);
+  }
+  return partition;
+}
+
+template <class T>
+ppc::mpi::ScatteredSlice<T>::ScatteredSlice(const boost::mpi::communicator &world, const T *data,
+                                            std::uint64_t total, std::size_t blocks, int root)
+    : total_(total) {
+  broadcast(world, total_, root);
+  const auto partition = Partition::balanced(total_, world.size());
+  const auto rank = static_cast<std::size_t>(world.rank());
+  first_ = partition.displs[rank];
+  count_ = partition.counts[rank];
+  block_begin_ = block_bounds(count_, blocks);
+  arrived_.assign(this->blocks(), world.rank() == root);
+
+  if (world.rank() == root) {
+    data_ = data + first_;
+    for (int proc = 0; proc < world.size(); proc++) {
+      if (proc == root) continue;
+      const auto bounds = block_bounds(partition.counts[proc], blocks);
+      for (std::size_t b = 0; b + 1 < bounds.size(); b++) {
+        const auto size = static_cast<int>(bounds[b + 1] - bounds[b]);
+        if (size == 0) continue;
+        sends_.push_back(world.isend(proc, slice_tag, data + partition.displs[proc] + bounds[b], size));
+      }
+    }
+    return;
+  }
+  storage_.resize(count_);
+  data_ = storage_.data();
+  receives_.resize(this->blocks());
+  for (std::size_t b = 0; b < this->blocks(); b++) {
+    const auto size = static_cast<int>(block_begin_[b + 1] - block_begin_[b]);
+    if (size == 0) {
+      arrived_[b] = true;
+      continue;
+    }
+    // blocks from one source with one tag are matched in the order of posting
+    receives_[b] = world.irecv(root, slice_tag, storage_.data() + block_begin_[b], size);
+  }
+}
+
+template <class T>
+std::span<const T> ppc::mpi::ScatteredSlice<T>::block(std::size_t b) {
+  if (!arrived_[b]) {
+    receives_[b].wait();
+    arrived_[b] = true;
+  }
+  return {data_ + block_begin_[b], static_cast<std::size_t>(block_begin_[b + 1] - block_begin_[b])};
+}
+
+template <class T>
+ppc::core::DataView<const T> ppc::mpi::ScatteredSlice<T>::view() {
+  for (std::size_t b = 0; b < blocks(); b++) block(b);
+  return {data_, static_cast<std::size_t>(count_)};
+}
+
+template <class T>
+void ppc::mpi::ScatteredSlice<T>::wait() {
+  for (std::size_t b = 0; b < blocks(); b++) block(b);
+  boost::mpi::wait_all(sends_.begin(), sends_.end());
+  sends_.clear();
+}
+
+template class ppc::mpi::ScatteredSlice<int>;
+template class ppc::mpi::ScatteredSlice<double>;
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "mpi/distribution/include/distribution.hpp"
 
 namespace nesterov_a_test_task_mpi {
 
@@ -27,7 +28,7 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_;
+  ppc::core::DataView<const int> input_;
   int res{};
   std::string ops;
 };
@@ -42,7 +43,7 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_, local_input_;
+  std::unique_ptr<ppc::mpi::ScatteredSlice<int>> local_input_;
   int res{};
   std::string ops;
   boost::mpi::communicator world;
@@ -5,7 +5,9 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/util/include/util.hpp"
 #include "mpi/example/include/ops_mpi.hpp"
+#include "mpi/hybrid/include/hybrid.hpp"
 
 TEST(mpi_example_perf_test, test_pipeline_run) {
   boost::mpi::communicator world;
@@ -15,7 +17,7 @@ TEST(mpi_example_perf_test, test_pipeline_run) {
   std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
   int count_size_vector;
   if (world.rank() == 0) {
-    count_size_vector = 120;
+    count_size_vector = static_cast<int>(ppc::util::get_perf_size(10000000));
     global_vec = std::vector<int>(count_size_vector, 1);
     taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_vec.data()));
     taskDataPar->inputs_count.emplace_back(global_vec.size());
@@ -32,6 +34,9 @@ TEST(mpi_example_perf_test, test_pipeline_run) {
   // Create Perf attributes
   auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
   perfAttr->num_running = 10;
+  perfAttr->input_size = global_vec.size();
+  perfAttr->num_threads = 1;
+  perfAttr->num_procs = world.size();
   const boost::mpi::timer current_timer;
   perfAttr->current_timer = [&] { return current_timer.elapsed(); };
 
@@ -55,7 +60,7 @@ TEST(mpi_example_perf_test, test_task_run) {
   std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
   int count_size_vector;
   if (world.rank() == 0) {
-    count_size_vector = 120;
+    count_size_vector = static_cast<int>(ppc::util::get_perf_size(10000000));
     global_vec = std::vector<int>(count_size_vector, 1);
     taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_vec.data()));
     taskDataPar->inputs_count.emplace_back(global_vec.size());
@@ -72,6 +77,9 @@ TEST(mpi_example_perf_test, test_task_run) {
   // Create Perf attributes
   auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
   perfAttr->num_running = 10;
+  perfAttr->input_size = global_vec.size();
+  perfAttr->num_threads = 1;
+  perfAttr->num_procs = world.size();
   const boost::mpi::timer current_timer;
   perfAttr->current_timer = [&] { return current_timer.elapsed(); };
 
@@ -88,7 +96,7 @@ TEST(mpi_example_perf_test, test_task_run) {
 }
 
 int main(int argc, char** argv) {
-  boost::mpi::environment env(argc, argv);
+  boost::mpi::environment env(argc, argv, ppc::mpi::requested_threading());
   boost::mpi::communicator world;
   ::testing::InitGoogleTest(&argc, argv);
   ::testing::TestEventListeners& listeners = ::testing::UnitTest::GetInstance()->listeners();
@@ -2,32 +2,25 @@
 #include "mpi/example/include/ops_mpi.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
-#include <random>
+#include <limits>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "core/random/include/random.hpp"
+
 using namespace std::chrono_literals;
 
 std::vector<int> nesterov_a_test_task_mpi::getRandomVector(int sz) {
-  std::random_device dev;
-  std::mt19937 gen(dev());
-  std::vector<int> vec(sz);
-  for (int i = 0; i < sz; i++) {
-    vec[i] = gen() % 100;
-  }
-  return vec;
+  return ppc::core::random_vector<int>(sz, {0, 99});
 }
 
 bool nesterov_a_test_task_mpi::TestMPITaskSequential::pre_processing() {
   internal_order_test();
-  // Init vectors
-  input_ = std::vector<int>(taskData->inputs_count[0]);
-  auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-  for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-    input_[i] = tmp_ptr[i];
-  }
+  // Init view of input data
+  input_ = taskData->input_view<int>(0);
   // Init value for output
   res = 0;
   return true;
@@ -59,29 +52,16 @@ bool nesterov_a_test_task_mpi::TestMPITaskSequential::post_processing() {
 
 bool nesterov_a_test_task_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
-  unsigned int delta = 0;
-  if (world.rank() == 0) {
-    delta = taskData->inputs_count[0] / world.size();
-  }
-  broadcast(world, delta, 0);
-
-  if (world.rank() == 0) {
-    // Init vectors
-    input_ = std::vector<int>(taskData->inputs_count[0]);
-    auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
-    for (int proc = 1; proc < world.size(); proc++) {
-      world.send(proc, 0, input_.data() + proc * delta, delta);
-    }
-  }
-  local_input_ = std::vector<int>(delta);
+  // Init slices of input data, rank 0 sends them without waiting
+  const int* input = nullptr;
+  std::uint64_t count = 0;
   if (world.rank() == 0) {
-    local_input_ = std::vector<int>(input_.begin(), input_.begin() + delta);
-  } else {
-    world.recv(0, 0, local_input_.data(), delta);
+    input = taskData->input_view<int>(0).data();
+    count = taskData->input_buffer(0).count;
   }
+  // slices of the previous run are completed first
+  local_input_.reset();
+  local_input_ = std::make_unique<ppc::mpi::ScatteredSlice<int>>(world, input, count);
   // Init value for output
   res = 0;
   return true;
@@ -98,13 +78,18 @@ bool nesterov_a_test_task_mpi::TestMPITaskParallel::validation() {
 
 bool nesterov_a_test_task_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  int local_res;
-  if (ops == "+") {
-    local_res = std::accumulate(local_input_.begin(), local_input_.end(), 0);
-  } else if (ops == "-") {
-    local_res = -std::accumulate(local_input_.begin(), local_input_.end(), 0);
-  } else if (ops == "max") {
-    local_res = *std::max_element(local_input_.begin(), local_input_.end());
+  // blocks are processed as they arrive, a rank without elements keeps the identity
+  int local_res = ops == "max" ? std::numeric_limits<int>::min() : 0;
+  for (std::size_t b = 0; b < local_input_->blocks(); b++) {
+    auto block = local_input_->block(b);
+    if (block.empty()) continue;
+    if (ops == "+") {
+      local_res += std::accumulate(block.begin(), block.end(), 0);
+    } else if (ops == "-") {
+      local_res -= std::accumulate(block.begin(), block.end(), 0);
+    } else if (ops == "max") {
+      local_res = std::max(local_res, *std::max_element(block.begin(), block.end()));
+    }
   }
 
   if (ops == "+" || ops == "-") {
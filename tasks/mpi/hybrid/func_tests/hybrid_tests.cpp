@@ -0,0 +1,142 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "core/random/include/random.hpp"
+#include "mpi/hybrid/include/hybrid.hpp"
+#include "mpi/hybrid/include/ops_mpi.hpp"
+
+namespace {
+
+// sets or removes (value == nullptr) an environment variable
+void set_env(const char *name, const char *value) {
+#ifdef _WIN32
+  _putenv_s(name, value != nullptr ? value : "");
+#else
+  if (value != nullptr) {
+    setenv(name, value, 1);
+  } else {
+    unsetenv(name);
+  }
+#endif
+}
+
+template <class T>
+T run_hybrid_sum(std::vector<T> &in) {
+  boost::mpi::communicator world;
+  std::vector<T> out(1, 0);
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskData->add_input(in);
+    taskData->add_output(out);
+  }
+  nesterov_a_hybrid_mpi::VectorSumHybrid<T> task(taskData);
+  EXPECT_TRUE(task.validation());
+  task.pre_processing();
+  task.run();
+  task.post_processing();
+  return out[0];
+}
+
+}  // namespace
+
+TEST(mpi_hybrid, check_requested_threading) {
+  set_env("PPC_MPI_THREADING", "multiple");
+  EXPECT_EQ(ppc::mpi::requested_threading(), boost::mpi::threading::multiple);
+  // unknown levels fall back to the default
+  set_env("PPC_MPI_THREADING", "parallel");
+  EXPECT_EQ(ppc::mpi::requested_threading(), boost::mpi::threading::funneled);
+  set_env("PPC_MPI_THREADING", nullptr);
+  EXPECT_EQ(ppc::mpi::requested_threading(), boost::mpi::threading::funneled);
+}
+
+TEST(mpi_hybrid, check_node_topology) {
+  boost::mpi::communicator world;
+  for (int ranks_per_node : {0, 1, 2}) {
+    ppc::mpi::NodeTopology topology(world, ranks_per_node);
+    // every rank belongs to exactly one node
+    int leaders = topology.is_leader() ? 1 : 0;
+    int total_leaders = 0;
+    all_reduce(world, leaders, total_leaders, std::plus<>());
+    EXPECT_EQ(total_leaders, topology.node_count());
+    EXPECT_LT(topology.node_index(), topology.node_count());
+    if (ranks_per_node != 0) {
+      EXPECT_EQ(topology.node_count(), (world.size() + ranks_per_node - 1) / ranks_per_node);
+      EXPECT_EQ(topology.node_index(), world.rank() / ranks_per_node);
+    }
+    if (world.rank() == 0) {
+      EXPECT_TRUE(topology.is_leader());
+      EXPECT_EQ(topology.node_index(), 0);
+    }
+    EXPECT_EQ(topology.rank_cpus(3).size(), 3U);
+    // threads are placed by the position of the rank on its machine, ranks of
+    // emulated nodes do not restart from the first core
+    MPI_Comm shared;
+    MPI_Comm_split_type(world, MPI_COMM_TYPE_SHARED, world.rank(), MPI_INFO_NULL, &shared);
+    boost::mpi::communicator host(shared, boost::mpi::comm_take_ownership);
+    EXPECT_EQ(topology.host_rank(), host.rank());
+    EXPECT_EQ(topology.host_size(), host.size());
+  }
+}
+
+TEST(mpi_hybrid, check_hierarchical_reduce) {
+  boost::mpi::communicator world;
+  for (int ranks_per_node : {1, 2, 3}) {
+    ppc::mpi::NodeTopology topology(world, ranks_per_node);
+    ppc::core::CommunicationTimes times;
+    const int sum = ppc::mpi::hierarchical_reduce(topology, world.rank() + 1, std::plus<int>(), times);
+    if (world.rank() == 0) {
+      EXPECT_EQ(sum, world.size() * (world.size() + 1) / 2);
+    }
+    EXPECT_GE(times.intra_node, 0.0);
+    EXPECT_GE(times.inter_node, 0.0);
+  }
+}
+
+#if defined(__linux__)
+TEST(mpi_hybrid, check_main_thread_mask_is_restored) {
+  boost::mpi::communicator world;
+  cpu_set_t before;
+  CPU_ZERO(&before);
+  ASSERT_EQ(sched_getaffinity(0, sizeof(before), &before), 0);
+  {
+    ppc::mpi::HybridRuntime runtime(world);
+    EXPECT_GE(runtime.threads(), 1);
+  }
+  cpu_set_t after;
+  CPU_ZERO(&after);
+  ASSERT_EQ(sched_getaffinity(0, sizeof(after), &after), 0);
+  EXPECT_TRUE(CPU_EQUAL(&before, &after));
+}
+#endif
+
+TEST(mpi_hybrid, check_vector_sum) {
+  boost::mpi::communicator world;
+  EXPECT_GE(ppc::mpi::HybridRuntime::global().threads(), 1);
+  for (std::size_t count : {1, 7, 100003}) {
+    std::vector<int> in;
+    if (world.rank() == 0) in = ppc::core::random_vector<int>(count, {-1000, 1000});
+    const int sum = run_hybrid_sum(in);
+    if (world.rank() == 0) {
+      EXPECT_EQ(sum, std::accumulate(in.begin(), in.end(), 0));
+    }
+  }
+  std::vector<double> in;
+  if (world.rank() == 0) in = std::vector<double>(5003, 0.5);
+  const double sum = run_hybrid_sum(in);
+  if (world.rank() == 0) {
+    EXPECT_DOUBLE_EQ(sum, 2501.5);
+  }
+}
@@ -0,0 +1,120 @@
+// Copyright 2024 Nesterov Alexander
+#ifndef TASKS_MPI_HYBRID_INCLUDE_HYBRID_HPP_
+#define TASKS_MPI_HYBRID_INCLUDE_HYBRID_HPP_
+
+#include <mpi.h>
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <memory>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace ppc::mpi {
+
+// Threading support requested from MPI by PPC_MPI_THREADING: "single",
+// "funneled" (default), "serialized" or "multiple". Hybrid tasks call MPI
+// from the main thread only, funneled is enough for them. Unknown values are
+// reported to stderr and fall back to funneled.
+//   boost::mpi::environment env(argc, argv, ppc::mpi::requested_threading());
+boost::mpi::threading::level requested_threading();
+
+// Ranks grouped by node: ranks sharing memory, or blocks of ranks_per_node
+// consecutive ranks to emulate several nodes on one machine (also set by
+// PPC_RANKS_PER_NODE). The first rank of every node is its leader.
+class NodeTopology {
+ public:
+  explicit NodeTopology(const boost::mpi::communicator &world, int ranks_per_node = 0);
+
+  // ranks of the node of the calling rank
+  [[nodiscard]] const boost::mpi::communicator &node() const { return node_; }
+  // leaders of all nodes, meaningful on leaders only
+  [[nodiscard]] const boost::mpi::communicator &leaders() const { return leaders_; }
+  [[nodiscard]] bool is_leader() const { return node_.rank() == 0; }
+  [[nodiscard]] int node_index() const { return node_index_; }
+  [[nodiscard]] int node_count() const { return node_count_; }
+  // rank and count of the ranks sharing memory with the calling rank, the
+  // same as node() unless nodes are emulated
+  [[nodiscard]] int host_rank() const { return host_rank_; }
+  [[nodiscard]] int host_size() const { return host_size_; }
+
+  // Cores of the threads of the calling rank: the cores of the machine in
+  // compact order are dealt to the ranks of the machine in consecutive
+  // groups, so a rank that fits into a NUMA node stays on it and ranks of
+  // emulated nodes do not share cores. -1 when pinning is disabled by
+  // affinity_policy().
+  [[nodiscard]] std::vector<int> rank_cpus(int num_threads) const;
+
+ private:
+  boost::mpi::communicator node_;
+  boost::mpi::communicator leaders_;
+  int node_index_ = 0;
+  int node_count_ = 1;
+  int host_rank_ = 0;
+  int host_size_ = 1;
+};
+
+// Node topology and the thread pool of one rank. The ppc::util::get_num_threads()
+// threads of a machine are shared by its ranks, also by the ranks of emulated
+// nodes; with MPI below funneled every rank runs one thread. Only threads are placed, ranks stay where mpirun put
+// them (run with --bind-to none so threads can use the cores of the node).
+// With pin_main_thread the calling thread is pinned to the first core of the
+// rank while the runtime lives, the destructor restores its previous mask and
+// must run on the same thread.
+class HybridRuntime {
+ public:
+  explicit HybridRuntime(const boost::mpi::communicator &world, int ranks_per_node = 0, bool pin_main_thread = true);
+  HybridRuntime(const HybridRuntime &) = delete;
+  HybridRuntime &operator=(const HybridRuntime &) = delete;
+  ~HybridRuntime();
+
+  [[nodiscard]] const NodeTopology &topology() const { return topology_; }
+  [[nodiscard]] int threads() const { return pool_->size(); }
+  ppc::core::ThreadPool &pool() { return *pool_; }
+
+  // runtime of MPI_COMM_WORLD, created on first use: collective, the first
+  // call must be made by every rank. It lives until exit and leaves the main
+  // thread unpinned, later tests of the process keep the whole mask.
+  static HybridRuntime &global();
+
+ private:
+  NodeTopology topology_;
+  std::unique_ptr<ppc::core::ThreadPool> pool_;
+  // cpus of the calling thread before it was pinned, empty when not pinned
+  std::vector<int> saved_cpus_;
+};
+
+// Combines value of every rank with op, first inside of each node, then
+// between node leaders. The result is valid on world rank 0, the time of both
+// steps is added to times.
+template <class T, class Op>
+T hierarchical_reduce(const NodeTopology &topology, const T &value, Op op, ppc::core::CommunicationTimes &times) {
+  const double start = MPI_Wtime();
+  T node_value = value;
+  if (topology.node().size() > 1) {
+    if (topology.is_leader()) {
+      boost::mpi::reduce(topology.node(), value, node_value, op, 0);
+    } else {
+      boost::mpi::reduce(topology.node(), value, op, 0);
+    }
+  }
+  const double middle = MPI_Wtime();
+  T result = node_value;
+  if (topology.is_leader() && topology.leaders().size() > 1) {
+    if (topology.leaders().rank() == 0) {
+      boost::mpi::reduce(topology.leaders(), node_value, result, op, 0);
+    } else {
+      boost::mpi::reduce(topology.leaders(), node_value, op, 0);
+    }
+  }
+  times.intra_node += middle - start;
+  times.inter_node += MPI_Wtime() - middle;
+  return result;
+}
+
+}  // namespace ppc::mpi
+
+#endif  // TASKS_MPI_HYBRID_INCLUDE_HYBRID_HPP_
@@ -0,0 +1,40 @@
+// Copyright 2024 Nesterov Alexander
+#ifndef TASKS_MPI_HYBRID_INCLUDE_OPS_MPI_HPP_
+#define TASKS_MPI_HYBRID_INCLUDE_OPS_MPI_HPP_
+
+#include <boost/mpi/communicator.hpp>
+#include <memory>
+
+#include "core/task/include/task.hpp"
+#include "mpi/distribution/include/distribution.hpp"
+#include "mpi/hybrid/include/hybrid.hpp"
+
+namespace nesterov_a_hybrid_mpi {
+
+// Sum of the elements of a vector held by rank 0, as the reference task
+// SumOfVectorElements. Rank 0 scatters balanced slices, every rank sums the
+// blocks of its slice with the threads of HybridRuntime::global(), and the
+// partial sums are reduced inside of each node, then between nodes. Waits
+// for blocks of the slice are communication time too: intra-node on the node
+// of rank 0, inter-node on the other nodes.
+template <class InOutType>
+class VectorSumHybrid : public ppc::core::Task {
+ public:
+  explicit VectorSumHybrid(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  std::unique_ptr<ppc::mpi::ScatteredSlice<InOutType>> slice_;
+  InOutType res_{};
+  boost::mpi::communicator world;
+};
+
+extern template class VectorSumHybrid<int>;
+extern template class VectorSumHybrid<double>;
+
+}  // namespace nesterov_a_hybrid_mpi
+
+#endif  // TASKS_MPI_HYBRID_INCLUDE_OPS_MPI_HPP_
@@ -0,0 +1,65 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/timer.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/util/include/util.hpp"
+#include "mpi/hybrid/include/hybrid.hpp"
+#include "mpi/hybrid/include/ops_mpi.hpp"
+
+namespace {
+
+void run_perf(bool pipeline, uint64_t num_running) {
+  boost::mpi::communicator world;
+  std::vector<int> global_vec;
+  std::vector<int> global_sum(1, 0);
+  int count_size_vector = 0;
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    count_size_vector = static_cast<int>(ppc::util::get_perf_size(10000000));
+    global_vec = std::vector<int>(count_size_vector, 1);
+    taskDataPar->add_input(global_vec);
+    taskDataPar->add_output(global_sum);
+  }
+
+  auto task = std::make_shared<nesterov_a_hybrid_mpi::VectorSumHybrid<int>>(taskDataPar);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = num_running;
+  perfAttr->input_size = global_vec.size();
+  perfAttr->num_threads = ppc::mpi::HybridRuntime::global().threads();
+  perfAttr->num_procs = world.size();
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  if (pipeline) {
+    perfAnalyzer->pipeline_run(perfAttr, perfResults);
+  } else {
+    perfAnalyzer->task_run(perfAttr, perfResults);
+  }
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    ASSERT_EQ(count_size_vector, global_sum[0]);
+  }
+}
+
+}  // namespace
+
+TEST(mpi_hybrid_perf_test, test_pipeline_run) { run_perf(true, 50); }
+
+TEST(mpi_hybrid_perf_test, test_task_run) {
+  // the slices are scattered by pre_processing, run only reduces them; the
+  // intra- and inter-node parts of the reduction are printed separately
+  run_perf(false, 300);
+}
@@ -0,0 +1,112 @@
+// Copyright 2024 Nesterov Alexander
+#include "mpi/hybrid/include/hybrid.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "core/numa/include/numa.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+int emulated_ranks_per_node() {
+  const char *value = std::getenv("PPC_RANKS_PER_NODE");
+  if (value == nullptr || *value == '\0') return 0;
+  return std::max(0, std::atoi(value));
+}
+
+// cpus the calling thread may run on, empty when it is not known
+std::vector<int> current_thread_cpus() {
+  std::vector<int> cpus;
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) != 0) return cpus;
+  for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+  }
+#endif
+  return cpus;
+}
+
+void set_current_thread_cpus(const std::vector<int> &cpus) {
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu : cpus) CPU_SET(cpu, &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+  (void)cpus;
+#endif
+}
+
+}  // namespace
+
+boost::mpi::threading::level ppc::mpi::requested_threading() {
+  const char *value = std::getenv("PPC_MPI_THREADING");
+  const std::string name = value != nullptr ? value : "";
+  if (name.empty() || name == "funneled") return boost::mpi::threading::funneled;
+  if (name == "single") return boost::mpi::threading::single;
+  if (name == "serialized") return boost::mpi::threading::serialized;
+  if (name == "multiple") return boost::mpi::threading::multiple;
+  std::cerr << "Unknown PPC_MPI_THREADING '" << name << "', expected single, funneled, serialized or multiple, "
+            << "using funneled" << std::endl;
+  return boost::mpi::threading::funneled;
+}
+
+ppc::mpi::NodeTopology::NodeTopology(const boost::mpi::communicator &world, int ranks_per_node) {
+  if (ranks_per_node <= 0) ranks_per_node = emulated_ranks_per_node();
+  MPI_Comm shared;
+  MPI_Comm_split_type(world, MPI_COMM_TYPE_SHARED, world.rank(), MPI_INFO_NULL, &shared);
+  boost::mpi::communicator host(shared, boost::mpi::comm_take_ownership);
+  host_rank_ = host.rank();
+  host_size_ = host.size();
+  node_ = ranks_per_node > 0 ? world.split(world.rank() / ranks_per_node, world.rank()) : host;
+  // world rank 0 is the first rank of its node and the first leader
+  leaders_ = world.split(is_leader() ? 0 : 1, world.rank());
+  node_index_ = leaders_.rank();
+  node_count_ = leaders_.size();
+  boost::mpi::broadcast(node_, node_index_, 0);
+  boost::mpi::broadcast(node_, node_count_, 0);
+}
+
+std::vector<int> ppc::mpi::NodeTopology::rank_cpus(int num_threads) const {
+  if (ppc::core::affinity_policy() == ppc::core::AffinityPolicy::NONE) return std::vector<int>(num_threads, -1);
+  const auto &topology = ppc::core::NumaTopology::system();
+  std::vector<int> cpus(num_threads);
+  for (int i = 0; i < num_threads; i++) {
+    cpus[i] = ppc::core::thread_cpu(topology, ppc::core::AffinityPolicy::COMPACT, host_rank_ * num_threads + i);
+  }
+  return cpus;
+}
+
+ppc::mpi::HybridRuntime::HybridRuntime(const boost::mpi::communicator &world, int ranks_per_node,
+                                       bool pin_main_thread)
+    : topology_(world, ranks_per_node) {
+  int threads = 1;
+  if (boost::mpi::environment::thread_level() >= boost::mpi::threading::funneled) {
+    threads = std::max(1, ppc::util::get_num_threads() / topology_.host_size());
+  }
+  const auto cpus = topology_.rank_cpus(threads);
+  if (pin_main_thread && cpus.front() >= 0) {
+    saved_cpus_ = current_thread_cpus();
+    if (!ppc::core::pin_current_thread(cpus.front())) saved_cpus_.clear();
+  }
+  pool_ = std::make_unique<ppc::core::ThreadPool>(cpus);
+}
+
+ppc::mpi::HybridRuntime::~HybridRuntime() {
+  if (!saved_cpus_.empty()) set_current_thread_cpus(saved_cpus_);
+}
+
+ppc::mpi::HybridRuntime &ppc::mpi::HybridRuntime::global() {
+  static HybridRuntime runtime{boost::mpi::communicator(), 0, false};
+  return runtime;
+}
@@ -0,0 +1,73 @@
+// Copyright 2024 Nesterov Alexander
+#include "mpi/hybrid/include/ops_mpi.hpp"
+
+#include <cstdint>
+#include <functional>
+
+#include "core/thread_pool/include/parallel_reduce.hpp"
+
+template <class InOutType>
+bool nesterov_a_hybrid_mpi::VectorSumHybrid<InOutType>::pre_processing() {
+  internal_order_test();
+  // the runtime is created by the first task on every rank
+  ppc::mpi::HybridRuntime::global();
+  const InOutType *input = nullptr;
+  std::uint64_t count = 0;
+  if (world.rank() == 0) {
+    input = taskData->input_view<InOutType>(0).data();
+    count = taskData->input_buffer(0).count;
+  }
+  // slices of the previous run are completed first
+  slice_.reset();
+  slice_ = std::make_unique<ppc::mpi::ScatteredSlice<InOutType>>(world, input, count);
+  res_ = InOutType{};
+  return true;
+}
+
+template <class InOutType>
+bool nesterov_a_hybrid_mpi::VectorSumHybrid<InOutType>::validation() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    return taskData->inputs_count.size() == 1 && taskData->outputs_count.size() == 1 &&
+           taskData->outputs_count[0] == 1;
+  }
+  return true;
+}
+
+template <class InOutType>
+bool nesterov_a_hybrid_mpi::VectorSumHybrid<InOutType>::run() {
+  internal_order_test();
+  auto &runtime = ppc::mpi::HybridRuntime::global();
+  InOutType local{};
+  // waits for blocks of the slice still in flight from rank 0
+  double scatter_time = 0.0;
+  for (std::size_t b = 0; b < slice_->blocks(); b++) {
+    const double start = MPI_Wtime();
+    auto block = slice_->block(b);
+    scatter_time += MPI_Wtime() - start;
+    local += ppc::core::parallel_reduce(runtime.pool(), block.data(), block.data() + block.size(), InOutType{},
+                                        std::plus<InOutType>());
+  }
+  ppc::core::CommunicationTimes times;
+  // rank 0 belongs to the first node
+  if (runtime.topology().node_index() == 0) {
+    times.intra_node += scatter_time;
+  } else {
+    times.inter_node += scatter_time;
+  }
+  res_ = ppc::mpi::hierarchical_reduce(runtime.topology(), local, std::plus<InOutType>(), times);
+  add_communication_time(times.intra_node, times.inter_node);
+  return true;
+}
+
+template <class InOutType>
+bool nesterov_a_hybrid_mpi::VectorSumHybrid<InOutType>::post_processing() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    reinterpret_cast<InOutType *>(taskData->outputs[0])[0] = res_;
+  }
+  return true;
+}
+
+template class nesterov_a_hybrid_mpi::VectorSumHybrid<int>;
+template class nesterov_a_hybrid_mpi::VectorSumHybrid<double>;
@@ -0,0 +1,88 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "core/random/include/random.hpp"
+#include "mpi/hybrid/include/hybrid.hpp"
+#include "mpi/shared_memory/include/ops_mpi.hpp"
+#include "mpi/shared_memory/include/shared_memory.hpp"
+
+TEST(mpi_shared_memory, check_node_shared_input) {
+  boost::mpi::communicator world;
+  for (int ranks_per_node : {0, 1, 2}) {
+    ppc::mpi::NodeTopology topology(world, ranks_per_node);
+    ppc::mpi::NodeSharedInput<int> input(world, topology, nullptr, 0);
+    // the window grows and is reused for smaller arrays
+    std::vector<int> data;
+    for (std::uint64_t total : {1, 1001, 3, 0, 2000}) {
+      if (world.rank() == 0) {
+        data.resize(total);
+        std::iota(data.begin(), data.end(), 0);
+      }
+      input.assign(data.data(), total);
+      EXPECT_EQ(input.total(), total);
+      auto view = input.view();
+      ASSERT_EQ(view.size(), input.count());
+      for (std::size_t i = 0; i < view.size(); i++) {
+        ASSERT_EQ(view[i], static_cast<int>(input.first() + i));
+      }
+      // the slices of all ranks cover the array once
+      std::uint64_t covered = 0;
+      all_reduce(world, input.count(), covered, std::plus<>());
+      EXPECT_EQ(covered, total);
+      EXPECT_GE(input.node_view().size(), view.size());
+    }
+  }
+}
+
+TEST(mpi_shared_memory, check_vector_sum) {
+  boost::mpi::communicator world;
+  for (std::size_t count : {1, 7, 100003}) {
+    std::vector<int> in;
+    std::vector<int> out(1, 0);
+    auto taskData = std::make_shared<ppc::core::TaskData>();
+    if (world.rank() == 0) {
+      in = ppc::core::random_vector<int>(count, {-1000, 1000});
+      taskData->add_input(in);
+      taskData->add_output(out);
+    }
+    nesterov_a_shared_memory_mpi::VectorSumSharedMemory<int> task(taskData);
+    ASSERT_TRUE(task.validation());
+    task.pre_processing();
+    task.run();
+    task.post_processing();
+    if (world.rank() == 0) {
+      EXPECT_EQ(out[0], std::accumulate(in.begin(), in.end(), 0));
+    }
+  }
+}
+
+TEST(mpi_shared_memory, check_vector_sum_double) {
+  boost::mpi::communicator world;
+  std::vector<double> in;
+  std::vector<double> out(1, 0.0);
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    in = std::vector<double>(5003, 0.5);
+    taskData->add_input(in);
+    taskData->add_output(out);
+  }
+  nesterov_a_shared_memory_mpi::VectorSumSharedMemory<double> task(taskData);
+  // the window of the first run is reused by the second one
+  for (int i = 0; i < 2; i++) {
+    ASSERT_TRUE(task.validation());
+    task.pre_processing();
+    task.run();
+    task.post_processing();
+  }
+  if (world.rank() == 0) {
+    EXPECT_DOUBLE_EQ(out[0], 2501.5);
+  }
+}
@@ -0,0 +1,40 @@
+// Copyright 2024 Nesterov Alexander
+#ifndef TASKS_MPI_SHARED_MEMORY_INCLUDE_OPS_MPI_HPP_
+#define TASKS_MPI_SHARED_MEMORY_INCLUDE_OPS_MPI_HPP_
+
+#include <boost/mpi/communicator.hpp>
+#include <memory>
+
+#include "core/task/include/task.hpp"
+#include "mpi/hybrid/include/hybrid.hpp"
+#include "mpi/shared_memory/include/shared_memory.hpp"
+
+namespace nesterov_a_shared_memory_mpi {
+
+// Sum of the elements of a vector held by rank 0, as TestMPITaskParallel,
+// but the ranks of a node read their slices from a shared memory window
+// instead of receiving them, only node leaders exchange messages. The
+// constructor is collective: it groups the ranks by node.
+template <class InOutType>
+class VectorSumSharedMemory : public ppc::core::Task {
+ public:
+  explicit VectorSumSharedMemory(std::shared_ptr<ppc::core::TaskData> taskData_)
+      : Task(std::move(taskData_)), topology_(world) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  boost::mpi::communicator world;
+  ppc::mpi::NodeTopology topology_;
+  std::unique_ptr<ppc::mpi::NodeSharedInput<InOutType>> input_;
+  InOutType res_{};
+};
+
+extern template class VectorSumSharedMemory<int>;
+extern template class VectorSumSharedMemory<double>;
+
+}  // namespace nesterov_a_shared_memory_mpi
+
+#endif  // TASKS_MPI_SHARED_MEMORY_INCLUDE_OPS_MPI_HPP_
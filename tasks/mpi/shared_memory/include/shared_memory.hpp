@@ -0,0 +1,78 @@
+// Copyright 2024 Nesterov Alexander
+#ifndef TASKS_MPI_SHARED_MEMORY_INCLUDE_SHARED_MEMORY_HPP_
+#define TASKS_MPI_SHARED_MEMORY_INCLUDE_SHARED_MEMORY_HPP_
+
+#include <mpi.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "core/task/include/data_view.hpp"
+#include "mpi/hybrid/include/hybrid.hpp"
+
+namespace ppc::mpi {
+
+// Array of world rank 0 shared with the ranks of every node through an MPI-3
+// shared memory window (MPI_Win_allocate_shared on topology.node()). Every
+// node gets a balanced part of the array: rank 0 copies the part of its own
+// node into the window, the leaders of other nodes receive their parts from
+// it straight into their windows. The ranks of a node then read their
+// balanced slices of the node part in place, without messages of their own.
+// Rank 0 alone on its node reads the input itself, without a window.
+//   ppc::mpi::NodeSharedInput<int> input(world, topology, data, count);
+//   sum(input.view());
+//   input.assign(data, count);  // next input, the window is reused
+// The constructor, assign() and the destructor are collective, data and total
+// are read on world rank 0 only. topology must outlive the input, rank 0 must
+// keep data unchanged while views are in use.
+template <class T>
+class NodeSharedInput {
+ public:
+  NodeSharedInput(const boost::mpi::communicator &world, const NodeTopology &topology, const T *data,
+                  std::uint64_t total);
+  NodeSharedInput(const NodeSharedInput &) = delete;
+  NodeSharedInput &operator=(const NodeSharedInput &) = delete;
+  ~NodeSharedInput();
+
+  // distributes another array, views of the previous one become invalid
+  void assign(const T *data, std::uint64_t total);
+
+  [[nodiscard]] std::uint64_t total() const { return total_; }
+  // index of the first element of the slice in the whole array
+  [[nodiscard]] std::uint64_t first() const { return first_; }
+  [[nodiscard]] std::uint64_t count() const { return count_; }
+
+  // slice of the calling rank
+  [[nodiscard]] ppc::core::DataView<const T> view() const {
+    return {node_data_ + offset_, static_cast<std::size_t>(count_)};
+  }
+  // part of the node of the calling rank, shared by all of its ranks
+  [[nodiscard]] ppc::core::DataView<const T> node_view() const {
+    return {node_data_, static_cast<std::size_t>(node_count_)};
+  }
+
+ private:
+  std::uint64_t total_ = 0;
+  std::uint64_t first_ = 0;
+  std::uint64_t count_ = 0;
+  // offset of the slice inside of the node part
+  std::uint64_t offset_ = 0;
+  std::uint64_t node_count_ = 0;
+  const T *node_data_ = nullptr;
+  boost::mpi::communicator world_;
+  const NodeTopology &topology_;
+  MPI_Win window_ = MPI_WIN_NULL;
+  T *window_data_ = nullptr;
+  // part of a leader alone on its node
+  std::vector<T> storage_;
+  // elements of the window of the node
+  std::uint64_t capacity_ = 0;
+};
+
+extern template class NodeSharedInput<int>;
+extern template class NodeSharedInput<double>;
+
+}  // namespace ppc::mpi
+
+#endif  // TASKS_MPI_SHARED_MEMORY_INCLUDE_SHARED_MEMORY_HPP_
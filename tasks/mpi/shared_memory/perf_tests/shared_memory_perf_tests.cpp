@@ -0,0 +1,66 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/timer.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/util/include/util.hpp"
+#include "mpi/shared_memory/include/ops_mpi.hpp"
+
+namespace {
+
+// same input as mpi_example_perf_test, whose TestMPITaskParallel scatters the
+// slices with the isend/irecv blocks of ScatteredSlice: pipeline times divided
+// by the number of runs are directly comparable
+void run_perf(bool pipeline, uint64_t num_running) {
+  boost::mpi::communicator world;
+  std::vector<int> global_vec;
+  std::vector<int> global_sum(1, 0);
+  int count_size_vector = 0;
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    count_size_vector = static_cast<int>(ppc::util::get_perf_size(10000000));
+    global_vec = std::vector<int>(count_size_vector, 1);
+    taskDataPar->add_input(global_vec);
+    taskDataPar->add_output(global_sum);
+  }
+
+  auto task = std::make_shared<nesterov_a_shared_memory_mpi::VectorSumSharedMemory<int>>(taskDataPar);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = num_running;
+  perfAttr->input_size = global_vec.size();
+  perfAttr->num_threads = 1;
+  perfAttr->num_procs = world.size();
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  if (pipeline) {
+    perfAnalyzer->pipeline_run(perfAttr, perfResults);
+  } else {
+    perfAnalyzer->task_run(perfAttr, perfResults);
+  }
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    ASSERT_EQ(count_size_vector, global_sum[0]);
+  }
+}
+
+}  // namespace
+
+TEST(mpi_shared_memory_perf_test, test_pipeline_run) { run_perf(true, 50); }
+
+TEST(mpi_shared_memory_perf_test, test_task_run) {
+  // run only sums the slices already in the window
+  run_perf(false, 200);
+}
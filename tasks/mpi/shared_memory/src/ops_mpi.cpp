@@ -0,0 +1,58 @@
+// Copyright 2024 Nesterov Alexander
+#include "mpi/shared_memory/include/ops_mpi.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <numeric>
+
+template <class InOutType>
+bool nesterov_a_shared_memory_mpi::VectorSumSharedMemory<InOutType>::pre_processing() {
+  internal_order_test();
+  const InOutType *input = nullptr;
+  std::uint64_t count = 0;
+  if (world.rank() == 0) {
+    input = taskData->input_view<InOutType>(0).data();
+    count = taskData->input_buffer(0).count;
+  }
+  // the window of the previous run is reused
+  if (input_) {
+    input_->assign(input, count);
+  } else {
+    input_ = std::make_unique<ppc::mpi::NodeSharedInput<InOutType>>(world, topology_, input, count);
+  }
+  res_ = InOutType{};
+  return true;
+}
+
+template <class InOutType>
+bool nesterov_a_shared_memory_mpi::VectorSumSharedMemory<InOutType>::validation() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    return taskData->inputs_count.size() == 1 && taskData->outputs_count.size() == 1 &&
+           taskData->outputs_count[0] == 1;
+  }
+  return true;
+}
+
+template <class InOutType>
+bool nesterov_a_shared_memory_mpi::VectorSumSharedMemory<InOutType>::run() {
+  internal_order_test();
+  auto slice = input_->view();
+  const InOutType local = std::accumulate(slice.begin(), slice.end(), InOutType{});
+  ppc::core::CommunicationTimes times;
+  res_ = ppc::mpi::hierarchical_reduce(topology_, local, std::plus<InOutType>(), times);
+  add_communication_time(times.intra_node, times.inter_node);
+  return true;
+}
+
+template <class InOutType>
+bool nesterov_a_shared_memory_mpi::VectorSumSharedMemory<InOutType>::post_processing() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    reinterpret_cast<InOutType *>(taskData->outputs[0])[0] = res_;
+  }
+  return true;
+}
+
+template class nesterov_a_shared_memory_mpi::VectorSumSharedMemory<int>;
+template class nesterov_a_shared_memory_mpi::VectorSumSharedMemory<double>;
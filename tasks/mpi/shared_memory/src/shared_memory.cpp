@@ -0,0 +1,117 @@
+// Copyright 2024 Nesterov Alexander
+#include "mpi/shared_memory/include/shared_memory.hpp"
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/nonblocking.hpp>
+#include <boost/mpi/request.hpp>
+#include <limits>
+#include <vector>
+
+#include "mpi/distribution/include/distribution.hpp"
+
+namespace {
+
+constexpr int node_part_tag = 0x5D;
+
+// calls post(begin, size) for pieces of count elements, messages stay below INT_MAX elements
+template <class Post>
+void for_each_message(std::uint64_t count, Post post) {
+  constexpr std::uint64_t max_message = std::numeric_limits<int>::max();
+  for (std::uint64_t begin = 0; begin < count; begin += max_message) {
+    post(begin, static_cast<int>(std::min(max_message, count - begin)));
+  }
+}
+
+}  // namespace
+
+template <class T>
+ppc::mpi::NodeSharedInput<T>::NodeSharedInput(const boost::mpi::communicator &world, const NodeTopology &topology,
+                                              const T *data, std::uint64_t total)
+    : world_(world), topology_(topology) {
+  assign(data, total);
+}
+
+template <class T>
+ppc::mpi::NodeSharedInput<T>::~NodeSharedInput() {
+  if (window_ == MPI_WIN_NULL) return;
+  MPI_Win_unlock_all(window_);
+  MPI_Win_free(&window_);
+}
+
+template <class T>
+void ppc::mpi::NodeSharedInput<T>::assign(const T *data, std::uint64_t total) {
+  total_ = total;
+  broadcast(world_, total_, 0);
+  const auto &node = topology_.node();
+  const auto nodes = Partition::balanced(total_, topology_.node_count());
+  const auto node_index = static_cast<std::size_t>(topology_.node_index());
+  node_count_ = nodes.counts[node_index];
+  const auto ranks = Partition::balanced(node_count_, node.size());
+  const auto node_rank = static_cast<std::size_t>(node.rank());
+  offset_ = ranks.displs[node_rank];
+  count_ = ranks.counts[node_rank];
+  first_ = nodes.displs[node_index] + offset_;
+
+  const bool alone = node.size() == 1;
+  if (window_ != MPI_WIN_NULL) {
+    // the ranks of the node are done with the previous array
+    MPI_Win_sync(window_);
+    node.barrier();
+  }
+  if (!alone && (window_ == MPI_WIN_NULL || node_count_ > capacity_)) {
+    if (window_ != MPI_WIN_NULL) {
+      MPI_Win_unlock_all(window_);
+      MPI_Win_free(&window_);
+    }
+    // the leader allocates the memory of the node, the other ranks map it
+    const auto bytes = static_cast<MPI_Aint>(topology_.is_leader() ? node_count_ * sizeof(T) : 0);
+    MPI_Win_allocate_shared(bytes, sizeof(T), MPI_INFO_NULL, node, &window_data_, &window_);
+    if (!topology_.is_leader()) {
+      MPI_Aint size = 0;
+      int disp_unit = 0;
+      MPI_Win_shared_query(window_, 0, &size, &disp_unit, &window_data_);
+    }
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, window_);
+    capacity_ = node_count_;
+  }
+
+  if (topology_.is_leader()) {
+    // world rank 0 is the first leader
+    const auto &leaders = topology_.leaders();
+    // alone on its node, rank 0 reads data itself and other leaders receive into storage_
+    T *part = window_data_;
+    if (alone) {
+      storage_.resize(leaders.rank() == 0 ? 0 : node_count_);
+      part = leaders.rank() == 0 ? nullptr : storage_.data();
+    }
+    std::vector<boost::mpi::request> requests;
+    if (leaders.rank() == 0) {
+      for (int proc = 1; proc < leaders.size(); proc++) {
+        const T *source = data + nodes.displs[proc];
+        for_each_message(nodes.counts[proc], [&](std::uint64_t begin, int size) {
+          requests.push_back(leaders.isend(proc, node_part_tag, source + begin, size));
+        });
+      }
+      // copied while the parts of other nodes are in flight
+      if (part != nullptr) std::copy_n(data, node_count_, part);
+    } else {
+      for_each_message(node_count_, [&](std::uint64_t begin, int size) {
+        requests.push_back(leaders.irecv(0, node_part_tag, part + begin, size));
+      });
+    }
+    boost::mpi::wait_all(requests.begin(), requests.end());
+    node_data_ = part != nullptr ? part : data;
+  } else {
+    node_data_ = window_data_;
+  }
+  if (!alone) {
+    // stores of the leader become visible to the other ranks of the node
+    MPI_Win_sync(window_);
+    node.barrier();
+    MPI_Win_sync(window_);
+  }
+}
+
+template class ppc::mpi::NodeSharedInput<int>;
+template class ppc::mpi::NodeSharedInput<double>;
@@ -0,0 +1,34 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+
+#include "core/sparse/func_tests/sparse_task_tests.hpp"
+#include "mpi/sparse_matrix/include/ops_mpi.hpp"
+
+namespace {
+
+using RowSums = nesterov_a_sparse_matrix_mpi::SparseRowSumsMPI;
+using Product = nesterov_a_sparse_matrix_mpi::SparseMatrixVectorProductMPI;
+
+}  // namespace
+
+// inputs are given on rank 0 only, the results are checked there
+
+TEST(mpi_sparse_matrix, results_match_reference) {
+  boost::mpi::communicator world;
+  // fewer lines than processes in the first shapes
+  const ppc::test::sparse::Shapes shapes = {{1, 1}, {2, 300}, {300, 2}, {37, 38}, {400, 250}};
+  ppc::test::sparse::check_results_match_reference<RowSums, Product>(shapes, world.rank() == 0);
+}
+
+TEST(mpi_sparse_matrix, empty_rows_and_columns) {
+  boost::mpi::communicator world;
+  ppc::test::sparse::check_empty_rows_and_columns<RowSums>(world.rank() == 0);
+}
+
+TEST(mpi_sparse_matrix, validation) {
+  boost::mpi::communicator world;
+  // product needs the vector, other ranks get their inputs from rank 0
+  ppc::test::sparse::check_validation<Product>(world.rank() == 0);
+}
@@ -0,0 +1,49 @@
+// Copyright 2024 Nesterov Alexander
+#ifndef TASKS_MPI_SPARSE_MATRIX_INCLUDE_OPS_MPI_HPP_
+#define TASKS_MPI_SPARSE_MATRIX_INCLUDE_OPS_MPI_HPP_
+
+#include <boost/mpi/communicator.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+#include "core/task/include/task.hpp"
+
+namespace nesterov_a_sparse_matrix_mpi {
+
+// Row sums or y = A x of a double CSR or CSC matrix with uint64_t indices.
+// Inputs are needed on rank 0 only, as for the reference tasks SparseRowSums
+// and SparseMatrixVectorProduct. Rank 0 sends every process a range of lines
+// with a balanced count of nonzeros: CSR processes compute their rows of y,
+// which are gathered, CSC processes compute partial y of their columns,
+// which are summed by a reduction.
+template <bool WithVector>
+class SparseProductMPI : public ppc::core::Task {
+ public:
+  explicit SparseProductMPI(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  // local lines of the matrix, offsets start from zero
+  ppc::core::SparseMatrix<double, uint64_t> local_;
+  std::vector<double> local_x_;
+  std::vector<double> local_res_;
+  std::vector<double> res_;
+  // first line of every process, lines of the last process end at line_begin_.back()
+  std::vector<uint64_t> line_begin_;
+  boost::mpi::communicator world;
+};
+
+using SparseRowSumsMPI = SparseProductMPI<false>;
+using SparseMatrixVectorProductMPI = SparseProductMPI<true>;
+
+extern template class SparseProductMPI<false>;
+extern template class SparseProductMPI<true>;
+
+}  // namespace nesterov_a_sparse_matrix_mpi
+
+#endif  // TASKS_MPI_SPARSE_MATRIX_INCLUDE_OPS_MPI_HPP_
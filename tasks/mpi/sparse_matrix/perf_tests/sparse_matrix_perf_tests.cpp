@@ -0,0 +1,97 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/timer.hpp>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/util/include/util.hpp"
+#include "mpi/sparse_matrix/include/ops_mpi.hpp"
+
+namespace {
+
+// n x n matrix of ones, line l holds per_line of them at scattered positions
+// (l + k * 7919) % n, so every row and every column has per_line nonzeros
+ppc::core::SparseMatrix<double, uint64_t> circulant(std::size_t n, std::size_t per_line,
+                                                    ppc::core::SparseFormat format) {
+  ppc::core::SparseMatrix<double, uint64_t> matrix;
+  matrix.format = format;
+  matrix.rows = n;
+  matrix.cols = n;
+  matrix.values.assign(n * per_line, 1.0);
+  matrix.indices.resize(n * per_line);
+  std::vector<uint64_t> offsets(n + 1);
+  for (std::size_t line = 0; line < n; line++) {
+    for (std::size_t k = 0; k < per_line; k++) matrix.indices[line * per_line + k] = (line + k * 7919) % n;
+    offsets[line + 1] = (line + 1) * per_line;
+  }
+  matrix.offsets = std::move(offsets);
+  return matrix;
+}
+
+template <class Task>
+void run_perf(ppc::core::SparseFormat format, bool with_vector, bool pipeline) {
+  boost::mpi::communicator world;
+  const std::size_t per_line = 10;
+  const std::size_t n = ppc::util::get_perf_size(10000000) / per_line;
+  ppc::core::SparseMatrix<double, uint64_t> matrix;
+  std::vector<uint64_t> shape;
+  std::vector<double> x(n, 1.0);
+  std::vector<double> out(n, 0.0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    matrix = circulant(n, per_line, format);
+    shape = matrix.shape();
+    taskDataPar->add_input(matrix.values);
+    taskDataPar->add_input(matrix.indices);
+    taskDataPar->add_input(matrix.offsets);
+    taskDataPar->add_input(shape);
+    if (with_vector) taskDataPar->add_input(x);
+    taskDataPar->add_output(out);
+  }
+
+  auto task = std::make_shared<Task>(taskDataPar);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  perfAttr->input_size = n * per_line;
+  perfAttr->num_threads = 1;
+  perfAttr->num_procs = world.size();
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  if (pipeline) {
+    perfAnalyzer->pipeline_run(perfAttr, perfResults);
+  } else {
+    perfAnalyzer->task_run(perfAttr, perfResults);
+  }
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    for (double value : out) {
+      ASSERT_EQ(value, static_cast<double>(per_line));
+    }
+  }
+}
+
+}  // namespace
+
+TEST(mpi_sparse_matrix_perf_test, test_pipeline_run) {
+  // rows with balanced nonzeros go to processes, x is broadcast
+  run_perf<nesterov_a_sparse_matrix_mpi::SparseMatrixVectorProductMPI>(ppc::core::SparseFormat::CSR, true, true);
+}
+
+TEST(mpi_sparse_matrix_perf_test, test_task_run) {
+  // columns go to processes, partial sums are reduced on rank 0
+  run_perf<nesterov_a_sparse_matrix_mpi::SparseRowSumsMPI>(ppc::core::SparseFormat::CSC, false, false);
+}
@@ -0,0 +1,140 @@
+// Copyright 2024 Nesterov Alexander
+#include "mpi/sparse_matrix/include/ops_mpi.hpp"
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <functional>
+
+namespace {
+
+enum Tag { OFFSETS, INDICES, VALUES, VECTOR, RESULT };
+
+}  // namespace
+
+template <bool WithVector>
+bool nesterov_a_sparse_matrix_mpi::SparseProductMPI<WithVector>::pre_processing() {
+  internal_order_test();
+  const auto procs = static_cast<std::size_t>(world.size());
+  const auto rank = static_cast<std::size_t>(world.rank());
+  ppc::core::SparseMatrixView<double, uint64_t> matrix;
+  std::vector<uint64_t> shape(3);
+  line_begin_.resize(procs + 1);
+  if (world.rank() == 0) {
+    // Init view of input data
+    matrix = ppc::core::sparse_input<double, uint64_t>(*taskData);
+    shape = {matrix.rows, matrix.cols, static_cast<uint64_t>(matrix.format)};
+    for (std::size_t proc = 0; proc < procs; proc++) {
+      line_begin_[proc] = ppc::core::nnz_balanced_chunk(matrix.offsets, matrix.lines(), procs, proc).first;
+    }
+    line_begin_[procs] = matrix.lines();
+  }
+  broadcast(world, shape.data(), static_cast<int>(shape.size()), 0);
+  broadcast(world, line_begin_.data(), static_cast<int>(line_begin_.size()), 0);
+
+  const bool csr = static_cast<ppc::core::SparseFormat>(shape[2]) == ppc::core::SparseFormat::CSR;
+  const std::size_t lines = line_begin_[rank + 1] - line_begin_[rank];
+  local_ = {};
+  local_.format = static_cast<ppc::core::SparseFormat>(shape[2]);
+  local_.rows = csr ? lines : shape[0];
+  local_.cols = csr ? shape[1] : lines;
+  local_.offsets.resize(lines + 1);
+
+  if (world.rank() == 0) {
+    std::vector<uint64_t> offsets;
+    for (std::size_t proc = 0; proc < procs; proc++) {
+      const std::size_t first = line_begin_[proc];
+      const std::size_t last = line_begin_[proc + 1];
+      const std::size_t begin = matrix.line_begin(first);
+      const std::size_t nnz = matrix.line_begin(last) - begin;
+      offsets.resize(last - first + 1);
+      for (std::size_t line = first; line <= last; line++) offsets[line - first] = matrix.offsets[line] - begin;
+      if (proc == 0) {
+        local_.offsets = offsets;
+        local_.indices.assign(matrix.indices + begin, matrix.indices + begin + nnz);
+        local_.values.assign(matrix.values + begin, matrix.values + begin + nnz);
+        continue;
+      }
+      const int dest = static_cast<int>(proc);
+      world.send(dest, OFFSETS, offsets.data(), static_cast<int>(offsets.size()));
+      world.send(dest, INDICES, matrix.indices + begin, static_cast<int>(nnz));
+      world.send(dest, VALUES, matrix.values + begin, static_cast<int>(nnz));
+    }
+  } else {
+    world.recv(0, OFFSETS, local_.offsets.data(), static_cast<int>(local_.offsets.size()));
+    const auto nnz = static_cast<std::size_t>(local_.offsets.back());
+    local_.indices.resize(nnz);
+    local_.values.resize(nnz);
+    world.recv(0, INDICES, local_.indices.data(), static_cast<int>(nnz));
+    world.recv(0, VALUES, local_.values.data(), static_cast<int>(nnz));
+  }
+
+  if (WithVector) {
+    // rows need the whole x, columns need only their own elements
+    const double *x = world.rank() == 0 ? taskData->input_view<double>(4).data() : nullptr;
+    if (csr) {
+      local_x_.resize(shape[1]);
+      if (world.rank() == 0) std::copy(x, x + shape[1], local_x_.begin());
+      broadcast(world, local_x_.data(), static_cast<int>(local_x_.size()), 0);
+    } else if (world.rank() == 0) {
+      for (std::size_t proc = 1; proc < procs; proc++) {
+        world.send(static_cast<int>(proc), VECTOR, x + line_begin_[proc],
+                   static_cast<int>(line_begin_[proc + 1] - line_begin_[proc]));
+      }
+      local_x_.assign(x, x + lines);
+    } else {
+      local_x_.resize(lines);
+      world.recv(0, VECTOR, local_x_.data(), static_cast<int>(lines));
+    }
+  }
+
+  local_res_ = std::vector<double>(local_.rows);
+  res_ = std::vector<double>(world.rank() == 0 ? shape[0] : 0);
+  return true;
+}
+
+template <bool WithVector>
+bool nesterov_a_sparse_matrix_mpi::SparseProductMPI<WithVector>::validation() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    return ppc::core::check_sparse_task<uint64_t>(*taskData, WithVector);
+  }
+  return true;
+}
+
+template <bool WithVector>
+bool nesterov_a_sparse_matrix_mpi::SparseProductMPI<WithVector>::run() {
+  internal_order_test();
+  ppc::core::sparse_product(local_.view(), WithVector ? local_x_.data() : nullptr, local_res_.data());
+
+  if (local_.format == ppc::core::SparseFormat::CSC) {
+    const auto count = static_cast<int>(local_res_.size());
+    if (world.rank() == 0) {
+      reduce(world, local_res_.data(), count, res_.data(), std::plus<double>(), 0);
+    } else {
+      reduce(world, local_res_.data(), count, std::plus<double>(), 0);
+    }
+    return true;
+  }
+  if (world.rank() == 0) {
+    std::copy(local_res_.begin(), local_res_.end(), res_.begin());
+    for (int proc = 1; proc < world.size(); proc++) {
+      const auto first = line_begin_[proc];
+      world.recv(proc, RESULT, res_.data() + first, static_cast<int>(line_begin_[proc + 1] - first));
+    }
+  } else {
+    world.send(0, RESULT, local_res_.data(), static_cast<int>(local_res_.size()));
+  }
+  return true;
+}
+
+template <bool WithVector>
+bool nesterov_a_sparse_matrix_mpi::SparseProductMPI<WithVector>::post_processing() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    std::copy(res_.begin(), res_.end(), reinterpret_cast<double *>(taskData->outputs[0]));
+  }
+  return true;
+}
+
+template class nesterov_a_sparse_matrix_mpi::SparseProductMPI<false>;
+template class nesterov_a_sparse_matrix_mpi::SparseProductMPI<true>;
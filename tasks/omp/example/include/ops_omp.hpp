@@ -20,7 +20,7 @@ class TestOMPTaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_;
+  ppc::core::DataView<const int> input_;
   int res{};
   std::string ops;
 };
@@ -35,7 +35,7 @@ class TestOMPTaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_;
+  ppc::core::DataView<const int> input_;
   int res{};
   std::string ops;
 };
@@ -5,13 +5,14 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/util/include/util.hpp"
 #include "omp/example/include/ops_omp.hpp"
 
 TEST(openmp_example_perf_test, test_pipeline_run) {
-  const int count = 100;
+  const int count = static_cast<int>(ppc::util::get_perf_size(10000000));
 
   // Create data
-  std::vector<int> in(1, count);
+  std::vector<int> in(count, 1);
   std::vector<int> out(1, 0);
 
   // Create TaskData
@@ -22,11 +23,13 @@ TEST(openmp_example_perf_test, test_pipeline_run) {
   taskDataSeq->outputs_count.emplace_back(out.size());
 
   // Create Task
-  auto testTaskOMP = std::make_shared<nesterov_a_test_task_omp::TestOMPTaskSequential>(taskDataSeq, "+");
+  auto testTaskOMP = std::make_shared<nesterov_a_test_task_omp::TestOMPTaskParallel>(taskDataSeq, "+");
 
   // Create Perf attributes
   auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
-  perfAttr->num_running = 10;
+  perfAttr->num_running = 100;
+  perfAttr->input_size = in.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
   perfAttr->current_timer = [&] { return omp_get_wtime(); };
 
   // Create and init perf results
@@ -40,10 +43,10 @@ TEST(openmp_example_perf_test, test_pipeline_run) {
 }
 
 TEST(openmp_example_perf_test, test_task_run) {
-  const int count = 100;
+  const int count = static_cast<int>(ppc::util::get_perf_size(10000000));
 
   // Create data
-  std::vector<int> in(1, count);
+  std::vector<int> in(count, 1);
   std::vector<int> out(1, 0);
 
   // Create TaskData
@@ -54,11 +57,13 @@ TEST(openmp_example_perf_test, test_task_run) {
   taskDataSeq->outputs_count.emplace_back(out.size());
 
   // Create Task
-  auto testTaskOMP = std::make_shared<nesterov_a_test_task_omp::TestOMPTaskSequential>(taskDataSeq, "+");
+  auto testTaskOMP = std::make_shared<nesterov_a_test_task_omp::TestOMPTaskParallel>(taskDataSeq, "+");
 
   // Create Perf attributes
   auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
-  perfAttr->num_running = 10;
+  perfAttr->num_running = 100;
+  perfAttr->input_size = in.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
   perfAttr->current_timer = [&] { return omp_get_wtime(); };
 
   // Create and init perf results
@@ -4,32 +4,25 @@
 #include <omp.h>
 
 #include <iostream>
+#include <mutex>
 #include <numeric>
-#include <random>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "core/random/include/random.hpp"
+#include "core/util/include/util.hpp"
+
 using namespace std::chrono_literals;
 
 std::vector<int> nesterov_a_test_task_omp::getRandomVector(int sz) {
-  std::random_device dev;
-  std::mt19937 gen(dev());
-  std::vector<int> vec(sz);
-  for (int i = 0; i < sz; i++) {
-    vec[i] = gen() % 100 + 1;
-  }
-  return vec;
+  return ppc::core::random_vector<int>(sz, {1, 100});
 }
 
 bool nesterov_a_test_task_omp::TestOMPTaskSequential::pre_processing() {
   internal_order_test();
-  // Init vectors
-  input_ = std::vector<int>(taskData->inputs_count[0]);
-  auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-  for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-    input_[i] = tmp_ptr[i];
-  }
+  // Init view of input data
+  input_ = taskData->input_view<int>(0);
   // Init value for output
   res = 1;
   return true;
@@ -62,12 +55,8 @@ bool nesterov_a_test_task_omp::TestOMPTaskSequential::post_processing() {
 
 bool nesterov_a_test_task_omp::TestOMPTaskParallel::pre_processing() {
   internal_order_test();
-  // Init vectors
-  input_ = std::vector<int>(taskData->inputs_count[0]);
-  auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-  for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-    input_[i] = tmp_ptr[i];
-  }
+  // Init view of input data
+  input_ = taskData->input_view<int>(0);
   // Init value for output
   res = 1;
   return true;
@@ -82,26 +71,29 @@ bool nesterov_a_test_task_omp::TestOMPTaskParallel::validation() {
 bool nesterov_a_test_task_omp::TestOMPTaskParallel::run() {
   internal_order_test();
   double start = omp_get_wtime();
+  const int num_threads = ppc::util::get_num_threads();
   auto temp_res = res;
   if (ops == "+") {
-#pragma omp parallel for reduction(+ : temp_res)
+#pragma omp parallel for num_threads(num_threads) reduction(+ : temp_res)
     for (int i = 0; i < static_cast<int>(input_.size()); i++) {
       temp_res += input_[i];
     }
   } else if (ops == "-") {
-#pragma omp parallel for reduction(- : temp_res)
+#pragma omp parallel for num_threads(num_threads) reduction(- : temp_res)
     for (int i = 0; i < static_cast<int>(input_.size()); i++) {
       temp_res -= input_[i];
     }
   } else if (ops == "*") {
-#pragma omp parallel for reduction(* : temp_res)
+#pragma omp parallel for num_threads(num_threads) reduction(* : temp_res)
     for (int i = 0; i < static_cast<int>(input_.size()); i++) {
       temp_res *= input_[i];
     }
   }
   res = temp_res;
   double finish = omp_get_wtime();
-  std::cout << "How measure time in OpenMP: " << finish - start << std::endl;
+  // perf tests call run() hundreds of times, the example of timing is printed once
+  static std::once_flag printed;
+  std::call_once(printed, [&] { std::cout << "How measure time in OpenMP: " << finish - start << std::endl; });
   return true;
 }
 
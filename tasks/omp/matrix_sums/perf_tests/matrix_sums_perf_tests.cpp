@@ -0,0 +1,87 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+#include <omp.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/util/include/util.hpp"
+#include "omp/matrix_sums/include/ops_omp.hpp"
+
+TEST(omp_matrix_sums_perf_test, test_pipeline_run) {
+  // rows of 1000 elements
+  const uint64_t cols = 1000;
+  const uint64_t rows = ppc::util::get_perf_size(10000000) / cols;
+
+  // Create data
+  std::vector<double> in(rows * cols, 1.0);
+  std::vector<uint64_t> in_index = {rows, cols};
+  std::vector<double> out(rows, 0.0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_input(in_index);
+  taskData->add_output(out);
+
+  // Create Task
+  auto task = std::make_shared<nesterov_a_matrix_sums_omp::SumValuesByRowsMatrixOMP>(taskData);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 100;
+  perfAttr->input_size = in.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
+  perfAttr->current_timer = [&] { return omp_get_wtime(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  perfAnalyzer->pipeline_run(perfAttr, perfResults);
+  ppc::core::Perf::print_perf_statistic(perfResults);
+  for (double sum : out) {
+    ASSERT_EQ(sum, static_cast<double>(cols));
+  }
+}
+
+TEST(omp_matrix_sums_perf_test, test_task_run) {
+  // column sums accumulated by blocks of contiguous rows
+  const uint64_t cols = 1000;
+  const uint64_t rows = ppc::util::get_perf_size(10000000) / cols;
+
+  // Create data
+  std::vector<double> in(rows * cols, 1.0);
+  std::vector<uint64_t> in_index = {rows, cols};
+  std::vector<double> out(cols, 0.0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_input(in_index);
+  taskData->add_output(out);
+
+  // Create Task
+  auto task = std::make_shared<nesterov_a_matrix_sums_omp::SumValuesByColsMatrixOMP>(taskData);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 100;
+  perfAttr->input_size = in.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
+  perfAttr->current_timer = [&] { return omp_get_wtime(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  perfAnalyzer->task_run(perfAttr, perfResults);
+  ppc::core::Perf::print_perf_statistic(perfResults);
+  for (double sum : out) {
+    ASSERT_EQ(sum, static_cast<double>(rows));
+  }
+}
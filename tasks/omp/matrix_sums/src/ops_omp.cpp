@@ -0,0 +1,47 @@
+// Copyright 2024 Nesterov Alexander
+#include "omp/matrix_sums/include/ops_omp.hpp"
+
+#include <omp.h>
+
+#include <algorithm>
+
+#include "core/util/include/util.hpp"
+
+template <ppc::core::MatrixAxis Axis>
+bool nesterov_a_matrix_sums_omp::MatrixSumsOMP<Axis>::pre_processing() {
+  internal_order_test();
+  // Init view of input data
+  matrix_ = ppc::core::matrix_input<double, uint64_t>(*taskData);
+  sum_ = std::vector<double>(Axis == ppc::core::MatrixAxis::ROWS ? matrix_.rows : matrix_.cols);
+  return true;
+}
+
+template <ppc::core::MatrixAxis Axis>
+bool nesterov_a_matrix_sums_omp::MatrixSumsOMP<Axis>::validation() {
+  internal_order_test();
+  return ppc::core::check_matrix_task<uint64_t>(*taskData, Axis);
+}
+
+template <ppc::core::MatrixAxis Axis>
+bool nesterov_a_matrix_sums_omp::MatrixSumsOMP<Axis>::run() {
+  internal_order_test();
+  const int num_threads = ppc::util::get_num_threads();
+  ppc::core::MatrixSums<double> sums(matrix_, Axis, static_cast<std::size_t>(num_threads), &scratch());
+  const auto parts = static_cast<int>(sums.parts());
+#pragma omp parallel for num_threads(num_threads) schedule(static, 1)
+  for (int part = 0; part < parts; part++) {
+    sums.run(static_cast<std::size_t>(part), sum_.data());
+  }
+  sums.finish(sum_.data());
+  return true;
+}
+
+template <ppc::core::MatrixAxis Axis>
+bool nesterov_a_matrix_sums_omp::MatrixSumsOMP<Axis>::post_processing() {
+  internal_order_test();
+  std::copy(sum_.begin(), sum_.end(), reinterpret_cast<double *>(taskData->outputs[0]));
+  return true;
+}
+
+template class nesterov_a_matrix_sums_omp::MatrixSumsOMP<ppc::core::MatrixAxis::ROWS>;
+template class nesterov_a_matrix_sums_omp::MatrixSumsOMP<ppc::core::MatrixAxis::COLS>;
@@ -0,0 +1,48 @@
+// Copyright 2024 Nesterov Alexander
+#ifndef TASKS_OMP_NEIGHBOR_SCAN_INCLUDE_OPS_OMP_HPP_
+#define TASKS_OMP_NEIGHBOR_SCAN_INCLUDE_OPS_OMP_HPP_
+
+#include <cstdint>
+#include <memory>
+
+#include "core/neighbor_scan/include/neighbor_scan.hpp"
+#include "core/numa/include/numa_buffer.hpp"
+#include "core/task/include/task.hpp"
+
+namespace nesterov_a_neighbor_scan_omp {
+
+// Adjacent pairs of an int vector split into chunks between threads, chunks
+// share only their boundary element. Outputs match the reference tasks.
+// With FIRST_TOUCH placement every thread copies its chunk of the input in
+// pre_processing(), so run() reads node-local memory.
+template <class Kernel>
+class NeighborScanOMP : public ppc::core::Task {
+ public:
+  explicit NeighborScanOMP(std::shared_ptr<ppc::core::TaskData> taskData_,
+                           ppc::core::InputPlacement placement = ppc::core::input_placement())
+      : Task(std::move(taskData_)), placement_(placement) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  ppc::core::InputPlacement placement_;
+  ppc::core::NumaBuffer<int> local_input_;
+  ppc::core::DataView<const int> input_;
+  typename Kernel::Result res_{};
+};
+
+using NearestNeighborElementsOMP = NeighborScanOMP<ppc::core::NearestPair<int, uint64_t>>;
+using MostDifferentNeighborElementsOMP = NeighborScanOMP<ppc::core::MostDifferentPair<int, uint64_t>>;
+using NumOfOrderlyViolationsOMP = NeighborScanOMP<ppc::core::OrderViolationCount<int, uint64_t>>;
+using NumOfAlternationsSignsOMP = NeighborScanOMP<ppc::core::SignAlternationCount<int, uint64_t>>;
+
+extern template class NeighborScanOMP<ppc::core::NearestPair<int, uint64_t>>;
+extern template class NeighborScanOMP<ppc::core::MostDifferentPair<int, uint64_t>>;
+extern template class NeighborScanOMP<ppc::core::OrderViolationCount<int, uint64_t>>;
+extern template class NeighborScanOMP<ppc::core::SignAlternationCount<int, uint64_t>>;
+
+}  // namespace nesterov_a_neighbor_scan_omp
+
+#endif  // TASKS_OMP_NEIGHBOR_SCAN_INCLUDE_OPS_OMP_HPP_
@@ -0,0 +1,132 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+#include <omp.h>
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/util/include/util.hpp"
+#include "omp/neighbor_scan/include/ops_omp.hpp"
+
+TEST(omp_neighbor_scan_perf_test, test_pipeline_run) {
+  const int count = static_cast<int>(ppc::util::get_perf_size(10000000));
+
+  // Create data
+  std::vector<int> in(count);
+  for (int i = 0; i < count; i++) in[i] = i % 2 == 0 ? i : -i;
+  std::vector<uint64_t> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_output(out);
+
+  // Create Task
+  auto task = std::make_shared<nesterov_a_neighbor_scan_omp::NumOfAlternationsSignsOMP>(taskData);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 100;
+  perfAttr->input_size = in.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
+  perfAttr->current_timer = [&] { return omp_get_wtime(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  perfAnalyzer->pipeline_run(perfAttr, perfResults);
+  ppc::core::Perf::print_perf_statistic(perfResults);
+  // zero at the first element has no sign
+  ASSERT_EQ(out[0], static_cast<uint64_t>(count - 2));
+}
+
+TEST(omp_neighbor_scan_perf_test, test_task_run) {
+  const int count = static_cast<int>(ppc::util::get_perf_size(10000000));
+
+  // Create data
+  std::vector<int> in(count);
+  for (int i = 0; i < count; i++) in[i] = i % 2 == 0 ? i : -i;
+  std::vector<uint64_t> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_output(out);
+
+  // Create Task
+  auto task = std::make_shared<nesterov_a_neighbor_scan_omp::NumOfAlternationsSignsOMP>(taskData);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 100;
+  perfAttr->input_size = in.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
+  perfAttr->current_timer = [&] { return omp_get_wtime(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  perfAnalyzer->task_run(perfAttr, perfResults);
+  ppc::core::Perf::print_perf_statistic(perfResults);
+  // zero at the first element has no sign
+  ASSERT_EQ(out[0], static_cast<uint64_t>(count - 2));
+}
+
+namespace {
+
+// run() of the scan over an input touched by the main thread or by the scanning threads,
+// on machines with several NUMA nodes the difference is the cost of remote reads
+void run_with_placement(ppc::core::InputPlacement placement) {
+  const int count = static_cast<int>(ppc::util::get_perf_size(10000000));
+
+  // Create data, pages of in are placed on the node of the main thread
+  std::vector<int> in(count);
+  for (int i = 0; i < count; i++) in[i] = i % 2 == 0 ? i : -i;
+  std::vector<uint64_t> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_output(out);
+
+  // Create Task
+  auto task = std::make_shared<nesterov_a_neighbor_scan_omp::NumOfAlternationsSignsOMP>(taskData, placement);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 100;
+  perfAttr->input_size = in.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
+  perfAttr->current_timer = [&] { return omp_get_wtime(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  perfAnalyzer->task_run(perfAttr, perfResults);
+  ppc::core::Perf::print_perf_statistic(perfResults);
+  // time_sec covers num_running runs
+  const auto bytes = static_cast<double>(in.size() * sizeof(int) * perfAttr->num_running);
+  const char *placement_name = placement == ppc::core::InputPlacement::FIRST_TOUCH ? "first_touch" : "in_place";
+  std::cout << "placement=" << placement_name << " numa_nodes=" << ppc::core::NumaTopology::system().nodes.size()
+            << " input_gb_per_sec=" << bytes / perfResults->time_sec / 1e9 << std::endl;
+  ASSERT_EQ(out[0], static_cast<uint64_t>(count - 2));
+}
+
+}  // namespace
+
+TEST(omp_neighbor_scan_perf_test, test_task_run_in_place_input) {
+  run_with_placement(ppc::core::InputPlacement::IN_PLACE);
+}
+
+TEST(omp_neighbor_scan_perf_test, test_task_run_first_touch_input) {
+  run_with_placement(ppc::core::InputPlacement::FIRST_TOUCH);
+}
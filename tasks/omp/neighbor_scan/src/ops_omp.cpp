@@ -0,0 +1,64 @@
+// Copyright 2024 Nesterov Alexander
+#include "omp/neighbor_scan/include/ops_omp.hpp"
+
+#include <omp.h>
+
+#include "core/thread_pool/include/parallel_reduce.hpp"
+#include "core/util/include/util.hpp"
+
+template <class Kernel>
+bool nesterov_a_neighbor_scan_omp::NeighborScanOMP<Kernel>::pre_processing() {
+  internal_order_test();
+  // Init view of input data
+  input_ = taskData->input_view<int>(0);
+  if (placement_ == ppc::core::InputPlacement::FIRST_TOUCH) {
+    local_input_.allocate(input_.size());
+#pragma omp parallel num_threads(ppc::util::get_num_threads())
+    {
+      const int index = omp_get_thread_num();
+      ppc::core::bind_thread(index, omp_get_num_threads());
+      local_input_.fill_part(input_.data(), static_cast<std::size_t>(omp_get_num_threads()),
+                             static_cast<std::size_t>(index));
+    }
+    input_ = local_input_.view();
+  }
+  res_ = Kernel::identity();
+  return true;
+}
+
+template <class Kernel>
+bool nesterov_a_neighbor_scan_omp::NeighborScanOMP<Kernel>::validation() {
+  internal_order_test();
+  return Kernel::check(*taskData);
+}
+
+template <class Kernel>
+bool nesterov_a_neighbor_scan_omp::NeighborScanOMP<Kernel>::run() {
+  internal_order_test();
+  const std::size_t pairs = input_.size() - 1;
+  const int num_threads = ppc::util::get_num_threads();
+  auto partials = scratch().allocate_array<ppc::core::PaddedValue<typename Kernel::Result>>(
+      static_cast<std::size_t>(num_threads), {Kernel::identity()});
+#pragma omp parallel num_threads(num_threads)
+  {
+    const auto parts = static_cast<std::size_t>(omp_get_num_threads());
+    const auto index = static_cast<std::size_t>(omp_get_thread_num());
+    ppc::core::bind_thread(omp_get_thread_num(), omp_get_num_threads());
+    auto [begin, end] = ppc::core::balanced_chunk(0, pairs, parts, index);
+    partials[index].value = Kernel::scan(input_.data(), begin, end);
+  }
+  res_ = ppc::core::tree_combine(partials, Kernel::combine);
+  return true;
+}
+
+template <class Kernel>
+bool nesterov_a_neighbor_scan_omp::NeighborScanOMP<Kernel>::post_processing() {
+  internal_order_test();
+  Kernel::store(*taskData, input_.data(), res_);
+  return true;
+}
+
+template class nesterov_a_neighbor_scan_omp::NeighborScanOMP<ppc::core::NearestPair<int, uint64_t>>;
+template class nesterov_a_neighbor_scan_omp::NeighborScanOMP<ppc::core::MostDifferentPair<int, uint64_t>>;
+template class nesterov_a_neighbor_scan_omp::NeighborScanOMP<ppc::core::OrderViolationCount<int, uint64_t>>;
+template class nesterov_a_neighbor_scan_omp::NeighborScanOMP<ppc::core::SignAlternationCount<int, uint64_t>>;
@@ -0,0 +1,40 @@
+// Copyright 2024 Nesterov Alexander
+#ifndef TASKS_OMP_SPARSE_MATRIX_INCLUDE_OPS_OMP_HPP_
+#define TASKS_OMP_SPARSE_MATRIX_INCLUDE_OPS_OMP_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+#include "core/task/include/task.hpp"
+
+namespace nesterov_a_sparse_matrix_omp {
+
+// Row sums or y = A x of a double CSR or CSC matrix with uint64_t indices,
+// threads get lines with balanced counts of nonzeros. Inputs and outputs
+// match the reference tasks SparseRowSums and SparseMatrixVectorProduct.
+template <bool WithVector>
+class SparseProductOMP : public ppc::core::Task {
+ public:
+  explicit SparseProductOMP(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  ppc::core::SparseMatrixView<double, uint64_t> matrix_;
+  const double *x_ = nullptr;
+  std::vector<double> res_;
+};
+
+using SparseRowSumsOMP = SparseProductOMP<false>;
+using SparseMatrixVectorProductOMP = SparseProductOMP<true>;
+
+extern template class SparseProductOMP<false>;
+extern template class SparseProductOMP<true>;
+
+}  // namespace nesterov_a_sparse_matrix_omp
+
+#endif  // TASKS_OMP_SPARSE_MATRIX_INCLUDE_OPS_OMP_HPP_
@@ -0,0 +1,48 @@
+// Copyright 2024 Nesterov Alexander
+#include "omp/sparse_matrix/include/ops_omp.hpp"
+
+#include <omp.h>
+
+#include <algorithm>
+
+#include "core/util/include/util.hpp"
+
+template <bool WithVector>
+bool nesterov_a_sparse_matrix_omp::SparseProductOMP<WithVector>::pre_processing() {
+  internal_order_test();
+  // Init view of input data
+  matrix_ = ppc::core::sparse_input<double, uint64_t>(*taskData);
+  x_ = WithVector ? taskData->input_view<double>(4).data() : nullptr;
+  res_ = std::vector<double>(matrix_.rows);
+  return true;
+}
+
+template <bool WithVector>
+bool nesterov_a_sparse_matrix_omp::SparseProductOMP<WithVector>::validation() {
+  internal_order_test();
+  return ppc::core::check_sparse_task<uint64_t>(*taskData, WithVector);
+}
+
+template <bool WithVector>
+bool nesterov_a_sparse_matrix_omp::SparseProductOMP<WithVector>::run() {
+  internal_order_test();
+  const int num_threads = ppc::util::get_num_threads();
+  ppc::core::SparseProduct<double, uint64_t> product(matrix_, x_, static_cast<std::size_t>(num_threads), &scratch());
+  const auto parts = static_cast<int>(product.parts());
+#pragma omp parallel for num_threads(num_threads) schedule(static, 1)
+  for (int part = 0; part < parts; part++) {
+    product.run(static_cast<std::size_t>(part), res_.data());
+  }
+  product.finish(res_.data());
+  return true;
+}
+
+template <bool WithVector>
+bool nesterov_a_sparse_matrix_omp::SparseProductOMP<WithVector>::post_processing() {
+  internal_order_test();
+  std::copy(res_.begin(), res_.end(), reinterpret_cast<double *>(taskData->outputs[0]));
+  return true;
+}
+
+template class nesterov_a_sparse_matrix_omp::SparseProductOMP<false>;
+template class nesterov_a_sparse_matrix_omp::SparseProductOMP<true>;
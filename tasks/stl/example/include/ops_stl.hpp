@@ -21,7 +21,7 @@ class TestSTLTaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_;
+  ppc::core::DataView<const int> input_;
   int res{};
   std::string ops;
 };
@@ -36,7 +36,7 @@ class TestSTLTaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_;
+  ppc::core::DataView<const int> input_;
   int res{};
   std::string ops;
 };
@@ -4,13 +4,14 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/util/include/util.hpp"
 #include "stl/example/include/ops_stl.hpp"
 
 TEST(stl_example_perf_test, test_pipeline_run) {
-  const int count = 100;
+  const int count = static_cast<int>(ppc::util::get_perf_size(10000000));
 
   // Create data
-  std::vector<int> in(1, count);
+  std::vector<int> in(count, 1);
   std::vector<int> out(1, 0);
 
   // Create TaskData
@@ -21,11 +22,13 @@ TEST(stl_example_perf_test, test_pipeline_run) {
   taskDataSeq->outputs_count.emplace_back(out.size());
 
   // Create Task
-  auto testTaskSTL = std::make_shared<nesterov_a_test_task_stl::TestSTLTaskSequential>(taskDataSeq, "+");
+  auto testTaskSTL = std::make_shared<nesterov_a_test_task_stl::TestSTLTaskParallel>(taskDataSeq, "+");
 
   // Create Perf attributes
   auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
-  perfAttr->num_running = 10;
+  perfAttr->num_running = 100;
+  perfAttr->input_size = in.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
   const auto t0 = std::chrono::high_resolution_clock::now();
   perfAttr->current_timer = [&] {
     auto current_time_point = std::chrono::high_resolution_clock::now();
@@ -44,10 +47,10 @@ TEST(stl_example_perf_test, test_pipeline_run) {
 }
 
 TEST(stl_example_perf_test, test_task_run) {
-  const int count = 100;
+  const int count = static_cast<int>(ppc::util::get_perf_size(10000000));
 
   // Create data
-  std::vector<int> in(1, count);
+  std::vector<int> in(count, 1);
   std::vector<int> out(1, 0);
 
   // Create TaskData
@@ -58,11 +61,13 @@ TEST(stl_example_perf_test, test_task_run) {
   taskDataSeq->outputs_count.emplace_back(out.size());
 
   // Create Task
-  auto testTaskSTL = std::make_shared<nesterov_a_test_task_stl::TestSTLTaskSequential>(taskDataSeq, "+");
+  auto testTaskSTL = std::make_shared<nesterov_a_test_task_stl::TestSTLTaskParallel>(taskDataSeq, "+");
 
   // Create Perf attributes
   auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
-  perfAttr->num_running = 10;
+  perfAttr->num_running = 100;
+  perfAttr->input_size = in.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
   const auto t0 = std::chrono::high_resolution_clock::now();
   perfAttr->current_timer = [&] {
     auto current_time_point = std::chrono::high_resolution_clock::now();
@@ -0,0 +1,68 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "stl/fibonacci/include/ops_stl.hpp"
+
+namespace {
+
+int64_t run_fibonacci(int n, bool parallel) {
+  std::vector<int> in(1, n);
+  std::vector<int64_t> out(1, -1);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  std::unique_ptr<ppc::core::Task> task;
+  if (parallel) {
+    task = std::make_unique<nesterov_a_fibonacci_stl::FibonacciSTLParallel>(taskData);
+  } else {
+    task = std::make_unique<nesterov_a_fibonacci_stl::FibonacciSTLSequential>(taskData);
+  }
+  EXPECT_TRUE(task->validation());
+  task->pre_processing();
+  task->run();
+  task->post_processing();
+  return out[0];
+}
+
+}  // namespace
+
+TEST(stl_fibonacci, small_values) {
+  const std::vector<int64_t> expected = {0, 1, 1, 2, 3, 5, 8, 13, 21, 34, 55};
+  for (int n = 0; n <= 10; n++) {
+    EXPECT_EQ(run_fibonacci(n, false), expected[n]);
+    EXPECT_EQ(run_fibonacci(n, true), expected[n]);
+  }
+}
+
+TEST(stl_fibonacci, above_sequential_cutoff) {
+  EXPECT_EQ(run_fibonacci(25, true), 75025);
+  EXPECT_EQ(run_fibonacci(25, true), run_fibonacci(25, false));
+}
+
+TEST(stl_fibonacci, repeated_parallel_runs) {
+  for (int i = 0; i < 20; i++) {
+    ASSERT_EQ(run_fibonacci(20, true), 6765);
+  }
+}
+
+TEST(stl_fibonacci, validation_rejects_out_of_range) {
+  std::vector<int> in(1, 93);
+  std::vector<int64_t> out(1, 0);
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+  nesterov_a_fibonacci_stl::FibonacciSTLParallel task(taskData);
+  EXPECT_FALSE(task.validation());
+}
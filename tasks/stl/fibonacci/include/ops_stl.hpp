@@ -0,0 +1,45 @@
+// Copyright 2024 Nesterov Alexander
+#ifndef TASKS_STL_FIBONACCI_INCLUDE_OPS_STL_HPP_
+#define TASKS_STL_FIBONACCI_INCLUDE_OPS_STL_HPP_
+
+#include <cstdint>
+#include <memory>
+
+#include "core/fibonacci/include/fibonacci.hpp"
+#include "core/task/include/task.hpp"
+
+namespace nesterov_a_fibonacci_stl {
+
+// subproblems below this size are solved without spawning tasks
+constexpr int sequential_cutoff = 12;
+
+class FibonacciSTLSequential : public ppc::core::Task {
+ public:
+  explicit FibonacciSTLSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  int n_{};
+  int64_t res_{};
+};
+
+// Recursive fib(n) on work-stealing ppc::core::Scheduler
+class FibonacciSTLParallel : public ppc::core::Task {
+ public:
+  explicit FibonacciSTLParallel(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  int n_{};
+  int64_t res_{};
+};
+
+}  // namespace nesterov_a_fibonacci_stl
+
+#endif  // TASKS_STL_FIBONACCI_INCLUDE_OPS_STL_HPP_
@@ -0,0 +1,73 @@
+// Copyright 2024 Nesterov Alexander
+#include "stl/fibonacci/include/ops_stl.hpp"
+
+#include "core/scheduler/include/scheduler.hpp"
+
+namespace {
+
+int64_t fib_parallel(ppc::core::Scheduler &scheduler, int n) {
+  if (n <= nesterov_a_fibonacci_stl::sequential_cutoff) {
+    return ppc::core::fib_sequential(n);
+  }
+  int64_t x = 0;
+  int64_t y = 0;
+  ppc::core::TaskGroup group(scheduler);
+  group.run([&] { x = fib_parallel(scheduler, n - 1); });
+  group.run([&] { y = fib_parallel(scheduler, n - 2); });
+  group.wait();
+  return x + y;
+}
+
+}  // namespace
+
+bool nesterov_a_fibonacci_stl::FibonacciSTLSequential::pre_processing() {
+  internal_order_test();
+  n_ = reinterpret_cast<int *>(taskData->inputs[0])[0];
+  res_ = 0;
+  return true;
+}
+
+bool nesterov_a_fibonacci_stl::FibonacciSTLSequential::validation() {
+  internal_order_test();
+  return taskData->inputs_count[0] == 1 && taskData->outputs_count[0] == 1 &&
+         reinterpret_cast<int *>(taskData->inputs[0])[0] >= 0 &&
+         reinterpret_cast<int *>(taskData->inputs[0])[0] <= ppc::core::fib_max_argument;
+}
+
+bool nesterov_a_fibonacci_stl::FibonacciSTLSequential::run() {
+  internal_order_test();
+  res_ = ppc::core::fib_sequential(n_);
+  return true;
+}
+
+bool nesterov_a_fibonacci_stl::FibonacciSTLSequential::post_processing() {
+  internal_order_test();
+  reinterpret_cast<int64_t *>(taskData->outputs[0])[0] = res_;
+  return true;
+}
+
+bool nesterov_a_fibonacci_stl::FibonacciSTLParallel::pre_processing() {
+  internal_order_test();
+  n_ = reinterpret_cast<int *>(taskData->inputs[0])[0];
+  res_ = 0;
+  return true;
+}
+
+bool nesterov_a_fibonacci_stl::FibonacciSTLParallel::validation() {
+  internal_order_test();
+  return taskData->inputs_count[0] == 1 && taskData->outputs_count[0] == 1 &&
+         reinterpret_cast<int *>(taskData->inputs[0])[0] >= 0 &&
+         reinterpret_cast<int *>(taskData->inputs[0])[0] <= ppc::core::fib_max_argument;
+}
+
+bool nesterov_a_fibonacci_stl::FibonacciSTLParallel::run() {
+  internal_order_test();
+  res_ = fib_parallel(ppc::core::Scheduler::global(), n_);
+  return true;
+}
+
+bool nesterov_a_fibonacci_stl::FibonacciSTLParallel::post_processing() {
+  internal_order_test();
+  reinterpret_cast<int64_t *>(taskData->outputs[0])[0] = res_;
+  return true;
+}
@@ -0,0 +1,18 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include "core/matrix_reduce/func_tests/matrix_sums_task_tests.hpp"
+#include "stl/matrix_sums/include/ops_stl.hpp"
+
+namespace {
+
+using ByRows = nesterov_a_matrix_sums_stl::SumValuesByRowsMatrixSTL;
+using ByCols = nesterov_a_matrix_sums_stl::SumValuesByColsMatrixSTL;
+
+}  // namespace
+
+TEST(stl_matrix_sums, sums_match_reference) { ppc::test::matrix_sums::check_sums_match_reference<ByRows, ByCols>(); }
+
+TEST(stl_matrix_sums, dense_row_major_shape) { ppc::test::matrix_sums::check_dense_row_major_shape<ByRows, ByCols>(); }
+
+TEST(stl_matrix_sums, validation) { ppc::test::matrix_sums::check_validation<ByRows>(); }
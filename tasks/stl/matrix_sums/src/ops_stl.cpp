@@ -0,0 +1,38 @@
+// Copyright 2024 Nesterov Alexander
+#include "stl/matrix_sums/include/ops_stl.hpp"
+
+#include <algorithm>
+
+#include "core/thread_pool/include/thread_pool.hpp"
+
+template <ppc::core::MatrixAxis Axis>
+bool nesterov_a_matrix_sums_stl::MatrixSumsSTL<Axis>::pre_processing() {
+  internal_order_test();
+  // Init view of input data
+  matrix_ = ppc::core::matrix_input<double, uint64_t>(*taskData);
+  sum_ = std::vector<double>(Axis == ppc::core::MatrixAxis::ROWS ? matrix_.rows : matrix_.cols);
+  return true;
+}
+
+template <ppc::core::MatrixAxis Axis>
+bool nesterov_a_matrix_sums_stl::MatrixSumsSTL<Axis>::validation() {
+  internal_order_test();
+  return ppc::core::check_matrix_task<uint64_t>(*taskData, Axis);
+}
+
+template <ppc::core::MatrixAxis Axis>
+bool nesterov_a_matrix_sums_stl::MatrixSumsSTL<Axis>::run() {
+  internal_order_test();
+  ppc::core::matrix_sums(ppc::core::ThreadPool::global(), matrix_, Axis, sum_.data(), &scratch());
+  return true;
+}
+
+template <ppc::core::MatrixAxis Axis>
+bool nesterov_a_matrix_sums_stl::MatrixSumsSTL<Axis>::post_processing() {
+  internal_order_test();
+  std::copy(sum_.begin(), sum_.end(), reinterpret_cast<double *>(taskData->outputs[0]));
+  return true;
+}
+
+template class nesterov_a_matrix_sums_stl::MatrixSumsSTL<ppc::core::MatrixAxis::ROWS>;
+template class nesterov_a_matrix_sums_stl::MatrixSumsSTL<ppc::core::MatrixAxis::COLS>;
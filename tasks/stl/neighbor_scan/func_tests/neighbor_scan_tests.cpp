@@ -0,0 +1,32 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include "core/neighbor_scan/func_tests/neighbor_scan_task_tests.hpp"
+#include "stl/neighbor_scan/include/ops_stl.hpp"
+
+namespace {
+
+using Nearest = nesterov_a_neighbor_scan_stl::NearestNeighborElementsSTL;
+using MostDifferent = nesterov_a_neighbor_scan_stl::MostDifferentNeighborElementsSTL;
+using Violations = nesterov_a_neighbor_scan_stl::NumOfOrderlyViolationsSTL;
+using Alternations = nesterov_a_neighbor_scan_stl::NumOfAlternationsSignsSTL;
+
+}  // namespace
+
+TEST(stl_neighbor_scan, nearest_and_most_different_match_reference) {
+  ppc::test::neighbor_scan::check_pairs_match_reference<Nearest, MostDifferent>();
+}
+
+TEST(stl_neighbor_scan, counts_match_reference) {
+  ppc::test::neighbor_scan::check_counts_match_reference<Violations, Alternations>();
+}
+
+TEST(stl_neighbor_scan, pair_on_chunk_boundary) {
+  ppc::test::neighbor_scan::check_pair_on_chunk_boundary<Nearest, Alternations>();
+}
+
+TEST(stl_neighbor_scan, validation) { ppc::test::neighbor_scan::check_validation<Nearest>(); }
+
+TEST(stl_neighbor_scan, first_touch_placement_matches_in_place) {
+  ppc::test::neighbor_scan::check_first_touch_matches_in_place<Violations>();
+}
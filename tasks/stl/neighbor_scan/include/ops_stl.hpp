@@ -0,0 +1,48 @@
+// Copyright 2024 Nesterov Alexander
+#ifndef TASKS_STL_NEIGHBOR_SCAN_INCLUDE_OPS_STL_HPP_
+#define TASKS_STL_NEIGHBOR_SCAN_INCLUDE_OPS_STL_HPP_
+
+#include <cstdint>
+#include <memory>
+
+#include "core/neighbor_scan/include/neighbor_scan.hpp"
+#include "core/numa/include/numa_buffer.hpp"
+#include "core/task/include/task.hpp"
+
+namespace nesterov_a_neighbor_scan_stl {
+
+// Adjacent pairs of an int vector split into chunks between threads, chunks
+// share only their boundary element. Outputs match the reference tasks.
+// With FIRST_TOUCH placement every thread copies its chunk of the input in
+// pre_processing(), so run() reads node-local memory.
+template <class Kernel>
+class NeighborScanSTL : public ppc::core::Task {
+ public:
+  explicit NeighborScanSTL(std::shared_ptr<ppc::core::TaskData> taskData_,
+                           ppc::core::InputPlacement placement = ppc::core::input_placement())
+      : Task(std::move(taskData_)), placement_(placement) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  ppc::core::InputPlacement placement_;
+  ppc::core::NumaBuffer<int> local_input_;
+  ppc::core::DataView<const int> input_;
+  typename Kernel::Result res_{};
+};
+
+using NearestNeighborElementsSTL = NeighborScanSTL<ppc::core::NearestPair<int, uint64_t>>;
+using MostDifferentNeighborElementsSTL = NeighborScanSTL<ppc::core::MostDifferentPair<int, uint64_t>>;
+using NumOfOrderlyViolationsSTL = NeighborScanSTL<ppc::core::OrderViolationCount<int, uint64_t>>;
+using NumOfAlternationsSignsSTL = NeighborScanSTL<ppc::core::SignAlternationCount<int, uint64_t>>;
+
+extern template class NeighborScanSTL<ppc::core::NearestPair<int, uint64_t>>;
+extern template class NeighborScanSTL<ppc::core::MostDifferentPair<int, uint64_t>>;
+extern template class NeighborScanSTL<ppc::core::OrderViolationCount<int, uint64_t>>;
+extern template class NeighborScanSTL<ppc::core::SignAlternationCount<int, uint64_t>>;
+
+}  // namespace nesterov_a_neighbor_scan_stl
+
+#endif  // TASKS_STL_NEIGHBOR_SCAN_INCLUDE_OPS_STL_HPP_
@@ -0,0 +1,89 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/util/include/util.hpp"
+#include "stl/neighbor_scan/include/ops_stl.hpp"
+
+TEST(stl_neighbor_scan_perf_test, test_pipeline_run) {
+  const int count = static_cast<int>(ppc::util::get_perf_size(10000000));
+
+  // Create data
+  std::vector<int> in(count);
+  for (int i = 0; i < count; i++) in[i] = i % 2 == 0 ? i : -i;
+  std::vector<uint64_t> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_output(out);
+
+  // Create Task
+  auto task = std::make_shared<nesterov_a_neighbor_scan_stl::NumOfAlternationsSignsSTL>(taskData);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 100;
+  perfAttr->input_size = in.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perfAttr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  perfAnalyzer->pipeline_run(perfAttr, perfResults);
+  ppc::core::Perf::print_perf_statistic(perfResults);
+  // zero at the first element has no sign
+  ASSERT_EQ(out[0], static_cast<uint64_t>(count - 2));
+}
+
+TEST(stl_neighbor_scan_perf_test, test_task_run) {
+  const int count = static_cast<int>(ppc::util::get_perf_size(10000000));
+
+  // Create data
+  std::vector<int> in(count);
+  for (int i = 0; i < count; i++) in[i] = i % 2 == 0 ? i : -i;
+  std::vector<uint64_t> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_output(out);
+
+  // Create Task
+  auto task = std::make_shared<nesterov_a_neighbor_scan_stl::NumOfAlternationsSignsSTL>(taskData);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 100;
+  perfAttr->input_size = in.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perfAttr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  perfAnalyzer->task_run(perfAttr, perfResults);
+  ppc::core::Perf::print_perf_statistic(perfResults);
+  // zero at the first element has no sign
+  ASSERT_EQ(out[0], static_cast<uint64_t>(count - 2));
+}
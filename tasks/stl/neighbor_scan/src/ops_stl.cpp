@@ -0,0 +1,46 @@
+// Copyright 2024 Nesterov Alexander
+#include "stl/neighbor_scan/include/ops_stl.hpp"
+
+#include "core/thread_pool/include/parallel_reduce.hpp"
+
+template <class Kernel>
+bool nesterov_a_neighbor_scan_stl::NeighborScanSTL<Kernel>::pre_processing() {
+  internal_order_test();
+  // Init view of input data
+  input_ = taskData->input_view<int>(0);
+  if (placement_ == ppc::core::InputPlacement::FIRST_TOUCH) {
+    local_input_.allocate(input_.size());
+    ppc::core::first_touch_copy(ppc::core::ThreadPool::global(), input_.data(), local_input_);
+    input_ = local_input_.view();
+  }
+  res_ = Kernel::identity();
+  return true;
+}
+
+template <class Kernel>
+bool nesterov_a_neighbor_scan_stl::NeighborScanSTL<Kernel>::validation() {
+  internal_order_test();
+  return Kernel::check(*taskData);
+}
+
+template <class Kernel>
+bool nesterov_a_neighbor_scan_stl::NeighborScanSTL<Kernel>::run() {
+  internal_order_test();
+  const std::size_t pairs = input_.size() - 1;
+  res_ = ppc::core::parallel_reduce(
+      ppc::core::ThreadPool::global(), 0, pairs, Kernel::identity(),
+      [&](std::size_t begin, std::size_t end) { return Kernel::scan(input_.data(), begin, end); }, Kernel::combine);
+  return true;
+}
+
+template <class Kernel>
+bool nesterov_a_neighbor_scan_stl::NeighborScanSTL<Kernel>::post_processing() {
+  internal_order_test();
+  Kernel::store(*taskData, input_.data(), res_);
+  return true;
+}
+
+template class nesterov_a_neighbor_scan_stl::NeighborScanSTL<ppc::core::NearestPair<int, uint64_t>>;
+template class nesterov_a_neighbor_scan_stl::NeighborScanSTL<ppc::core::MostDifferentPair<int, uint64_t>>;
+template class nesterov_a_neighbor_scan_stl::NeighborScanSTL<ppc::core::OrderViolationCount<int, uint64_t>>;
+template class nesterov_a_neighbor_scan_stl::NeighborScanSTL<ppc::core::SignAlternationCount<int, uint64_t>>;
@@ -0,0 +1,39 @@
+// Copyright 2024 Nesterov Alexander
+#include "stl/sparse_matrix/include/ops_stl.hpp"
+
+#include <algorithm>
+
+#include "core/thread_pool/include/thread_pool.hpp"
+
+template <bool WithVector>
+bool nesterov_a_sparse_matrix_stl::SparseProductSTL<WithVector>::pre_processing() {
+  internal_order_test();
+  // Init view of input data
+  matrix_ = ppc::core::sparse_input<double, uint64_t>(*taskData);
+  x_ = WithVector ? taskData->input_view<double>(4).data() : nullptr;
+  res_ = std::vector<double>(matrix_.rows);
+  return true;
+}
+
+template <bool WithVector>
+bool nesterov_a_sparse_matrix_stl::SparseProductSTL<WithVector>::validation() {
+  internal_order_test();
+  return ppc::core::check_sparse_task<uint64_t>(*taskData, WithVector);
+}
+
+template <bool WithVector>
+bool nesterov_a_sparse_matrix_stl::SparseProductSTL<WithVector>::run() {
+  internal_order_test();
+  ppc::core::sparse_product(ppc::core::ThreadPool::global(), matrix_, x_, res_.data(), &scratch());
+  return true;
+}
+
+template <bool WithVector>
+bool nesterov_a_sparse_matrix_stl::SparseProductSTL<WithVector>::post_processing() {
+  internal_order_test();
+  std::copy(res_.begin(), res_.end(), reinterpret_cast<double *>(taskData->outputs[0]));
+  return true;
+}
+
+template class nesterov_a_sparse_matrix_stl::SparseProductSTL<false>;
+template class nesterov_a_sparse_matrix_stl::SparseProductSTL<true>;
@@ -5,13 +5,14 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/util/include/util.hpp"
 #include "tbb/example/include/ops_tbb.hpp"
 
 TEST(tbb_example_perf_test, test_pipeline_run) {
-  const int count = 100;
+  const int count = static_cast<int>(ppc::util::get_perf_size(10000000));
 
   // Create data
-  std::vector<int> in(1, count);
+  std::vector<int> in(count, 1);
   std::vector<int> out(1, 0);
 
   // Create TaskData
@@ -22,11 +23,13 @@ TEST(tbb_example_perf_test, test_pipeline_run) {
   taskDataSeq->outputs_count.emplace_back(out.size());
 
   // Create Task
-  auto testTaskTBB = std::make_shared<nesterov_a_test_task_tbb::TestTBBTaskSequential>(taskDataSeq, "+");
+  auto testTaskTBB = std::make_shared<nesterov_a_test_task_tbb::TestTBBTaskParallel>(taskDataSeq, "+");
 
   // Create Perf attributes
   auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
-  perfAttr->num_running = 10;
+  perfAttr->num_running = 100;
+  perfAttr->input_size = in.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
   const auto t0 = oneapi::tbb::tick_count::now();
   perfAttr->current_timer = [&] { return (oneapi::tbb::tick_count::now() - t0).seconds(); };
 
@@ -41,10 +44,10 @@ TEST(tbb_example_perf_test, test_pipeline_run) {
 }
 
 TEST(tbb_example_perf_test, test_task_run) {
-  const int count = 100;
+  const int count = static_cast<int>(ppc::util::get_perf_size(10000000));
 
   // Create data
-  std::vector<int> in(1, count);
+  std::vector<int> in(count, 1);
   std::vector<int> out(1, 0);
 
   // Create TaskData
@@ -55,11 +58,13 @@ TEST(tbb_example_perf_test, test_task_run) {
   taskDataSeq->outputs_count.emplace_back(out.size());
 
   // Create Task
-  auto testTaskTBB = std::make_shared<nesterov_a_test_task_tbb::TestTBBTaskSequential>(taskDataSeq, "+");
+  auto testTaskTBB = std::make_shared<nesterov_a_test_task_tbb::TestTBBTaskParallel>(taskDataSeq, "+");
 
   // Create Perf attributes
   auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
-  perfAttr->num_running = 10;
+  perfAttr->num_running = 100;
+  perfAttr->input_size = in.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
   const auto t0 = oneapi::tbb::tick_count::now();
   perfAttr->current_timer = [&] { return (oneapi::tbb::tick_count::now() - t0).seconds(); };
 
@@ -5,31 +5,23 @@
 
 #include <functional>
 #include <numeric>
-#include <random>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "core/random/include/random.hpp"
+#include "core/util/include/util.hpp"
+
 using namespace std::chrono_literals;
 
 std::vector<int> nesterov_a_test_task_tbb::getRandomVector(int sz) {
-  std::random_device dev;
-  std::mt19937 gen(dev());
-  std::vector<int> vec(sz);
-  for (int i = 0; i < sz; i++) {
-    vec[i] = gen() % 20 + 1;
-  }
-  return vec;
+  return ppc::core::random_vector<int>(sz, {1, 20});
 }
 
 bool nesterov_a_test_task_tbb::TestTBBTaskSequential::pre_processing() {
   internal_order_test();
-  // Init vectors
-  input_ = std::vector<int>(taskData->inputs_count[0]);
-  auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-  for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-    input_[i] = tmp_ptr[i];
-  }
+  // Init view of input data
+  input_ = taskData->input_view<int>(0);
   // Init value for output
   res = 1;
   return true;
@@ -62,12 +54,8 @@ bool nesterov_a_test_task_tbb::TestTBBTaskSequential::post_processing() {
 
 bool nesterov_a_test_task_tbb::TestTBBTaskParallel::pre_processing() {
   internal_order_test();
-  // Init vectors
-  input_ = std::vector<int>(taskData->inputs_count[0]);
-  auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-  for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-    input_[i] = tmp_ptr[i];
-  }
+  // Init view of input data
+  input_ = taskData->input_view<int>(0);
   // Init value for output
   res = 1;
   return true;
@@ -81,31 +69,34 @@ bool nesterov_a_test_task_tbb::TestTBBTaskParallel::validation() {
 
 bool nesterov_a_test_task_tbb::TestTBBTaskParallel::run() {
   internal_order_test();
-  if (ops == "+") {
-    res += oneapi::tbb::parallel_reduce(
-        oneapi::tbb::blocked_range<std::vector<int>::iterator>(input_.begin(), input_.end()), 0,
-        [](tbb::blocked_range<std::vector<int>::iterator> r, int running_total) {
-          running_total += std::accumulate(r.begin(), r.end(), 0);
-          return running_total;
-        },
-        std::plus<>());
-  } else if (ops == "-") {
-    res -= oneapi::tbb::parallel_reduce(
-        oneapi::tbb::blocked_range<std::vector<int>::iterator>(input_.begin(), input_.end()), 0,
-        [](tbb::blocked_range<std::vector<int>::iterator> r, int running_total) {
-          running_total += std::accumulate(r.begin(), r.end(), 0);
-          return running_total;
-        },
-        std::plus<>());
-  } else if (ops == "*") {
-    res *= oneapi::tbb::parallel_reduce(
-        oneapi::tbb::blocked_range<std::vector<int>::iterator>(input_.begin(), input_.end()), 1,
-        [](tbb::blocked_range<std::vector<int>::iterator> r, int running_total) {
-          running_total *= std::accumulate(r.begin(), r.end(), 1, std::multiplies<>());
-          return running_total;
-        },
-        std::multiplies<>());
-  }
+  oneapi::tbb::task_arena arena(ppc::util::get_num_threads());
+  arena.execute([&] {
+    if (ops == "+") {
+      res += oneapi::tbb::parallel_reduce(
+          oneapi::tbb::blocked_range<const int*>(input_.begin(), input_.end()), 0,
+          [](tbb::blocked_range<const int*> r, int running_total) {
+            running_total += std::accumulate(r.begin(), r.end(), 0);
+            return running_total;
+          },
+          std::plus<>());
+    } else if (ops == "-") {
+      res -= oneapi::tbb::parallel_reduce(
+          oneapi::tbb::blocked_range<const int*>(input_.begin(), input_.end()), 0,
+          [](tbb::blocked_range<const int*> r, int running_total) {
+            running_total += std::accumulate(r.begin(), r.end(), 0);
+            return running_total;
+          },
+          std::plus<>());
+    } else if (ops == "*") {
+      res *= oneapi::tbb::parallel_reduce(
+          oneapi::tbb::blocked_range<const int*>(input_.begin(), input_.end()), 1,
+          [](tbb::blocked_range<const int*> r, int running_total) {
+            running_total *= std::accumulate(r.begin(), r.end(), 1, std::multiplies<>());
+            return running_total;
+          },
+          std::multiplies<>());
+    }
+  });
   return true;
 }
 
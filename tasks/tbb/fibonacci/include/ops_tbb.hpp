@@ -0,0 +1,45 @@
+// Copyright 2024 Nesterov Alexander
+#ifndef TASKS_TBB_FIBONACCI_INCLUDE_OPS_TBB_HPP_
+#define TASKS_TBB_FIBONACCI_INCLUDE_OPS_TBB_HPP_
+
+#include <cstdint>
+#include <memory>
+
+#include "core/fibonacci/include/fibonacci.hpp"
+#include "core/task/include/task.hpp"
+
+namespace nesterov_a_fibonacci_tbb {
+
+// subproblems below this size are solved without spawning tasks
+constexpr int sequential_cutoff = 12;
+
+class FibonacciTBBSequential : public ppc::core::Task {
+ public:
+  explicit FibonacciTBBSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  int n_{};
+  int64_t res_{};
+};
+
+// Recursive fib(n) on oneapi::tbb::task_group
+class FibonacciTBBParallel : public ppc::core::Task {
+ public:
+  explicit FibonacciTBBParallel(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  int n_{};
+  int64_t res_{};
+};
+
+}  // namespace nesterov_a_fibonacci_tbb
+
+#endif  // TASKS_TBB_FIBONACCI_INCLUDE_OPS_TBB_HPP_
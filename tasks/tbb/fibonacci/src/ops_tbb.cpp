@@ -0,0 +1,76 @@
+// Copyright 2024 Nesterov Alexander
+#include "tbb/fibonacci/include/ops_tbb.hpp"
+
+#include <tbb/tbb.h>
+
+#include "core/util/include/util.hpp"
+
+namespace {
+
+int64_t fib_parallel(int n) {
+  if (n <= nesterov_a_fibonacci_tbb::sequential_cutoff) {
+    return ppc::core::fib_sequential(n);
+  }
+  int64_t x = 0;
+  int64_t y = 0;
+  oneapi::tbb::task_group group;
+  group.run([&] { x = fib_parallel(n - 1); });
+  group.run([&] { y = fib_parallel(n - 2); });
+  group.wait();
+  return x + y;
+}
+
+}  // namespace
+
+bool nesterov_a_fibonacci_tbb::FibonacciTBBSequential::pre_processing() {
+  internal_order_test();
+  n_ = reinterpret_cast<int *>(taskData->inputs[0])[0];
+  res_ = 0;
+  return true;
+}
+
+bool nesterov_a_fibonacci_tbb::FibonacciTBBSequential::validation() {
+  internal_order_test();
+  return taskData->inputs_count[0] == 1 && taskData->outputs_count[0] == 1 &&
+         reinterpret_cast<int *>(taskData->inputs[0])[0] >= 0 &&
+         reinterpret_cast<int *>(taskData->inputs[0])[0] <= ppc::core::fib_max_argument;
+}
+
+bool nesterov_a_fibonacci_tbb::FibonacciTBBSequential::run() {
+  internal_order_test();
+  res_ = ppc::core::fib_sequential(n_);
+  return true;
+}
+
+bool nesterov_a_fibonacci_tbb::FibonacciTBBSequential::post_processing() {
+  internal_order_test();
+  reinterpret_cast<int64_t *>(taskData->outputs[0])[0] = res_;
+  return true;
+}
+
+bool nesterov_a_fibonacci_tbb::FibonacciTBBParallel::pre_processing() {
+  internal_order_test();
+  n_ = reinterpret_cast<int *>(taskData->inputs[0])[0];
+  res_ = 0;
+  return true;
+}
+
+bool nesterov_a_fibonacci_tbb::FibonacciTBBParallel::validation() {
+  internal_order_test();
+  return taskData->inputs_count[0] == 1 && taskData->outputs_count[0] == 1 &&
+         reinterpret_cast<int *>(taskData->inputs[0])[0] >= 0 &&
+         reinterpret_cast<int *>(taskData->inputs[0])[0] <= ppc::core::fib_max_argument;
+}
+
+bool nesterov_a_fibonacci_tbb::FibonacciTBBParallel::run() {
+  internal_order_test();
+  oneapi::tbb::task_arena arena(ppc::util::get_num_threads());
+  arena.execute([&] { res_ = fib_parallel(n_); });
+  return true;
+}
+
+bool nesterov_a_fibonacci_tbb::FibonacciTBBParallel::post_processing() {
+  internal_order_test();
+  reinterpret_cast<int64_t *>(taskData->outputs[0])[0] = res_;
+  return true;
+}
@@ -0,0 +1,18 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include "core/matrix_reduce/func_tests/matrix_sums_task_tests.hpp"
+#include "tbb/matrix_sums/include/ops_tbb.hpp"
+
+namespace {
+
+using ByRows = nesterov_a_matrix_sums_tbb::SumValuesByRowsMatrixTBB;
+using ByCols = nesterov_a_matrix_sums_tbb::SumValuesByColsMatrixTBB;
+
+}  // namespace
+
+TEST(tbb_matrix_sums, sums_match_reference) { ppc::test::matrix_sums::check_sums_match_reference<ByRows, ByCols>(); }
+
+TEST(tbb_matrix_sums, dense_row_major_shape) { ppc::test::matrix_sums::check_dense_row_major_shape<ByRows, ByCols>(); }
+
+TEST(tbb_matrix_sums, validation) { ppc::test::matrix_sums::check_validation<ByRows>(); }
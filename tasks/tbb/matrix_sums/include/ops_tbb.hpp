@@ -0,0 +1,37 @@
+// Copyright 2024 Nesterov Alexander
+#ifndef TASKS_TBB_MATRIX_SUMS_INCLUDE_OPS_TBB_HPP_
+#define TASKS_TBB_MATRIX_SUMS_INCLUDE_OPS_TBB_HPP_
+
+#include <memory>
+#include <vector>
+
+#include "core/matrix_reduce/include/matrix_reduce.hpp"
+#include "core/task/include/task.hpp"
+
+namespace nesterov_a_matrix_sums_tbb {
+
+// Row or column sums of a double matrix in any layout of ppc::core::check_matrix_task(),
+// inputs and outputs match the reference tasks SumValuesByRowsMatrix and SumValuesByColsMatrix.
+template <ppc::core::MatrixAxis Axis>
+class MatrixSumsTBB : public ppc::core::Task {
+ public:
+  explicit MatrixSumsTBB(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  ppc::core::MatrixView<double> matrix_;
+  std::vector<double> sum_;
+};
+
+using SumValuesByRowsMatrixTBB = MatrixSumsTBB<ppc::core::MatrixAxis::ROWS>;
+using SumValuesByColsMatrixTBB = MatrixSumsTBB<ppc::core::MatrixAxis::COLS>;
+
+extern template class MatrixSumsTBB<ppc::core::MatrixAxis::ROWS>;
+extern template class MatrixSumsTBB<ppc::core::MatrixAxis::COLS>;
+
+}  // namespace nesterov_a_matrix_sums_tbb
+
+#endif  // TASKS_TBB_MATRIX_SUMS_INCLUDE_OPS_TBB_HPP_
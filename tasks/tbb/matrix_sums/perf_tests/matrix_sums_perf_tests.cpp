@@ -0,0 +1,89 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+#include <oneapi/tbb/tick_count.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/util/include/util.hpp"
+#include "tbb/matrix_sums/include/ops_tbb.hpp"
+
+TEST(tbb_matrix_sums_perf_test, test_pipeline_run) {
+  // rows of 1000 elements
+  const uint64_t cols = 1000;
+  const uint64_t rows = ppc::util::get_perf_size(10000000) / cols;
+
+  // Create data
+  std::vector<double> in(rows * cols, 1.0);
+  std::vector<uint64_t> in_index = {rows, cols};
+  std::vector<double> out(rows, 0.0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_input(in_index);
+  taskData->add_output(out);
+
+  // Create Task
+  auto task = std::make_shared<nesterov_a_matrix_sums_tbb::SumValuesByRowsMatrixTBB>(taskData);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 100;
+  perfAttr->input_size = in.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
+  const auto t0 = oneapi::tbb::tick_count::now();
+  perfAttr->current_timer = [&] { return (oneapi::tbb::tick_count::now() - t0).seconds(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  perfAnalyzer->pipeline_run(perfAttr, perfResults);
+  ppc::core::Perf::print_perf_statistic(perfResults);
+  for (double sum : out) {
+    ASSERT_EQ(sum, static_cast<double>(cols));
+  }
+}
+
+TEST(tbb_matrix_sums_perf_test, test_task_run) {
+  // column sums accumulated by blocks of contiguous rows
+  const uint64_t cols = 1000;
+  const uint64_t rows = ppc::util::get_perf_size(10000000) / cols;
+
+  // Create data
+  std::vector<double> in(rows * cols, 1.0);
+  std::vector<uint64_t> in_index = {rows, cols};
+  std::vector<double> out(cols, 0.0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_input(in_index);
+  taskData->add_output(out);
+
+  // Create Task
+  auto task = std::make_shared<nesterov_a_matrix_sums_tbb::SumValuesByColsMatrixTBB>(taskData);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 100;
+  perfAttr->input_size = in.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
+  const auto t0 = oneapi::tbb::tick_count::now();
+  perfAttr->current_timer = [&] { return (oneapi::tbb::tick_count::now() - t0).seconds(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  perfAnalyzer->task_run(perfAttr, perfResults);
+  ppc::core::Perf::print_perf_statistic(perfResults);
+  for (double sum : out) {
+    ASSERT_EQ(sum, static_cast<double>(rows));
+  }
+}
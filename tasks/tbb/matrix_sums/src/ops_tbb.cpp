@@ -0,0 +1,51 @@
+// Copyright 2024 Nesterov Alexander
+#include "tbb/matrix_sums/include/ops_tbb.hpp"
+
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/task_arena.h>
+
+#include <algorithm>
+
+#include "core/util/include/util.hpp"
+
+template <ppc::core::MatrixAxis Axis>
+bool nesterov_a_matrix_sums_tbb::MatrixSumsTBB<Axis>::pre_processing() {
+  internal_order_test();
+  // Init view of input data
+  matrix_ = ppc::core::matrix_input<double, uint64_t>(*taskData);
+  sum_ = std::vector<double>(Axis == ppc::core::MatrixAxis::ROWS ? matrix_.rows : matrix_.cols);
+  return true;
+}
+
+template <ppc::core::MatrixAxis Axis>
+bool nesterov_a_matrix_sums_tbb::MatrixSumsTBB<Axis>::validation() {
+  internal_order_test();
+  return ppc::core::check_matrix_task<uint64_t>(*taskData, Axis);
+}
+
+template <ppc::core::MatrixAxis Axis>
+bool nesterov_a_matrix_sums_tbb::MatrixSumsTBB<Axis>::run() {
+  internal_order_test();
+  const int num_threads = ppc::util::get_num_threads();
+  ppc::core::MatrixSums<double> sums(matrix_, Axis, static_cast<std::size_t>(num_threads), &scratch());
+  oneapi::tbb::task_arena arena(num_threads);
+  arena.execute([&] {
+    oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<std::size_t>(0, sums.parts(), 1),
+                              [&](const oneapi::tbb::blocked_range<std::size_t> &r) {
+                                for (auto part = r.begin(); part != r.end(); ++part) sums.run(part, sum_.data());
+                              });
+  });
+  sums.finish(sum_.data());
+  return true;
+}
+
+template <ppc::core::MatrixAxis Axis>
+bool nesterov_a_matrix_sums_tbb::MatrixSumsTBB<Axis>::post_processing() {
+  internal_order_test();
+  std::copy(sum_.begin(), sum_.end(), reinterpret_cast<double *>(taskData->outputs[0]));
+  return true;
+}
+
+template class nesterov_a_matrix_sums_tbb::MatrixSumsTBB<ppc::core::MatrixAxis::ROWS>;
+template class nesterov_a_matrix_sums_tbb::MatrixSumsTBB<ppc::core::MatrixAxis::COLS>;
@@ -0,0 +1,55 @@
+// Copyright 2024 Nesterov Alexander
+#ifndef TASKS_TBB_NEIGHBOR_SCAN_INCLUDE_OPS_TBB_HPP_
+#define TASKS_TBB_NEIGHBOR_SCAN_INCLUDE_OPS_TBB_HPP_
+
+#include <oneapi/tbb/partitioner.h>
+#include <oneapi/tbb/task_arena.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "core/neighbor_scan/include/neighbor_scan.hpp"
+#include "core/numa/include/numa_buffer.hpp"
+#include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
+
+namespace nesterov_a_neighbor_scan_tbb {
+
+// Adjacent pairs of an int vector split into chunks between threads, chunks
+// share only their boundary element. Outputs match the reference tasks.
+// With FIRST_TOUCH placement every thread copies its chunk of the input in
+// pre_processing(), so run() reads node-local memory.
+template <class Kernel>
+class NeighborScanTBB : public ppc::core::Task {
+ public:
+  explicit NeighborScanTBB(std::shared_ptr<ppc::core::TaskData> taskData_,
+                           ppc::core::InputPlacement placement = ppc::core::input_placement())
+      : Task(std::move(taskData_)), placement_(placement) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  ppc::core::InputPlacement placement_;
+  ppc::core::NumaBuffer<int> local_input_;
+  // chunks are replayed on the threads that copied them
+  oneapi::tbb::task_arena arena_{ppc::util::get_num_threads()};
+  oneapi::tbb::affinity_partitioner partitioner_;
+  ppc::core::DataView<const int> input_;
+  typename Kernel::Result res_{};
+};
+
+using NearestNeighborElementsTBB = NeighborScanTBB<ppc::core::NearestPair<int, uint64_t>>;
+using MostDifferentNeighborElementsTBB = NeighborScanTBB<ppc::core::MostDifferentPair<int, uint64_t>>;
+using NumOfOrderlyViolationsTBB = NeighborScanTBB<ppc::core::OrderViolationCount<int, uint64_t>>;
+using NumOfAlternationsSignsTBB = NeighborScanTBB<ppc::core::SignAlternationCount<int, uint64_t>>;
+
+extern template class NeighborScanTBB<ppc::core::NearestPair<int, uint64_t>>;
+extern template class NeighborScanTBB<ppc::core::MostDifferentPair<int, uint64_t>>;
+extern template class NeighborScanTBB<ppc::core::OrderViolationCount<int, uint64_t>>;
+extern template class NeighborScanTBB<ppc::core::SignAlternationCount<int, uint64_t>>;
+
+}  // namespace nesterov_a_neighbor_scan_tbb
+
+#endif  // TASKS_TBB_NEIGHBOR_SCAN_INCLUDE_OPS_TBB_HPP_
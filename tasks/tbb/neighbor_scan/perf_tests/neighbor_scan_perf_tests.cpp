@@ -0,0 +1,81 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+#include <oneapi/tbb/tick_count.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/util/include/util.hpp"
+#include "tbb/neighbor_scan/include/ops_tbb.hpp"
+
+TEST(tbb_neighbor_scan_perf_test, test_pipeline_run) {
+  const int count = static_cast<int>(ppc::util::get_perf_size(10000000));
+
+  // Create data
+  std::vector<int> in(count);
+  for (int i = 0; i < count; i++) in[i] = i % 2 == 0 ? i : -i;
+  std::vector<uint64_t> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_output(out);
+
+  // Create Task
+  auto task = std::make_shared<nesterov_a_neighbor_scan_tbb::NumOfAlternationsSignsTBB>(taskData);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 100;
+  perfAttr->input_size = in.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
+  const auto t0 = oneapi::tbb::tick_count::now();
+  perfAttr->current_timer = [&] { return (oneapi::tbb::tick_count::now() - t0).seconds(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  perfAnalyzer->pipeline_run(perfAttr, perfResults);
+  ppc::core::Perf::print_perf_statistic(perfResults);
+  // zero at the first element has no sign
+  ASSERT_EQ(out[0], static_cast<uint64_t>(count - 2));
+}
+
+TEST(tbb_neighbor_scan_perf_test, test_task_run) {
+  const int count = static_cast<int>(ppc::util::get_perf_size(10000000));
+
+  // Create data
+  std::vector<int> in(count);
+  for (int i = 0; i < count; i++) in[i] = i % 2 == 0 ? i : -i;
+  std::vector<uint64_t> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in);
+  taskData->add_output(out);
+
+  // Create Task
+  auto task = std::make_shared<nesterov_a_neighbor_scan_tbb::NumOfAlternationsSignsTBB>(taskData);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 100;
+  perfAttr->input_size = in.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
+  const auto t0 = oneapi::tbb::tick_count::now();
+  perfAttr->current_timer = [&] { return (oneapi::tbb::tick_count::now() - t0).seconds(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  perfAnalyzer->task_run(perfAttr, perfResults);
+  ppc::core::Perf::print_perf_statistic(perfResults);
+  // zero at the first element has no sign
+  ASSERT_EQ(out[0], static_cast<uint64_t>(count - 2));
+}
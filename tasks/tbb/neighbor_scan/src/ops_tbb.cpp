@@ -0,0 +1,79 @@
+// Copyright 2024 Nesterov Alexander
+#include "tbb/neighbor_scan/include/ops_tbb.hpp"
+
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/parallel_reduce.h>
+
+#include <algorithm>
+
+namespace {
+
+// pins TBB threads of the arena to the places of the affinity policy
+void bind_tbb_thread() {
+  ppc::core::bind_thread(oneapi::tbb::this_task_arena::current_thread_index(),
+                         oneapi::tbb::this_task_arena::max_concurrency());
+}
+
+}  // namespace
+
+template <class Kernel>
+bool nesterov_a_neighbor_scan_tbb::NeighborScanTBB<Kernel>::pre_processing() {
+  internal_order_test();
+  // Init view of input data
+  input_ = taskData->input_view<int>(0);
+  if (placement_ == ppc::core::InputPlacement::FIRST_TOUCH) {
+    // same range and partitioner as run(), so chunks are read by the threads that copied them
+    const std::size_t pairs = input_.size() - 1;
+    local_input_.allocate(input_.size());
+    const int *src = input_.data();
+    int *dst = local_input_.data();
+    arena_.execute([&] {
+      oneapi::tbb::parallel_for(
+          oneapi::tbb::blocked_range<std::size_t>(0, pairs),
+          [&](const oneapi::tbb::blocked_range<std::size_t> &r) {
+            bind_tbb_thread();
+            std::copy(src + r.begin(), src + r.end(), dst + r.begin());
+          },
+          partitioner_);
+    });
+    dst[pairs] = src[pairs];
+    input_ = local_input_.view();
+  }
+  res_ = Kernel::identity();
+  return true;
+}
+
+template <class Kernel>
+bool nesterov_a_neighbor_scan_tbb::NeighborScanTBB<Kernel>::validation() {
+  internal_order_test();
+  return Kernel::check(*taskData);
+}
+
+template <class Kernel>
+bool nesterov_a_neighbor_scan_tbb::NeighborScanTBB<Kernel>::run() {
+  internal_order_test();
+  const std::size_t pairs = input_.size() - 1;
+  arena_.execute([&] {
+    res_ = oneapi::tbb::parallel_reduce(
+        oneapi::tbb::blocked_range<std::size_t>(0, pairs), Kernel::identity(),
+        [&](const oneapi::tbb::blocked_range<std::size_t> &r, typename Kernel::Result running) {
+          bind_tbb_thread();
+          return Kernel::combine(running, Kernel::scan(input_.data(), r.begin(), r.end()));
+        },
+        Kernel::combine, partitioner_);
+  });
+  return true;
+}
+
+template <class Kernel>
+bool nesterov_a_neighbor_scan_tbb::NeighborScanTBB<Kernel>::post_processing() {
+  internal_order_test();
+  Kernel::store(*taskData, input_.data(), res_);
+  return true;
+}
+
+template class nesterov_a_neighbor_scan_tbb::NeighborScanTBB<ppc::core::NearestPair<int, uint64_t>>;
+template class nesterov_a_neighbor_scan_tbb::NeighborScanTBB<ppc::core::MostDifferentPair<int, uint64_t>>;
+template class nesterov_a_neighbor_scan_tbb::NeighborScanTBB<ppc::core::OrderViolationCount<int, uint64_t>>;
+template class nesterov_a_neighbor_scan_tbb::NeighborScanTBB<ppc::core::SignAlternationCount<int, uint64_t>>;
@@ -0,0 +1,23 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include "core/sparse/func_tests/sparse_task_tests.hpp"
+#include "tbb/sparse_matrix/include/ops_tbb.hpp"
+
+namespace {
+
+using RowSums = nesterov_a_sparse_matrix_tbb::SparseRowSumsTBB;
+using Product = nesterov_a_sparse_matrix_tbb::SparseMatrixVectorProductTBB;
+
+}  // namespace
+
+TEST(tbb_sparse_matrix, results_match_reference) {
+  ppc::test::sparse::check_results_match_reference<RowSums, Product>();
+}
+
+TEST(tbb_sparse_matrix, empty_rows_and_columns) { ppc::test::sparse::check_empty_rows_and_columns<RowSums>(); }
+
+TEST(tbb_sparse_matrix, validation) {
+  // product needs the vector
+  ppc::test::sparse::check_validation<Product>();
+}
@@ -0,0 +1,40 @@
+// Copyright 2024 Nesterov Alexander
+#ifndef TASKS_TBB_SPARSE_MATRIX_INCLUDE_OPS_TBB_HPP_
+#define TASKS_TBB_SPARSE_MATRIX_INCLUDE_OPS_TBB_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+#include "core/task/include/task.hpp"
+
+namespace nesterov_a_sparse_matrix_tbb {
+
+// Row sums or y = A x of a double CSR or CSC matrix with uint64_t indices,
+// threads get lines with balanced counts of nonzeros. Inputs and outputs
+// match the reference tasks SparseRowSums and SparseMatrixVectorProduct.
+template <bool WithVector>
+class SparseProductTBB : public ppc::core::Task {
+ public:
+  explicit SparseProductTBB(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  ppc::core::SparseMatrixView<double, uint64_t> matrix_;
+  const double *x_ = nullptr;
+  std::vector<double> res_;
+};
+
+using SparseRowSumsTBB = SparseProductTBB<false>;
+using SparseMatrixVectorProductTBB = SparseProductTBB<true>;
+
+extern template class SparseProductTBB<false>;
+extern template class SparseProductTBB<true>;
+
+}  // namespace nesterov_a_sparse_matrix_tbb
+
+#endif  // TASKS_TBB_SPARSE_MATRIX_INCLUDE_OPS_TBB_HPP_
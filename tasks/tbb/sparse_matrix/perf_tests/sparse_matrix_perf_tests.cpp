@@ -0,0 +1,115 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+#include <oneapi/tbb/tick_count.h>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/util/include/util.hpp"
+#include "tbb/sparse_matrix/include/ops_tbb.hpp"
+
+namespace {
+
+// n x n matrix of ones, line l holds per_line of them at scattered positions
+// (l + k * 7919) % n, so every row and every column has per_line nonzeros
+ppc::core::SparseMatrix<double, uint64_t> circulant(std::size_t n, std::size_t per_line,
+                                                    ppc::core::SparseFormat format) {
+  ppc::core::SparseMatrix<double, uint64_t> matrix;
+  matrix.format = format;
+  matrix.rows = n;
+  matrix.cols = n;
+  matrix.values.assign(n * per_line, 1.0);
+  matrix.indices.resize(n * per_line);
+  std::vector<uint64_t> offsets(n + 1);
+  for (std::size_t line = 0; line < n; line++) {
+    for (std::size_t k = 0; k < per_line; k++) matrix.indices[line * per_line + k] = (line + k * 7919) % n;
+    offsets[line + 1] = (line + 1) * per_line;
+  }
+  matrix.offsets = std::move(offsets);
+  return matrix;
+}
+
+}  // namespace
+
+TEST(tbb_sparse_matrix_perf_test, test_pipeline_run) {
+  // rows own their results, gather of x is the only scattered access
+  const std::size_t per_line = 10;
+  const std::size_t n = ppc::util::get_perf_size(10000000) / per_line;
+  auto matrix = circulant(n, per_line, ppc::core::SparseFormat::CSR);
+  auto shape = matrix.shape();
+  std::vector<double> x(n, 1.0);
+  std::vector<double> out(n, 0.0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(matrix.values);
+  taskData->add_input(matrix.indices);
+  taskData->add_input(matrix.offsets);
+  taskData->add_input(shape);
+  taskData->add_input(x);
+  taskData->add_output(out);
+
+  // Create Task
+  auto task = std::make_shared<nesterov_a_sparse_matrix_tbb::SparseMatrixVectorProductTBB>(taskData);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 100;
+  perfAttr->input_size = matrix.values.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
+  const auto t0 = oneapi::tbb::tick_count::now();
+  perfAttr->current_timer = [&] { return (oneapi::tbb::tick_count::now() - t0).seconds(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  perfAnalyzer->pipeline_run(perfAttr, perfResults);
+  ppc::core::Perf::print_perf_statistic(perfResults);
+  for (double value : out) {
+    ASSERT_EQ(value, static_cast<double>(per_line));
+  }
+}
+
+TEST(tbb_sparse_matrix_perf_test, test_task_run) {
+  // columns scatter into private copies of the sums
+  const std::size_t per_line = 10;
+  const std::size_t n = ppc::util::get_perf_size(10000000) / per_line;
+  auto matrix = circulant(n, per_line, ppc::core::SparseFormat::CSC);
+  auto shape = matrix.shape();
+  std::vector<double> out(n, 0.0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(matrix.values);
+  taskData->add_input(matrix.indices);
+  taskData->add_input(matrix.offsets);
+  taskData->add_input(shape);
+  taskData->add_output(out);
+
+  // Create Task
+  auto task = std::make_shared<nesterov_a_sparse_matrix_tbb::SparseRowSumsTBB>(taskData);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 100;
+  perfAttr->input_size = matrix.values.size();
+  perfAttr->num_threads = ppc::util::get_num_threads();
+  const auto t0 = oneapi::tbb::tick_count::now();
+  perfAttr->current_timer = [&] { return (oneapi::tbb::tick_count::now() - t0).seconds(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  perfAnalyzer->task_run(perfAttr, perfResults);
+  ppc::core::Perf::print_perf_statistic(perfResults);
+  for (double value : out) {
+    ASSERT_EQ(value, static_cast<double>(per_line));
+  }
+}
@@ -0,0 +1,52 @@
+// Copyright 2024 Nesterov Alexander
+#include "tbb/sparse_matrix/include/ops_tbb.hpp"
+
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/task_arena.h>
+
+#include <algorithm>
+
+#include "core/util/include/util.hpp"
+
+template <bool WithVector>
+bool nesterov_a_sparse_matrix_tbb::SparseProductTBB<WithVector>::pre_processing() {
+  internal_order_test();
+  // Init view of input data
+  matrix_ = ppc::core::sparse_input<double, uint64_t>(*taskData);
+  x_ = WithVector ? taskData->input_view<double>(4).data() : nullptr;
+  res_ = std::vector<double>(matrix_.rows);
+  return true;
+}
+
+template <bool WithVector>
+bool nesterov_a_sparse_matrix_tbb::SparseProductTBB<WithVector>::validation() {
+  internal_order_test();
+  return ppc::core::check_sparse_task<uint64_t>(*taskData, WithVector);
+}
+
+template <bool WithVector>
+bool nesterov_a_sparse_matrix_tbb::SparseProductTBB<WithVector>::run() {
+  internal_order_test();
+  const int num_threads = ppc::util::get_num_threads();
+  ppc::core::SparseProduct<double, uint64_t> product(matrix_, x_, static_cast<std::size_t>(num_threads), &scratch());
+  oneapi::tbb::task_arena arena(num_threads);
+  arena.execute([&] {
+    oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<std::size_t>(0, product.parts(), 1),
+                              [&](const oneapi::tbb::blocked_range<std::size_t> &r) {
+                                for (auto part = r.begin(); part != r.end(); ++part) product.run(part, res_.data());
+                              });
+  });
+  product.finish(res_.data());
+  return true;
+}
+
+template <bool WithVector>
+bool nesterov_a_sparse_matrix_tbb::SparseProductTBB<WithVector>::post_processing() {
+  internal_order_test();
+  std::copy(res_.begin(), res_.end(), reinterpret_cast<double *>(taskData->outputs[0]));
+  return true;
+}
+
+template class nesterov_a_sparse_matrix_tbb::SparseProductTBB<false>;
+template class nesterov_a_sparse_matrix_tbb::SparseProductTBB<true>;